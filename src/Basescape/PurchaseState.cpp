@@ -378,16 +378,7 @@ PurchaseState::PurchaseState(Base* const base)
 					++j)
 			{
 				if ((*j)->getRules()->getSoldierCapacity() != 0) // is transport craft
-				{
-					for (std::map<std::string, int>::const_iterator
-							k = (*j)->getCraftItems()->getContents()->begin();
-							k != (*j)->getCraftItems()->getContents()->end();
-							++k)
-					{
-						if (k->first == type)
-							baseQty += k->second;
-					}
-				}
+					baseQty += (*j)->getCraftItems()->getItemQuantity(type);
 
 				if ((*j)->getRules()->getVehicleCapacity() != 0) // is transport-craft capable of vehicles
 				{
@@ -499,20 +490,20 @@ void PurchaseState::btnOkClick(Action*)
 															_soldiers[sel]));
 						sol->getDiary()->awardHonorMedal();
 						transfer->setSoldier(sol);
-						_base->getTransfers()->push_back(transfer);
+						_base->addTransfer(transfer);
 					}
 					break;
 
 				case PST_SCIENTIST:
 					transfer = new Transfer(rules->getPersonnelTime());
 					transfer->setScientists(_orderQty[sel]);
-					_base->getTransfers()->push_back(transfer);
+					_base->addTransfer(transfer);
 					break;
 
 				case PST_ENGINEER:
 					transfer = new Transfer(rules->getPersonnelTime());
 					transfer->setEngineers(_orderQty[sel]);
-					_base->getTransfers()->push_back(transfer);
+					_base->addTransfer(transfer);
 					break;
 
 				case PST_CRAFT:
@@ -528,7 +519,7 @@ void PurchaseState::btnOkClick(Action*)
 													_base,
 													playSave));
 						transfer->setCraft(craft);
-						_base->getTransfers()->push_back(transfer);
+						_base->addTransfer(transfer);
 					}
 					break;
 
@@ -537,7 +528,7 @@ void PurchaseState::btnOkClick(Action*)
 					transfer->setTransferItems(
 										_items[getItemIndex(sel)],
 										_orderQty[sel]);
-					_base->getTransfers()->push_back(transfer);
+					_base->addTransfer(transfer);
 			}
 		}
 	}
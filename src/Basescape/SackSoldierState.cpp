@@ -108,8 +108,9 @@ void SackSoldierState::btnOkClick(Action*)
 	if (sol->getArmor()->isBasic() == false)
 		_base->getStorageItems()->addItem(sol->getArmor()->getStoreItem());
 
-	delete sol;
-	_base->getSoldiers()->erase(_base->getSoldiers()->begin() + static_cast<std::ptrdiff_t>(_solId));
+	_base->removeSoldier(
+					_base->getSoldiers()->begin() + static_cast<std::ptrdiff_t>(_solId),
+					true);
 
 	_game->popState();
 }
@@ -387,7 +387,7 @@ void SellState::btnOkClick(Action*)
 							if ((*i)->getArmor()->isBasic() == false)
 								_base->getStorageItems()->addItem((*i)->getArmor()->getStoreItem());
 
-							_base->getSoldiers()->erase(i);
+							_base->removeSoldier(i);
 							break;
 						}
 					}
@@ -174,7 +174,7 @@ void SoldierArmorState::lstArmorClick(Action*)
 			_base->getStorageItems()->removeItem(_armors[_lstArmor->getSelectedRow()]->getStoreItem());
 	}
 
-	_sol->setArmor(_armors[_lstArmor->getSelectedRow()]);
+	_base->equipArmor(_sol, _armors[_lstArmor->getSelectedRow()]);
 	_game->popState();
 }
 
@@ -473,8 +473,6 @@ void SoldierDiaryPerformanceState::init()
 			_txtTitle->setText(deceased->getLabel());
 		}
 
-		const std::vector<TacticalStatistics*>& tacticals (_game->getSavedGame()->getTacticalStatistics());
-
 		std::wstring
 			wst1,
 			wst2,
@@ -485,10 +483,10 @@ void SoldierDiaryPerformanceState::init()
 		if ((t = static_cast<int>(_diary->getMissionTotal())) != 0) // Mission stats ->
 			wst1 = tr("STR_MISSIONS_").arg(t);
 
-		if ((t = _diary->getWinTotal(tacticals)) != 0)
+		if ((t = _diary->getWinTotal()) != 0)
 			wst2 = tr("STR_WINS_").arg(t);
 
-		if ((t = _diary->getScoreTotal(tacticals)) != 0)
+		if ((t = _diary->getScoreTotal()) != 0)
 			wst3 = tr("STR_SCORE_VALUE_").arg(t);
 
 		if ((t = _diary->getDaysWoundedTotal()) != 0)
@@ -546,9 +544,9 @@ void SoldierDiaryPerformanceState::init()
 			_diary->getAlienRaceTotal(),
 			_diary->getAlienRankTotal(),
 			_diary->getWeaponTotal(),
-			_diary->getRegionTotal(tacticals),
-			_diary->getTypeTotal(tacticals),
-			_diary->getUfoTotal(tacticals)
+			_diary->getRegionTotal(),
+			_diary->getTypeTotal(),
+			_diary->getUfoTotal()
 		};
 
 		size_t r;
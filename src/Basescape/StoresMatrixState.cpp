@@ -359,16 +359,7 @@ StoresMatrixState::StoresMatrixState(const Base* base)
 					++k)
 			{
 				if ((*k)->getRules()->getSoldierCapacity() != 0) // is transport craft
-				{
-					for (std::map<std::string, int>::const_iterator
-							l = (*k)->getCraftItems()->getContents()->begin();
-							l != (*k)->getCraftItems()->getContents()->end();
-							++l)
-					{
-						if (l->first == type)
-							qty[baseId] += l->second;
-					}
-				}
+					qty[baseId] += (*k)->getCraftItems()->getItemQuantity(type);
 
 				if ((*k)->getRules()->getVehicleCapacity() != 0) // is transport craft capable of vehicles
 				{
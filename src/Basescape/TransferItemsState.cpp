@@ -354,16 +354,7 @@ void TransferItemsState::init()
 						++j)
 				{
 					if ((*j)->getRules()->getSoldierCapacity() != 0) // is transport craft
-					{
-						for (std::map<std::string, int>::const_iterator // add items on craft
-								k = (*j)->getCraftItems()->getContents()->begin();
-								k != (*j)->getCraftItems()->getContents()->end();
-								++k)
-						{
-							if (k->first == type)
-								destQty += k->second;
-						}
-					}
+						destQty += (*j)->getCraftItems()->getItemQuantity(type);
 
 					if ((*j)->getRules()->getVehicleCapacity() != 0) // is transport craft capable of vehicles
 					{
@@ -521,8 +512,8 @@ void TransferItemsState::completeTransfer()
 
 							transfer = new Transfer(eta);
 							transfer->setSoldier(*j);
-							_baseTarget->getTransfers()->push_back(transfer);
-							_baseSource->getSoldiers()->erase(j);
+							_baseTarget->addTransfer(transfer);
+							_baseSource->removeSoldier(j);
 							break;
 						}
 					}
@@ -532,14 +523,14 @@ void TransferItemsState::completeTransfer()
 					_baseSource->setScientists(_baseSource->getScientists() - _transferQty[sel]);
 					transfer = new Transfer(eta);
 					transfer->setScientists(_transferQty[sel]);
-					_baseTarget->getTransfers()->push_back(transfer);
+					_baseTarget->addTransfer(transfer);
 					break;
 
 				case PST_ENGINEER:
 					_baseSource->setEngineers(_baseSource->getEngineers() - _transferQty[sel]);
 					transfer = new Transfer(eta);
 					transfer->setEngineers(_transferQty[sel]);
-					_baseTarget->getTransfers()->push_back(transfer);
+					_baseTarget->addTransfer(transfer);
 					break;
 
 				case PST_CRAFT:
@@ -557,7 +548,7 @@ void TransferItemsState::completeTransfer()
 
 							transfer = new Transfer(eta);
 							transfer->setCraft(*j);
-							_baseTarget->getTransfers()->push_back(transfer);
+							_baseTarget->addTransfer(transfer);
 
 							_baseSource->getCrafts()->erase(j);
 							break;
@@ -574,7 +565,7 @@ void TransferItemsState::completeTransfer()
 					transfer->setTransferItems(
 											_items[getItemIndex(sel)],
 											_transferQty[sel]);
-					_baseTarget->getTransfers()->push_back(transfer);
+					_baseTarget->addTransfer(transfer);
 			}
 		}
 	}
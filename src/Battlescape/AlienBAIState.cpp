@@ -34,6 +34,7 @@
 
 #include "../Savegame/BattleItem.h"
 #include "../Savegame/SavedGame.h"
+#include "../Savegame/UnitTable.h"
 
 
 namespace OpenXcom
@@ -131,10 +132,10 @@ YAML::Node AlienBAIState::save() const
 void AlienBAIState::thinkAi(BattleAction* const aiAction)
 {
 	if (_traceAI) {
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "AlienBAIState::think(), id-" << _unit->getId() << " pos" << _unit->getPosition();
-		Log(LOG_INFO) << ". agression= " << _aggression;
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::think(), id-" << _unit->getId() << " pos" << _unit->getPosition();
+		LogSub(LOGSUB_AI, LOG_INFO) << ". agression= " << _aggression;
 	}
 
 	if (_unit->getChargeTarget() != nullptr
@@ -164,10 +165,10 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 	_targetsVisible = selectNearestTarget(); // sets _unitAggro.
 
 	if (_traceAI) {
-		Log(LOG_INFO) << "_spottersOrigin = " << _spottersOrigin;
-		Log(LOG_INFO) << "_targetsExposed = " << _targetsExposed;
-		Log(LOG_INFO) << "_targetsVisible = " << _targetsVisible;
-		Log(LOG_INFO) << "_AIMode = " << BattleAIState::debugAiMode(_AIMode);
+		LogSub(LOGSUB_AI, LOG_INFO) << "_spottersOrigin = " << _spottersOrigin;
+		LogSub(LOGSUB_AI, LOG_INFO) << "_targetsExposed = " << _targetsExposed;
+		LogSub(LOGSUB_AI, LOG_INFO) << "_targetsVisible = " << _targetsVisible;
+		LogSub(LOGSUB_AI, LOG_INFO) << "_AIMode = " << BattleAIState::debugAiMode(_AIMode);
 	}
 
 //	_pf->setPathingUnit(_unit);
@@ -190,23 +191,23 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 	if (aiAction->weapon != nullptr)
 	{
 		const RuleItem* const itRule (aiAction->weapon->getRules());
-		if (_traceAI) Log(LOG_INFO) << ". weapon " << itRule->getType();
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". weapon " << itRule->getType();
 
 		switch (itRule->getBattleType())
 		{
 			case BT_FIREARM:
-				if (_traceAI) Log(LOG_INFO) << ". . weapon is Firearm";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . weapon is Firearm";
 				if (itRule->isWaypoints() != 0
 					&& _targetsExposed > _targetsVisible) // else let BL fallback to aimed-shot
 				{
-					if (_traceAI) Log(LOG_INFO) << ". . . blaster TRUE";
+					if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . blaster TRUE";
 					_hasBlaster = true;
 					tuReserve = _unit->getTu()
 							  - _unit->getActionTu(BA_LAUNCH, aiAction->weapon);
 				}
 				else
 				{
-					if (_traceAI) Log(LOG_INFO) << ". . . rifle TRUE";
+					if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . rifle TRUE";
 					_hasRifle = true;
 					tuReserve = _unit->getTu()
 							  - _unit->getActionTu(
@@ -216,7 +217,7 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 				break;
 
 			case BT_MELEE:
-				if (_traceAI) Log(LOG_INFO) << ". . melee TRUE";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . melee TRUE";
 				_hasMelee = true;
 				tuReserve = _unit->getTu()
 						  - _unit->getActionTu(BA_MELEE, aiAction->weapon);
@@ -227,7 +228,7 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 //				_doGrenade = true; // <- getMainHandWeapon() does not return grenades.
 		}
 	}
-	else if (_traceAI) Log(LOG_INFO) << ". weapon is NULL";
+	else if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". weapon is NULL";
 //	else if () // kL_add -> Give the invisible 'meleeWeapon' param a try ....
 //	{}
 
@@ -239,9 +240,9 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 
 	// NOTE: These setups could have an order: Escape, Ambush, Attack, Patrol.
 
-	if (_traceAI) Log(LOG_INFO) << ". setupAttack()";
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". setupAttack()";
 	setupAttack();
-	if (_traceAI) Log(LOG_INFO) << "";
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "";
 
 	switch (_psiAction->type) // if a psi-action was determined by setupAttack() just do it ->
 	{
@@ -254,33 +255,33 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 			aiAction->type      = _psiAction->type;
 			aiAction->posTarget = _psiAction->posTarget;
 
-			if (_traceAI) Log(LOG_INFO) << "AlienBAIState::think() EXIT, Psi";
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::think() EXIT, Psi";
 			return;
 
 //		case BA_NONE: break;
 	}
 
 
-	if (_traceAI) Log(LOG_INFO) << ". setupPatrol()";
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". setupPatrol()";
 	setupPatrol();
-	if (_traceAI) Log(LOG_INFO) << "";
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "";
 
 	if (_targetsExposed != 0 && _tuAmbush == -1 && _hasMelee == false)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". setupAmbush()";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". setupAmbush()";
 		setupAmbush();
-		if (_traceAI) Log(LOG_INFO) << "";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 
 	if (_spottersOrigin != 0 && _tuEscape == -1)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". setupEscape()";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". setupEscape()";
 		setupEscape();
-		if (_traceAI) Log(LOG_INFO) << "";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 
 
-	if (_traceAI) Log(LOG_INFO) << ". evaluate [1] " << BattleAIState::debugAiMode(_AIMode);
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". evaluate [1] " << BattleAIState::debugAiMode(_AIMode);
 	bool evaluate;
 	switch (_AIMode)
 	{
@@ -307,7 +308,7 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 					|| _targetsExposed == 0;
 	}
 
-	if (_traceAI) Log(LOG_INFO) << ". do Evaluate = " << evaluate;
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". do Evaluate = " << evaluate;
 	if (evaluate == true
 		|| (_spottersOrigin > 1
 			|| _unit->getHealth() < (_unit->getBattleStats()->health << 1u) / 3
@@ -317,11 +318,11 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 			|| (_battleSave->isCheating() == true
 				&& _AIMode != AI_COMBAT)))
 	{
-		if (_traceAI) Log(LOG_INFO) << ". . AIMode pre-Evaluate = " << BattleAIState::debugAiMode(_AIMode);
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . AIMode pre-Evaluate = " << BattleAIState::debugAiMode(_AIMode);
 		evaluateAiMode();
-		if (_traceAI) Log(LOG_INFO) << ". . AIMode post-Evaluate = " << BattleAIState::debugAiMode(_AIMode);
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . AIMode post-Evaluate = " << BattleAIState::debugAiMode(_AIMode);
 	}
-	if (_traceAI) Log(LOG_INFO) << ". evaluate [2] " << BattleAIState::debugAiMode(_AIMode);
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". evaluate [2] " << BattleAIState::debugAiMode(_AIMode);
 
 	switch (_AIMode)
 	{
@@ -345,7 +346,7 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 			aiAction->type		= _patrolAction->type;
 			aiAction->posTarget	= _patrolAction->posTarget;
 //			aiAction->firstTU	= _patrolAction->firstTU;
-			if (_traceAI) Log(LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
 			break;
 
 		case AI_COMBAT:
@@ -360,14 +361,14 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 													aiAction->type,
 													aiAction->weapon);
 
-			if (_traceAI) Log(LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
 			switch (aiAction->type)
 			{
 				case BA_THROW:
 					if (aiAction->weapon != nullptr // TODO: Ensure this was done already ....
 						&& aiAction->weapon->getRules()->getBattleType() == BT_GRENADE)
 					{
-						if (_traceAI) Log(LOG_INFO) << ". . Throw grenade - spend Tu for COMBAT";
+						if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Throw grenade - spend Tu for COMBAT";
 						int costTu (aiAction->weapon->getInventorySection()
 										->getCost(_battleSave->getBattleGame()->getRuleset()->getInventoryRule(ST_RIGHTHAND)));
 
@@ -384,13 +385,13 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 															BA_SNAPSHOT,	// TODO: Hook this into _reserve/ selectFireMethod().
 															aiAction->weapon))
 					{
-						if (_traceAI) Log(LOG_INFO) << ". . Move w/ rifle + tu for COMBAT";
+						if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Move w/ rifle + tu for COMBAT";
 						_battleSave->getBattleGame()->decAiActionCount();
 					}
 					break;
 
 				case BA_LAUNCH:
-					if (_traceAI) Log(LOG_INFO) << ". . Launch - copy waypoints for COMBAT";
+					if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Launch - copy waypoints for COMBAT";
 					aiAction->waypoints = _attackAction->waypoints;
 			}
 
@@ -407,7 +408,7 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 			aiAction->finalFacing	= _ambushAction->finalFacing;
 			aiAction->finalAction	= true;
 
-			if (_traceAI) Log(LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
 			break;
 
 		case AI_ESCAPE:
@@ -420,13 +421,13 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
 			aiAction->finalAction	=
 			aiAction->desperate		= true;
 
-			if (_traceAI) Log(LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . ActionType = " << BattleAction::debugBat(aiAction->type);
 			_unit->setHiding(); // used by UnitWalkBState::postPathProcedures()
 	}
 
 	if (aiAction->type == BA_MOVE)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". BA_MOVE";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". BA_MOVE";
 //		if (aiAction->posTarget == _unit->getPosition())	// leave this in because unit could conceivably
 //		{													// do a finalFacing pivot.
 //			if (_traceAI) Log(LOG_INFO) << ". . Stay put";
@@ -450,7 +451,7 @@ void AlienBAIState::thinkAi(BattleAction* const aiAction)
  */
 void AlienBAIState::setupPatrol() // private.
 {
-	if (_traceAI) Log(LOG_INFO) << "AlienBAIState::setupPatrol() id-" << _unit->getId();
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupPatrol() id-" << _unit->getId();
 
 	_patrolAction->TU = 0;
 
@@ -580,9 +581,9 @@ void AlienBAIState::setupPatrol() // private.
 	}
 
 	if (_traceAI) {
-		Log(LOG_INFO) << BattleAction::debugBAction(*_patrolAction);
-		Log(LOG_INFO) << "AlienBAIState::setupPatrol() EXIT";
-		Log(LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << BattleAction::debugBAction(*_patrolAction);
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupPatrol() EXIT";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 }
 
@@ -595,71 +596,71 @@ void AlienBAIState::setupPatrol() // private.
  */
 void AlienBAIState::setupAttack() // private.
 {
-	if (_traceAI) Log(LOG_INFO) << "AlienBAIState::setupAttack() id-" << _unit->getId();
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupAttack() id-" << _unit->getId();
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "AlienBAIState::setupAttack() id-" << _unit->getId();
 	//Log(LOG_INFO) << ". _targetsExposed= " << _targetsExposed;
 
 	_attackAction->type = BA_THINK;
 
-	if (_traceAI) Log(LOG_INFO) << ". _targetsExposed = " << _targetsExposed;
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". _targetsExposed = " << _targetsExposed;
 	if (_targetsExposed != 0 && RNG::percent(PSI_OR_BLASTER_PCT) == true)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". . Run psiAction() OR wayPointAction()";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Run psiAction() OR wayPointAction()";
 		//Log(LOG_INFO) << ". . psiTried= " << _unit->psiTried();
 		if ((_unit->psiTried() < PSI_TRIED_LIMIT && psiAction() == true)
 			|| (_hasBlaster == true && wayPointAction() == true))
 		{
 			if (_traceAI) {
-				if (_psiAction->type != BA_NONE) Log(LOG_INFO) << ". . . psi action";
-				else Log(LOG_INFO) << ". . . blaster action";
+				if (_psiAction->type != BA_NONE) LogSub(LOGSUB_AI, LOG_INFO) << ". . . psi action";
+				else LogSub(LOGSUB_AI, LOG_INFO) << ". . . blaster action";
 			}
 			return;
 		}
-		else if (_traceAI) Log(LOG_INFO) << ". . . no psi OR wayPoint action";
+		else if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . no psi OR wayPoint action";
 	}
 	else
 	{
-		if (_traceAI) Log(LOG_INFO) << ". . no psi OR wayPoint action";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . no psi OR wayPoint action";
 		_hasBlaster = false;
 	}
 
 	//if (_traceAI) Log(LOG_INFO) << ". selectNearestTarget()";
 //	if (selectNearestTarget() != 0)
-	if (_traceAI) Log(LOG_INFO) << ". _targetsVisible = " << _targetsVisible;
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". _targetsVisible = " << _targetsVisible;
 	if (_targetsVisible != 0)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". . Call grenadeAction()";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Call grenadeAction()";
 		if (grenadeAction() == false)
 		{
-			if (_traceAI) Log(LOG_INFO) << ". . . try rifle Or melee";
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . try rifle Or melee";
 			if (_hasRifle == true && _hasMelee == true)
 			{
-				if (_traceAI) Log(LOG_INFO) << ". . Melee & Rifle are TRUE, Call chooseMeleeOrRanged()";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Melee & Rifle are TRUE, Call chooseMeleeOrRanged()";
 				chooseMeleeOrRanged();
 			}
 
 			if (_hasRifle == true)
 			{
-				if (_traceAI) Log(LOG_INFO) << ". . Call rifleAction()";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Call rifleAction()";
 				rifleAction();
-				if (_traceAI) Log(LOG_INFO) << "";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "";
 			}
 			else if (_hasMelee == true)
 			{
-				if (_traceAI) Log(LOG_INFO) << ". . Call meleeAction()";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . Call meleeAction()";
 				meleeAction();
-				if (_traceAI) Log(LOG_INFO) << "";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "";
 			}
 		}
-		else if (_traceAI) Log(LOG_INFO) << ". . grenadeAction() TRUE";
+		else if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . grenadeAction() TRUE";
 	}
 	//if (_traceAI) Log(LOG_INFO) << ". selectNearestTarget() DONE";
 
 	if (_traceAI) {
-		Log(LOG_INFO) << ". Attack bat = " << BattleAction::debugBat(_attackAction->type);
-		if		(_attackAction->type == BA_MOVE)	Log(LOG_INFO) << ". . walk to " << _attackAction->posTarget;
-		else if	(_attackAction->type != BA_THINK)	Log(LOG_INFO) << ". . shoot/throw at " << _attackAction->posTarget;
+		LogSub(LOGSUB_AI, LOG_INFO) << ". Attack bat = " << BattleAction::debugBat(_attackAction->type);
+		if		(_attackAction->type == BA_MOVE)	LogSub(LOGSUB_AI, LOG_INFO) << ". . walk to " << _attackAction->posTarget;
+		else if	(_attackAction->type != BA_THINK)	LogSub(LOGSUB_AI, LOG_INFO) << ". . shoot/throw at " << _attackAction->posTarget;
 	}
 
 	if (_attackAction->type == BA_THINK
@@ -668,15 +669,15 @@ void AlienBAIState::setupAttack() // private.
 	{
 		bool debugFound = findFirePosition();
 		if (_traceAI) {
-			if (debugFound) Log(LOG_INFO) << ". . findFirePosition TRUE " << _attackAction->posTarget;
-			else Log(LOG_INFO) << ". . findFirePosition FAILED";
+			if (debugFound) LogSub(LOGSUB_AI, LOG_INFO) << ". . findFirePosition TRUE " << _attackAction->posTarget;
+			else LogSub(LOGSUB_AI, LOG_INFO) << ". . findFirePosition FAILED";
 		}
 	}
 
 	if (_traceAI) {
-		Log(LOG_INFO) << BattleAction::debugBAction(*_attackAction);
-		Log(LOG_INFO) << "AlienBAIState::setupAttack() EXIT";
-		Log(LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << BattleAction::debugBAction(*_attackAction);
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupAttack() EXIT";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 }
 
@@ -690,7 +691,7 @@ void AlienBAIState::setupAttack() // private.
  */
 void AlienBAIState::setupAmbush() // private.
 {
-	if (_traceAI) Log(LOG_INFO) << "AlienBAIState::setupAmbush() id-" << _unit->getId();
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupAmbush() id-" << _unit->getId();
 	_ambushAction->type = BA_THINK;
 //	_ambushAction->firstTU = -1;
 
@@ -731,6 +732,8 @@ void AlienBAIState::setupAmbush() // private.
 		std::vector<Position> tileSearch (_battleSave->getTileSearch());
 		RNG::shuffle(tileSearch.begin(), tileSearch.end());
 
+		const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+
 		for (std::vector<Position>::const_iterator
 				i  = tileSearch.begin();
 				i != tileSearch.end();
@@ -860,9 +863,9 @@ void AlienBAIState::setupAmbush() // private.
 	}
 
 	if (_traceAI) {
-		Log(LOG_INFO) << BattleAction::debugBAction(*_ambushAction);
-		Log(LOG_INFO) << "AlienBAIState::setupAmbush() EXIT";
-		Log(LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << BattleAction::debugBAction(*_ambushAction);
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupAmbush() EXIT";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 }
 
@@ -874,7 +877,7 @@ void AlienBAIState::setupAmbush() // private.
  */
 void AlienBAIState::setupEscape() // private.
 {
-	if (_traceAI) Log(LOG_INFO) << "AlienBAIState::setupEscape() id-" << _unit->getId();
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupEscape() id-" << _unit->getId();
 //	selectNearestTarget(); // sets _unitAggro
 //	const int spottersOrigin (tallySpotters(_unit->getPosition()));
 
@@ -886,12 +889,12 @@ void AlienBAIState::setupEscape() // private.
 		distAggroOrigin = TileEngine::distance(
 										_unit->getPosition(),
 										_unitAggro->getPosition());
-		if (_traceAI) Log(LOG_INFO) << ". aggroUnit VALID dist= " << distAggroOrigin;
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". aggroUnit VALID dist= " << distAggroOrigin;
 	}
 	else
 	{
 		distAggroOrigin = 0;
-		if (_traceAI) Log(LOG_INFO) << ". aggroUnit NOT Valid dist= " << distAggroOrigin;
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". aggroUnit NOT Valid dist= " << distAggroOrigin;
 	}
 
 	Tile* tile;
@@ -905,6 +908,8 @@ void AlienBAIState::setupEscape() // private.
 
 	_pf->setPathingUnit(_unit);
 
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+
 	bool
 //		coverFound (false),
 		first (true);
@@ -1040,21 +1045,21 @@ void AlienBAIState::setupEscape() // private.
 	if (score != ESCAPE_FAIL)
 	{
 //		if (_traceAI) _battleSave->getTile(_escapeAction->posTarget)->setPreviewColor(TRACE_PURPLE);
-		if (_traceAI) Log(LOG_INFO) << ". set bat BA_MOVE";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". set bat BA_MOVE";
 		_escapeAction->type = BA_MOVE;
 	}
 	else
 	{
-		if (_traceAI) Log(LOG_INFO) << ". set bat BA_THINK";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". set bat BA_THINK";
 		_escapeAction->type = BA_THINK;
 //		_escapeAction->firstTU = -1;
 		_tuEscape = -1;
 	}
 
 	if (_traceAI) {
-		Log(LOG_INFO) << BattleAction::debugBAction(*_escapeAction);
-		Log(LOG_INFO) << "AlienBAIState::setupEscape() EXIT";
-		Log(LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << BattleAction::debugBAction(*_escapeAction);
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::setupEscape() EXIT";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 }
 
@@ -1064,13 +1069,13 @@ void AlienBAIState::setupEscape() // private.
 void AlienBAIState::evaluateAiMode() // private.
 {
 	if (_traceAI) {
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "AlienBAIState::evaluateAiMode() id-" << _unit->getId();
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::evaluateAiMode() id-" << _unit->getId();
 	}
 	if (_unit->getChargeTarget() != nullptr
 		&& _attackAction->type != BA_THINK)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". chargeTarget VALID - Not Think - return COMBAT";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". chargeTarget VALID - Not Think - return COMBAT";
 		_AIMode = AI_COMBAT;
 		return;
 	}
@@ -1081,12 +1086,12 @@ void AlienBAIState::evaluateAiMode() // private.
 		|| _hasBlaster == true)	// The two (_hasBlaster== true) checks in this function ought obviate the entire re-evaluate thing!
 								// Note there is a valid targetPosition but targetUnit is NOT at that Pos if blaster=TRUE ....
 	{
-		if (_traceAI) Log(LOG_INFO) << ". chargeTarget Or waypoints Or blaster - set COMBAT";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". chargeTarget Or waypoints Or blaster - set COMBAT";
 		_AIMode = AI_COMBAT;
 	}
 	else
 	{
-		if (_traceAI) Log(LOG_INFO) << ". Evaluate ...";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". Evaluate ...";
 		float
 			patrolOdds (28.f),
 			combatOdds (23.f),
@@ -1218,15 +1223,15 @@ void AlienBAIState::evaluateAiMode() // private.
 		}
 
 		if (_traceAI) {
-			Log(LOG_INFO) << "patrolOdds = " << patrolOdds;
-			Log(LOG_INFO) << "combatOdds = " << combatOdds;
-			Log(LOG_INFO) << "ambushOdds = " << ambushOdds;
-			Log(LOG_INFO) << "escapeOdds = " << escapeOdds;
+			LogSub(LOGSUB_AI, LOG_INFO) << "patrolOdds = " << patrolOdds;
+			LogSub(LOGSUB_AI, LOG_INFO) << "combatOdds = " << combatOdds;
+			LogSub(LOGSUB_AI, LOG_INFO) << "ambushOdds = " << ambushOdds;
+			LogSub(LOGSUB_AI, LOG_INFO) << "escapeOdds = " << escapeOdds;
 		}
 
 		const float decision (RNG::generate(0.f, patrolOdds + combatOdds + ambushOdds + escapeOdds));
 
-		if (_traceAI) Log(LOG_INFO) << "decision Pre = " << decision;
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "decision Pre = " << decision;
 		if (decision <= patrolOdds)
 			_AIMode = AI_PATROL;
 		else if (decision <= patrolOdds + combatOdds)
@@ -1235,7 +1240,7 @@ void AlienBAIState::evaluateAiMode() // private.
 			_AIMode = AI_AMBUSH;
 		else
 			_AIMode = AI_ESCAPE;
-		if (_traceAI) Log(LOG_INFO) << "decision Post = " << BattleAIState::debugAiMode(_AIMode);
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "decision Post = " << BattleAIState::debugAiMode(_AIMode);
 	}
 
 	// TODO: These fallbacks should go in accord with the Odds above^
@@ -1246,13 +1251,13 @@ void AlienBAIState::evaluateAiMode() // private.
 	// 4) Escape
 	if (_AIMode == AI_PATROL && _stopNode == nullptr)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". fallback COMBAT";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". fallback COMBAT";
 		_AIMode = AI_COMBAT;
 	}
 
 	if (_AIMode == AI_COMBAT)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". AI_COMBAT _hasBlaster = " << _hasBlaster;
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". AI_COMBAT _hasBlaster = " << _hasBlaster;
 //		if (_unitAggro)
 		if (_attackAction->type == BA_LAUNCH
 //		if (_hasBlaster == true // note: Blaster-wielding units should go for an AimedShot ... costs less TU.
@@ -1260,35 +1265,35 @@ void AlienBAIState::evaluateAiMode() // private.
 			|| (   _battleSave->getTile(_attackAction->posTarget) != nullptr
 				&& _battleSave->getTile(_attackAction->posTarget)->getTileUnit() != nullptr))
 		{
-			if (_traceAI) Log(LOG_INFO) << ". . try rifle Or do blaster Action";
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . try rifle Or do blaster Action";
 			if (_attackAction->type != BA_THINK || findFirePosition() == true)
 			{
-				if (_traceAI) Log(LOG_INFO) << ". . . NOT Think Or findFirePosition() TRUE - ret COMBAT";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . NOT Think Or findFirePosition() TRUE - ret COMBAT";
 				return;
 			}
 		}
 		else if (selectTarget() == true && findFirePosition() == true)
 		{
-			if (_traceAI) Log(LOG_INFO) << ". . selectTarget() TRUE And findFirePosition() TRUE - ret COMBAT";
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . selectTarget() TRUE And findFirePosition() TRUE - ret COMBAT";
 			return;
 		}
 
-		if (_traceAI) Log(LOG_INFO) << ". fallback AMBUSH";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". fallback AMBUSH";
 		_AIMode = AI_AMBUSH;
 	}
 
 	if (_AIMode == AI_AMBUSH && _tuAmbush == -1)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". fallback ESCAPE";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". fallback ESCAPE";
 		_AIMode = AI_ESCAPE;
 	}
 
 	if (_AIMode == AI_ESCAPE && _tuEscape == -1)
 	{
-		if (_traceAI) Log(LOG_INFO) << ". fallback PATROL -> Error: Nothing To Do.";
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". fallback PATROL -> Error: Nothing To Do.";
 		_AIMode = AI_PATROL;
 	}
-	if (_traceAI) Log(LOG_INFO) << " Final decision = " << BattleAIState::debugAiMode(_AIMode);
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << " Final decision = " << BattleAIState::debugAiMode(_AIMode);
 }
 
 /**
@@ -1311,6 +1316,8 @@ int AlienBAIState::tallyTargets() const // private.
 
 /**
  * Counts Player units that spot a position.
+ * @note The units are tested from the rows of the UnitTable. If this AI plays
+ * xCom on the bench the spotters are the aLiens that xCom sees instead.
  * @param pos - reference to a Position to check
  * @return, qty of spotters
  */
@@ -1328,20 +1335,35 @@ int AlienBAIState::tallySpotters(const Position& pos) const // private.
 		originVoxel,
 		targetVoxel;
 
-	for (std::vector<BattleUnit*>::const_iterator
-			i  = _battleSave->getUnits()->begin();
-			i != _battleSave->getUnits()->end();
+	UnitFaction spotter;
+	switch (_unit->getFaction())
+	{
+		case FACTION_PLAYER: spotter = FACTION_HOSTILE; break;
+		default:             spotter = FACTION_PLAYER;
+	}
+
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+	const std::vector<UnitTable::Row>& rows (_battleSave->getUnitTable()->getRows());
+	for (std::vector<UnitTable::Row>::const_iterator
+			i  = rows.begin();
+			i != rows.end();
 			++i)
 	{
-		if (validTarget(*i) == true
-			&& TileEngine::distSqr(pos, (*i)->getPosition()) <= TileEngine::SIGHTDIST_TSp_Sqr) // Could use checkViewSector() and/or visible()
+		if (i->faction == spotter // cf. validTarget()
+			&& UnitTable::isOut(*i) == false
+			&& ((spotter == FACTION_PLAYER
+					&& i->exposed != -1
+					&& i->exposed <= _unit->getIntelligence())
+				|| (spotter == FACTION_HOSTILE
+					&& i->unit->getUnitVisible() == true))
+			&& TileEngine::distSqr(pos, i->pos) <= TileEngine::SIGHTDIST_TSp_Sqr) // Could use checkViewSector() and/or visible()
 		{
-			originVoxel = _te->getSightOriginVoxel(*i);
+			originVoxel = _te->getSightOriginVoxel(i->unit);
 			if (_te->doTargetUnit(				// check if xCom agent can target on position
 								&originVoxel,	// WARNING: Does not include visible() check.
 								_battleSave->getTile(pos),
 								&targetVoxel,
-								*i,
+								i->unit,
 								hypoUnit) == true)
 			{
 				++ret;
@@ -1442,8 +1464,8 @@ int AlienBAIState::selectNearestTarget() // private.
 bool AlienBAIState::selectPlayerTarget() // private.
 {
 	if (_traceAI) {
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "selectPlayerTarget()";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "selectPlayerTarget()";
 	}
 
 	_unitAggro = nullptr;
@@ -1469,11 +1491,11 @@ bool AlienBAIState::selectPlayerTarget() // private.
 		}
 	}
 	if (_traceAI && _unitAggro != nullptr) {
-		Log(LOG_INFO) << ". dist = " << std::sqrt(dist);
-		Log(LOG_INFO) << ". unitAggro id-" << _unitAggro->getId();
+		LogSub(LOGSUB_AI, LOG_INFO) << ". dist = " << std::sqrt(dist);
+		LogSub(LOGSUB_AI, LOG_INFO) << ". unitAggro id-" << _unitAggro->getId();
 	}
 
-	if (_traceAI) Log(LOG_INFO) << "";
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << "";
 	return (_unitAggro != nullptr);
 }
 
@@ -1518,8 +1540,8 @@ bool AlienBAIState::selectTarget() // private.
 bool AlienBAIState::findFirePosition() // private.
 {
 	if (_traceAI) {
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "findFirePosition()";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "findFirePosition()";
 	}
 
 	if (selectPlayerTarget() == true) // sets _unitAggro.
@@ -1541,6 +1563,8 @@ bool AlienBAIState::findFirePosition() // private.
 		std::vector<Position> tileSearch (_battleSave->getTileSearch());
 		RNG::shuffle(tileSearch.begin(), tileSearch.end());
 
+		const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+
 		for (std::vector<Position>::const_iterator
 				i  = tileSearch.begin();
 				i != tileSearch.end();
@@ -1563,9 +1587,9 @@ bool AlienBAIState::findFirePosition() // private.
 					_pf->calculatePath(_unit, pos);
 					int dir (_pf->getStartDirection());
 					if (_traceAI) {
-						Log(LOG_INFO) << ". dir= " << dir;
-						Log(LOG_INFO) << ". _pf->getTuCostTotalPf()= " << _pf->getTuCostTotalPf();
-						Log(LOG_INFO) << ". _unit->getTu()= " << _unit->getTu();
+						LogSub(LOGSUB_AI, LOG_INFO) << ". dir= " << dir;
+						LogSub(LOGSUB_AI, LOG_INFO) << ". _pf->getTuCostTotalPf()= " << _pf->getTuCostTotalPf();
+						LogSub(LOGSUB_AI, LOG_INFO) << ". _unit->getTu()= " << _unit->getTu();
 					}
 
 					if (dir != -1) // && _pf->getTuCostTotalPf() <= _unit->getTu() // NOTE: _reachableAttack takes care of tu consideration
@@ -1576,11 +1600,11 @@ bool AlienBAIState::findFirePosition() // private.
 						if (_unitAggro->checkViewSector(pos) == false)
 							scoreTest += 15;
 
-						if (_traceAI) Log(LOG_INFO) << ". . scoreTest= " << scoreTest << " / score= " << score;
+						if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . scoreTest= " << scoreTest << " / score= " << score;
 
 						if (scoreTest > score)
 						{
-							if (_traceAI) Log(LOG_INFO) << ". . . pos " << pos;
+							if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . pos " << pos;
 
 							score = scoreTest;
 							_attackAction->posTarget = pos;
@@ -1603,16 +1627,16 @@ bool AlienBAIState::findFirePosition() // private.
 //			else chooseFireMethod() & setup the action for handleUnitAI()
 
 			if (_traceAI) {
-				Log(LOG_INFO) << ". success " << _attackAction->posTarget << " score = " << score;
-				Log(LOG_INFO) << "";
+				LogSub(LOGSUB_AI, LOG_INFO) << ". success " << _attackAction->posTarget << " score = " << score;
+				LogSub(LOGSUB_AI, LOG_INFO) << "";
 			}
 			return true;
 		}
 	}
 
 	if (_traceAI) {
-		Log(LOG_INFO) << "Firepoint failed";//: best estimation was " << _attackAction->posTarget << " with a score of " << score;
-		Log(LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "Firepoint failed";//: best estimation was " << _attackAction->posTarget << " with a score of " << score;
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 
 //	_attackAction->firstTU = -1;
@@ -1784,10 +1808,10 @@ bool AlienBAIState::wayPointAction() // private.
 										BA_LAUNCH,
 										_attackAction->weapon);
 	if (_traceAI) {
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "AlienBAIState::wayPointAction() id-" << _unit->getId() << " w/ " << _attackAction->weapon->getRules()->getType();
-		Log(LOG_INFO) << ". actionTU = " << _attackAction->TU;
-		Log(LOG_INFO) << ". unitTU = " << _unit->getTu();
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::wayPointAction() id-" << _unit->getId() << " w/ " << _attackAction->weapon->getRules()->getType();
+		LogSub(LOGSUB_AI, LOG_INFO) << ". actionTU = " << _attackAction->TU;
+		LogSub(LOGSUB_AI, LOG_INFO) << ". unitTU = " << _unit->getTu();
 	}
 
 	if (_attackAction->TU <= _unit->getTu())
@@ -1802,21 +1826,21 @@ bool AlienBAIState::wayPointAction() // private.
 				i != _battleSave->getUnits()->end();
 				++i)
 		{
-			if (_traceAI) Log(LOG_INFO) << ". . test Vs unit id-" << (*i)->getId() << " pos " << (*i)->getPosition();
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . test Vs unit id-" << (*i)->getId() << " pos " << (*i)->getPosition();
 			if (validTarget(*i, true, true) == true)
 			{
-				if (_traceAI) Log(LOG_INFO) << ". . . unit VALID";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . unit VALID";
 				if (explosiveEfficacy(
 								(*i)->getPosition(),
 								_unit,
 								explRadius,
 								_attackAction->diff) == true)
 				{
-					if (_traceAI) Log(LOG_INFO) << ". . . . explEff VALID";
+					if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . . explEff VALID";
 					if (pathWaypoints(*i) == true)
 						targets.push_back(*i);
 				}
-				else if (_traceAI) Log(LOG_INFO) << ". . . . explEff invalid";
+				else if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . . explEff invalid";
 			}
 		}
 
@@ -1854,9 +1878,9 @@ bool AlienBAIState::wayPointAction() // private.
 bool AlienBAIState::pathWaypoints(const BattleUnit* const unit) // private.
 {
 	if (_traceAI) {
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "AlienBAIState::pathWaypoints() vs id-" << unit->getId() << " pos " << unit->getPosition();
-		Log(LOG_INFO) << ". actor id-" << _unit->getId() << " pos " << _unit->getPosition();
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::pathWaypoints() vs id-" << unit->getId() << " pos " << unit->getPosition();
+		LogSub(LOGSUB_AI, LOG_INFO) << ". actor id-" << _unit->getId() << " pos " << _unit->getPosition();
 	}
 
 	_pf->setPathingUnit(_unit); // jic.
@@ -1887,11 +1911,11 @@ bool AlienBAIState::pathWaypoints(const BattleUnit* const unit) // private.
 			}
 			// dir changed:
 			_attackAction->waypoints.push_back(pos); // place wp. Auto-explodes at last wp. Or when it hits anything, lulz.
-			if (_traceAI) Log(LOG_INFO) << ". . place WP " << pos;
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . place WP " << pos;
 		}
 
 		// pathing done & wp's have been positioned:
-		if (_traceAI) Log(LOG_INFO) << ". . qty WP's = " << _attackAction->waypoints.size() << " / max WP's = " << _attackAction->weapon->getRules()->isWaypoints();
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . qty WP's = " << _attackAction->waypoints.size() << " / max WP's = " << _attackAction->weapon->getRules()->isWaypoints();
 		if (_attackAction->waypoints.size() != 0u)
 		{
 			int wp (_attackAction->weapon->getRules()->isWaypoints()
@@ -1900,14 +1924,14 @@ bool AlienBAIState::pathWaypoints(const BattleUnit* const unit) // private.
 			if (wp < 1) wp = 1;
 			if (static_cast<int>(_attackAction->waypoints.size()) <= wp)
 			{
-				if (_traceAI) Log(LOG_INFO) << ". . . path valid, ret TRUE";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . path valid, ret TRUE";
 				return true;
 			}
-			if (_traceAI) Log(LOG_INFO) << ". . too many WP's !!";
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . too many WP's !!";
 		}
 	}
 
-	if (_traceAI) Log(LOG_INFO) << ". path or WP's invalid, ret FALSE";
+	if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". path or WP's invalid, ret FALSE";
 	return false;
 }
 
@@ -2140,6 +2164,13 @@ bool AlienBAIState::explosiveEfficacy(
 
 			const BattleUnit* const targetUnit (tile->getTileUnit());
 
+			UnitFaction side;				// the side that the attacker fights for at heart; a
+			switch (attacker->getFaction())	// Mind-controlled xCom agent still counts as an aLien.
+			{
+				case FACTION_PLAYER: side = FACTION_PLAYER; break;
+				default:             side = FACTION_HOSTILE;
+			}
+
 			VoxelType voxelTest;
 
 			//Log(LOG_INFO) << "attacker = " << attacker->getId();
@@ -2168,9 +2199,8 @@ bool AlienBAIState::explosiveEfficacy(
 					//Log(LOG_INFO) << ". . exposed = " << ((*i)->getFaction() == FACTION_HOSTILE || (*i)->getExposed() < _unit->getIntelligence() + 1);
 					if (   (*i)->getUnitTile() != nullptr
 						&& (*i)->getUnitTile()->getDangerous() == false
-						&& ((*i)->getFaction() == FACTION_HOSTILE
-							|| (   (*i)->getExposed() != -1
-								&& (*i)->getExposed() <= _unit->getIntelligence())))
+						&& ((*i)->getFaction() == attacker->getFaction()
+							|| isKnown(*i) == true))
 					{
 						const Position
 							voxelPosA (Position::toVoxelSpaceCentered(pos, 12)),
@@ -2191,13 +2221,13 @@ bool AlienBAIState::explosiveEfficacy(
 							&& (*i)->getPosition() == Position::toTileSpace(trj.front()))
 						{
 							//Log(LOG_INFO) << "trajFront " << (trajectory.front() / Position(16,16,24));
-							if ((*i)->getFaction() != FACTION_HOSTILE)
+							if ((*i)->getFaction() != attacker->getFaction())
 								pct += 12;
 
-							if ((*i)->getOriginalFaction() == FACTION_HOSTILE)
+							if ((*i)->getOriginalFaction() == side)
 							{
 								pct -= 6;
-								if ((*i)->getFaction() == FACTION_HOSTILE)
+								if ((*i)->getFaction() == side)
 									pct -= 12;
 							}
 						}
@@ -2219,8 +2249,8 @@ bool AlienBAIState::explosiveEfficacy(
 bool AlienBAIState::psiAction() // private.
 {
 	if (_traceAI) {
-		Log(LOG_INFO) << "";
-		Log(LOG_INFO) << "AlienBAIState::psiAction() id-" << _unit->getId();
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::psiAction() id-" << _unit->getId();
 	}
 
 	if (_unit->getOriginalFaction() == FACTION_HOSTILE
@@ -2233,12 +2263,12 @@ bool AlienBAIState::psiAction() // private.
 		int tuCost (_unit->getActionTu(BA_PSIPANIC, itRule));
 		if (_tuEscape != -1)
 			tuCost += _tuEscape;
-		if (_traceAI) Log(LOG_INFO) << ". tuCost = " << tuCost;
+		if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". tuCost = " << tuCost;
 		if (_unit->getTu() >= tuCost)
 		{
 			const int attack (static_cast<int>(static_cast<float>(
 							 _unit->getBattleStats()->psiStrength * _unit->getBattleStats()->psiSkill) / 50.f));
-			if (_traceAI) Log(LOG_INFO) << ". . attack = " << attack;
+			if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . attack = " << attack;
 
 			BattleUnit* unitTarget (nullptr);
 			int
@@ -2301,7 +2331,7 @@ bool AlienBAIState::psiAction() // private.
 
 			if (unitTarget != nullptr && weight - los > PSI_CUTOFF)
 			{
-				if (_traceAI) Log(LOG_INFO) << ". . . target Valid - acceptable Prob.";
+				if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . target Valid - acceptable Prob.";
 //				if (_targetsVisible
 //					&& _attackAction->weapon
 //					&& _attackAction->weapon->getAmmoItem())
@@ -2345,13 +2375,13 @@ bool AlienBAIState::psiAction() // private.
 				_psiAction->type = BA_PSICONTROL;
 				return true;
 			}
-			else if (_traceAI) Log(LOG_INFO) << ". . . target NOT Valid or unacceptable Prob.";
+			else if (_traceAI) LogSub(LOGSUB_AI, LOG_INFO) << ". . . target NOT Valid or unacceptable Prob.";
 		}
 	}
 
 	if (_traceAI) {
-		Log(LOG_INFO) << "AlienBAIState::psiAction() EXIT, False";
-		Log(LOG_INFO) << "";
+		LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::psiAction() EXIT, False";
+		LogSub(LOGSUB_AI, LOG_INFO) << "";
 	}
 	return false;
 }
@@ -2368,12 +2398,22 @@ bool AlienBAIState::validTarget( // private.
 		bool dangerTile,
 		bool includeCivs) const
 {
-	if ((unit->getFaction() == FACTION_PLAYER				// target must not be on aLien side
-			|| (unit->getFaction() == FACTION_NEUTRAL
-				&& includeCivs == true))
+	bool foe;
+	switch (_unit->getFaction())
+	{
+		case FACTION_PLAYER:								// the bench plays xCom by this AI: target must be on aLien side
+			foe = unit->getFaction() == FACTION_HOSTILE;
+			break;
+
+		default:											// target must not be on aLien side
+			foe = unit->getFaction() == FACTION_PLAYER
+			   || (unit->getFaction() == FACTION_NEUTRAL
+					&& includeCivs == true);
+	}
+
+	if (foe == true
 		&& unit->isOut_t(OUT_STAT) == false					// ignore targets that are dead/unconscious
-		&& unit->getExposed() != -1
-		&& unit->getExposed() <= _unit->getIntelligence()	// target must be a unit that this aLien 'knows about'
+		&& isKnown(unit) == true							// target must be a unit that this aLien 'knows about'
 		&& (dangerTile == false
 			|| unit->getUnitTile()->getDangerous() == false
 			|| RNG::generate(0, _aggression) != 0))			// target has not been grenaded
@@ -2384,6 +2424,22 @@ bool AlienBAIState::validTarget( // private.
 	return false;
 }
 
+/**
+ * Checks if a BattleUnit is known to the side of this AI.
+ * @note The aLiens know a unit by its exposure. The xCom side - played by this
+ * AI only on the bench - knows a unit that it currently sees.
+ * @param unit - pointer to a BattleUnit
+ * @return, true if known
+ */
+bool AlienBAIState::isKnown(const BattleUnit* const unit) const // private.
+{
+	if (_unit->getFaction() == FACTION_PLAYER)
+		return unit->getUnitVisible();
+
+	return unit->getExposed() != -1
+		&& unit->getExposed() <= _unit->getIntelligence();
+}
+
 /**
  * aLien has a dichotomy on its hands: has a ranged weapon as well as melee
  * ability ... so make a determination on which to use this round.
@@ -2460,14 +2516,14 @@ BattleActionType AlienBAIState::getReservedAiAction() const
  *
 void AlienBAIState::enter()
 {
-	Log(LOG_INFO) << "AlienBAIState::enter() ROOOAARR !";
+	LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::enter() ROOOAARR !";
 } */
 /**
  * Exits the current AI state.
  *
 void AlienBAIState::exit()
 {
-	Log(LOG_INFO) << "AlienBAIState::exit()";
+	LogSub(LOGSUB_AI, LOG_INFO) << "AlienBAIState::exit()";
 } */
 /**
  * Gets the currently targeted unit.
@@ -2532,9 +2588,14 @@ bool AlienBAIState::getNodeOfBestEfficacy(BattleAction* action)
 																	&targetVoxel,
 																	*j))
 					{
-						if ((*j)->getFaction() != FACTION_HOSTILE)
+						if ((*j)->getFaction() != _unit->getFaction())
 						{
-							if ((*j)->getExposed() <= _unit->getIntelligence())
+							if (_unit->getFaction() == FACTION_PLAYER) // the bench plays xCom by this AI.
+							{
+								if (isKnown(*j) == true)
+									++nodePoints;
+							}
+							else if ((*j)->getExposed() <= _unit->getIntelligence())
 								++nodePoints;
 						}
 						else
@@ -123,6 +123,8 @@ private:
 			const BattleUnit* const unit,
 			bool dangerTile = false,
 			bool includeCivs = false) const;
+	/// Checks if a BattleUnit is known to the side of this AI.
+	bool isKnown(const BattleUnit* const unit) const;
 
 	/// Chooses between a melee or ranged attack if both are available.
 	void chooseMeleeOrRanged();
@@ -0,0 +1,377 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BattleBench.h"
+
+#include <iomanip>		// std::setprecision
+#include <iostream>		// std::cout
+#include <sstream>		// std::ostringstream
+
+#include "BattlescapeGenerator.h"
+#include "BattlescapeState.h"
+
+#include "../Engine/Exception.h"
+#include "../Engine/Game.h"
+#include "../Engine/Logger.h"
+#include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
+#include "../Engine/RNG.h"
+
+#include "../Geoscape/GeoscapeState.h"
+
+#include "../Ruleset/RuleCraft.h"
+#include "../Ruleset/RuleGlobe.h"
+#include "../Ruleset/RuleItem.h"
+#include "../Ruleset/Ruleset.h"
+
+#include "../Savegame/Base.h"
+#include "../Savegame/BattleUnit.h"
+#include "../Savegame/Craft.h"
+#include "../Savegame/ItemContainer.h"
+#include "../Savegame/SavedBattleGame.h"
+#include "../Savegame/SavedGame.h"
+#include "../Savegame/Soldier.h"
+#include "../Savegame/SoldierLayout.h"
+#include "../Savegame/Ufo.h"
+
+
+namespace OpenXcom
+{
+
+bool BattleBench::_active (false);		// static/private.
+int										// static/private.
+	BattleBench::_turnFirst (0),
+	BattleBench::_turns     (0);
+uint64_t BattleBench::_seed (0uLL);		// static/private.
+
+std::chrono::steady_clock::time_point BattleBench::_start; // static/private.
+
+
+/**
+ * Loads or generates the tactical and starts the bench.
+ * @note The save-file is 'Options::benchBattle' relative to the user-folder.
+ * If 'Options::benchSeed' is not zero it replaces the RNG-seed of the save;
+ * the seed is applied after all loading is done so that loading can't shift
+ * the RNG. If 'Options::benchGenerate' is set the tactical is generated from
+ * 'Options::benchSeed' instead.
+ * @param game - pointer to the Game
+ * @return, true if the tactical is ready
+ */
+bool BattleBench::start(Game* const game) // static.
+{
+	SavedBattleGame* battleSave;
+	if (Options::benchGenerate == true)
+	{
+		RNG::setSeed(Options::benchSeed);
+		_seed = RNG::getSeed();
+
+		if ((battleSave = generateBattle(game)) == nullptr)
+			return false;
+
+		game->setState(new GeoscapeState());
+	}
+	else
+	{
+		if ((battleSave = loadBattle(game)) == nullptr)
+			return false;
+
+		game->setState(new GeoscapeState());
+		battleSave->loadMapResources(game);
+
+		if (Options::benchSeed != 0uLL)
+			RNG::setSeed(Options::benchSeed);
+		_seed = RNG::getSeed();
+	}
+
+	_turnFirst = battleSave->getTurn();
+	if ((_turns = Options::benchTurns) < 1)
+		_turns = TURNS_DEFAULT;
+
+	Profiler::reset();
+	Profiler::enable();
+	_start = std::chrono::steady_clock::now();
+	_active = true;
+
+	BattlescapeState* const battleState (new BattlescapeState());
+	game->pushState(battleState);
+	battleSave->setBattleState(battleState);
+
+	Log(LOG_INFO) << "BattleBench: seed " << _seed << " turns " << _turns;
+	return true;
+}
+
+/**
+ * Loads the tactical of a save.
+ * @param game - pointer to the Game
+ * @return, pointer to the SavedBattleGame or nullptr if the save has none
+ */
+SavedBattleGame* BattleBench::loadBattle(Game* const game) // static/private.
+{
+	Log(LOG_INFO) << "BattleBench: loading " << Options::benchBattle;
+
+	Options::reSeedOnLoad = false;
+
+	SavedGame* const playSave (new SavedGame(game->getRuleset()));
+	game->setSavedGame(playSave);
+	try
+	{
+		playSave->load(Options::benchBattle, game->getRuleset());
+	}
+	catch (Exception& e)
+	{
+		Log(LOG_ERROR) << "BattleBench: " << e.what();
+		return nullptr;
+	}
+	catch (YAML::Exception& e)
+	{
+		Log(LOG_ERROR) << "BattleBench: " << e.what();
+		return nullptr;
+	}
+
+	SavedBattleGame* const battleSave (playSave->getBattleSave());
+	if (battleSave == nullptr)
+		Log(LOG_ERROR) << "BattleBench: " << Options::benchBattle << " has no tactical";
+
+	return battleSave;
+}
+
+/**
+ * Generates a tactical from the RNG-seed.
+ * @note The craft is always the first craft of the start-Base that carries
+ * soldiers and the mission is always a landed UFO; the UFO-type, terrain and
+ * aLien race are picked by the seed. The RNG must be seeded before this runs.
+ * @param game - pointer to the Game
+ * @return, pointer to the SavedBattleGame or nullptr if the ruleset lacks a
+ *			piece of the battle
+ */
+SavedBattleGame* BattleBench::generateBattle(Game* const game) // static/private.
+{
+	Log(LOG_INFO) << "BattleBench: generating from seed " << _seed;
+
+	const Ruleset* const rules (game->getRuleset());
+
+	SavedGame* const playSave (rules->createSave(game, _seed));
+	Base* const base (playSave->getBases()->front());
+
+	Craft* craft (nullptr);
+	for (std::vector<Craft*>::const_iterator
+			i  = base->getCrafts()->begin();
+			i != base->getCrafts()->end();
+			++i)
+	{
+		if ((*i)->getRules()->getSoldierCapacity() != 0)
+		{
+			craft = *i;
+			break;
+		}
+	}
+
+	std::vector<std::string> ufoTypes;
+	for (std::vector<std::string>::const_iterator
+			i  = rules->getUfosList().begin();
+			i != rules->getUfosList().end();
+			++i)
+	{
+		if (rules->getDeployment(*i) != nullptr)
+			ufoTypes.push_back(*i);
+	}
+
+	const std::vector<std::string> terrains (rules->getGlobe()->getGlobeTerrains());
+	const std::vector<std::string>& races (rules->getAlienRacesList());
+
+	if (craft == nullptr
+		|| ufoTypes.empty() == true
+		|| terrains.empty() == true
+		|| races.empty() == true)
+	{
+		Log(LOG_ERROR) << "BattleBench: the ruleset has no soldier-craft, UFO-deployment, terrain or aLien race";
+		return nullptr;
+	}
+
+	const std::string& ufoType (ufoTypes[RNG::pick(ufoTypes.size())]);
+	const std::string& terrain (terrains[RNG::pick(terrains.size())]);
+	const std::string& race    (races   [RNG::pick(races.size())]);
+	Log(LOG_INFO) << "BattleBench: " << ufoType << " on " << terrain << " by " << race;
+
+	armSoldiers(rules, base, craft);
+
+	SavedBattleGame* const battleSave (new SavedBattleGame(
+														playSave,
+														nullptr,
+														rules));
+	playSave->setBattleSave(battleSave);
+	battleSave->setTacticalType("STR_UFO_GROUND_ASSAULT");
+
+	BattlescapeGenerator bGen = BattlescapeGenerator(game);
+	bGen.setTerrain(rules->getTerrain(terrain));
+
+	craft->setSpeed();
+	bGen.setCraft(craft);
+
+	Ufo* const ufo (new Ufo(
+						rules->getUfo(ufoType),
+						playSave));
+	ufo->setQuickBattle();
+	ufo->setId(1);
+	ufo->setUfoStatus(Ufo::LANDED);
+	craft->setTarget(ufo);
+	bGen.setUfo(ufo);
+	playSave->getUfos()->push_back(ufo);
+
+	bGen.setShade(0);
+	bGen.setAlienRace(race);
+	bGen.setAlienItemlevel(0);
+	bGen.stage();
+
+	return battleSave;
+}
+
+/**
+ * Gives each soldier a firearm and loads them into a Craft.
+ * @note A new soldier has no SoldierLayout so BattlescapeGenerator would leave
+ * the Craft's items on the ground. Each soldier gets the first firearm in the
+ * ruleset's item-order of which the Base still stocks a weapon and a clip;
+ * Soldier::setCraft() then moves the layout's items from the stores to the
+ * Craft.
+ * @param rules	- pointer to the Ruleset
+ * @param base	- pointer to the start-Base
+ * @param craft	- pointer to the Craft to board
+ */
+void BattleBench::armSoldiers( // static/private.
+		const Ruleset* const rules,
+		Base* const base,
+		Craft* const craft)
+{
+	const ItemContainer* const stores (base->getStorageItems());
+
+	const RuleItem* itRule;
+	std::string clip;
+	bool armed;
+
+	for (std::vector<Soldier*>::const_iterator
+			i  = base->getSoldiers()->begin();
+			i != base->getSoldiers()->end() && craft->getSpaceAvailable() != 0;
+			++i)
+	{
+		armed = false;
+		for (std::vector<std::string>::const_iterator
+				j  = rules->getItemsList().begin();
+				j != rules->getItemsList().end() && armed == false;
+				++j)
+		{
+			itRule = rules->getItemRule(*j);
+			if (itRule->getBattleType() == BT_FIREARM
+				&& itRule->isFixed() == false
+				&& stores->getItemQuantity(*j) != 0)
+			{
+				clip.clear();
+				armed = itRule->getClipTypes()->empty() == true;
+				for (std::vector<std::string>::const_iterator
+						k  = itRule->getClipTypes()->begin();
+						k != itRule->getClipTypes()->end() && armed == false;
+						++k)
+				{
+					if (stores->getItemQuantity(*k) != 0)
+					{
+						clip = *k;
+						armed = true;
+					}
+				}
+
+				if (armed == true)
+					(*i)->getLayout()->push_back(new SoldierLayout(
+																*j,
+																"STR_RIGHT_HAND",
+																0,0,
+																clip,
+																-1));
+			}
+		}
+		(*i)->setCraft(craft, base);
+	}
+}
+
+/**
+ * Checks if the bench has played its quantity of turns.
+ * @param battleSave - pointer to the SavedBattleGame
+ * @return, true if the bench should end
+ */
+bool BattleBench::isTurnCapped(const SavedBattleGame* const battleSave) // static.
+{
+	return (battleSave->getTurn() - _turnFirst >= _turns);
+}
+
+/**
+ * Reports the outcome and timings and quits the Game.
+ * @note The outcome - turns played, units standing per faction, and the state
+ * of the RNG - is what a regression-test should compare between builds; the
+ * timings are what a benchmark should compare.
+ * @param game			- pointer to the Game
+ * @param battleSave	- pointer to the SavedBattleGame
+ * @param aborted		- true if the battle ended before either side was defeated
+ */
+void BattleBench::finish( // static.
+		Game* const game,
+		const SavedBattleGame* const battleSave,
+		bool aborted)
+{
+	const double wall (std::chrono::duration<double, std::milli>(
+					   std::chrono::steady_clock::now() - _start).count());
+	Profiler::enable(false);
+	_active = false;
+
+	int
+		standing[3u] {0,0,0},
+		down[3u]     {0,0,0};
+	for (std::vector<BattleUnit*>::const_iterator
+			i  = battleSave->getUnits()->begin();
+			i != battleSave->getUnits()->end();
+			++i)
+	{
+		if ((*i)->getOriginalFaction() != FACTION_NONE)
+		{
+			const size_t faction (static_cast<size_t>((*i)->getOriginalFaction()));
+			if ((*i)->isOut_t(OUT_STAT) == false)
+				++standing[faction];
+			else
+				++down[faction];
+		}
+	}
+
+	std::ostringstream oststr;
+	oststr << "bench "		<< (Options::benchGenerate == true ? "generated" : Options::benchBattle) << "\n"
+		   << "seed "		<< _seed << "\n"
+		   << "result "		<< (aborted == true ? "aborted" : "decided") << "\n"
+		   << "turns "		<< (battleSave->getTurn() - _turnFirst) << "\n"
+		   << "xcom "		<< standing[FACTION_PLAYER]  << " standing " << down[FACTION_PLAYER]  << " down\n"
+		   << "aliens "		<< standing[FACTION_HOSTILE] << " standing " << down[FACTION_HOSTILE] << " down\n"
+		   << "civilians "	<< standing[FACTION_NEUTRAL] << " standing " << down[FACTION_NEUTRAL] << " down\n"
+		   << "rng "		<< RNG::getSeed() << "\n"
+		   << std::fixed << std::setprecision(3)
+		   << "wall "		<< wall << " ms\n"
+		   << Profiler::report();
+
+	Log(LOG_INFO) << "BattleBench:\n" << oststr.str();
+	std::cout << oststr.str();
+	std::cout.flush();
+
+	game->quit(true);
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_BATTLEBENCH_H
+#define OPENXCOM_BATTLEBENCH_H
+
+#include <chrono>		// std::chrono
+#include <cstdint>		// uint64_t
+
+
+namespace OpenXcom
+{
+
+class Base;
+class Craft;
+class Game;
+class Ruleset;
+class SavedBattleGame;
+
+
+/**
+ * Plays a tactical to its end without display or sound and reports the time
+ * spent in each ProfileZone.
+ * @note Started by the "-bench FILE" command-line option to play a saved
+ * tactical or by "-benchGenerate N" to generate one from RNG-seed N. Every
+ * faction is played by the AI; the xCom units go down the same AlienBAIState
+ * path that Mind-controlled units take. With the same save or seed the outcome
+ * is the same.
+ */
+class BattleBench
+{
+
+private:
+	static const int TURNS_DEFAULT = 30;
+
+	static bool _active;
+	static int
+		_turnFirst,
+		_turns;
+	static uint64_t _seed;
+
+	static std::chrono::steady_clock::time_point _start;
+
+	/// Loads the tactical of a save.
+	static SavedBattleGame* loadBattle(Game* const game);
+	/// Generates a tactical from the RNG-seed.
+	static SavedBattleGame* generateBattle(Game* const game);
+	/// Gives each soldier a firearm and loads them into a Craft.
+	static void armSoldiers(
+			const Ruleset* const rules,
+			Base* const base,
+			Craft* const craft);
+
+
+	public:
+		/// The quantity of think-cycles of the battle per engine-cycle.
+		static const int BURST = 64;
+
+		/// Loads or generates the tactical and starts the bench.
+		static bool start(Game* const game);
+		/// Checks if the bench is running.
+		static bool isActive()
+		{ return _active; }
+
+		/// Checks if the bench has played its quantity of turns.
+		static bool isTurnCapped(const SavedBattleGame* const battleSave);
+
+		/// Reports the outcome and timings and quits the Game.
+		static void finish(
+				Game* const game,
+				const SavedBattleGame* const battleSave,
+				bool aborted);
+};
+
+}
+
+#endif
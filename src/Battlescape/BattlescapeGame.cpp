@@ -23,6 +23,7 @@
 #include <sstream>
 
 #include "AlienBAIState.h"
+#include "BattleBench.h"
 #include "BattlescapeState.h"
 #include "BattleState.h"
 #include "Camera.h"
@@ -48,6 +49,7 @@
 #include "../Engine/Language.h"
 #include "../Engine/Logger.h"
 #include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
 #include "../Engine/RNG.h"
 #include "../Engine/Screen.h"
 #include "../Engine/Sound.h"
@@ -245,6 +247,18 @@ void BattlescapeGame::think()
 					{
 						//Log(LOG_INFO) << ". panic Handled is TRUE";
 						_battleState->updateExperienceInfo();
+
+						if (BattleBench::isActive() == true) // the bench plays xCom by the aLien AI as if Mind-controlled.
+						{
+							BattleUnit* selUnit (_battleSave->getSelectedUnit());
+							if (selUnit == nullptr) // the selected unit went down
+								selUnit = _battleSave->firstFactionUnit(FACTION_PLAYER);
+
+							if (selUnit != nullptr)
+								handleUnitAI(selUnit); // will select next xCom-unit when the current unit is done.
+							else
+								endAiTurn();
+						}
 					}
 					break;
 
@@ -287,15 +301,17 @@ void BattlescapeGame::think()
 /**
  * Gives a slice to the front BattleState and redraws the battlefield.
  * @note The period is controlled by '_timerTactical' in BattlescapeState.
+ * @param draw - false to skip the redraw (default true)
  */
-void BattlescapeGame::handleBattleState()
+void BattlescapeGame::handleBattleState(bool draw)
 {
 	if (_battleStates.empty() == false)
 	{
 		if (_battleStates.front() != nullptr)
 		{
 			_battleStates.front()->think();
-			getMap()->draw();		// old code!! Less clunky when scrolling the battlefield.
+			if (draw == true && Options::headless == false)
+				getMap()->draw();	// old code!! Less clunky when scrolling the battlefield.
 //			getMap()->invalidate();	// redraw map
 		}
 		else
@@ -406,6 +422,7 @@ void BattlescapeGame::popBattleState()
 		bool actionFail;
 		if (action.result.empty() == false // query the warning string message
 			&& (_battleSave->getSide() == FACTION_PLAYER || _debugPlay == true)
+			&& BattleBench::isActive() == false
 			&& action.actor != nullptr
 			&& action.actor->getFaction() == FACTION_PLAYER
 			&& _playerPanicHandled == true)
@@ -457,7 +474,11 @@ void BattlescapeGame::popBattleState()
 			&& noActionsPending(action.actor) == true)
 		{
 			//Log(LOG_INFO) << ". noActionsPending for state actor";
-			switch (action.actor->getFaction())
+			UnitFaction faction (action.actor->getFaction());
+			if (BattleBench::isActive() == true) // the bench plays xCom by the aLien AI.
+				faction = FACTION_HOSTILE;
+
+			switch (faction)
 			{
 				case FACTION_PLAYER:
 					//Log(LOG_INFO) << ". actor -> Faction_Player";
@@ -547,7 +568,8 @@ void BattlescapeGame::popBattleState()
 					//Log(LOG_INFO) << ". action -> NOT Faction_Player";
 					action.actor->expendTu(action.TU);
 
-					if (_battleSave->getSide() != FACTION_PLAYER && _debugPlay == false)
+					if ((_battleSave->getSide() != FACTION_PLAYER || BattleBench::isActive() == true)
+						&& _debugPlay == false)
 					{
 						BattleUnit* aiUnit (_battleSave->getSelectedUnit());
 						if (_AIActionCounter > 2	// AI does two think-cycles per unit before switching to the next
@@ -648,7 +670,8 @@ void BattlescapeGame::popBattleState()
 		{
 			//Log(LOG_INFO) << "PopState: rfShooter VALID - clear!";
 			getTileEngine()->isReaction() = false;
-			SDL_Delay(Screen::SCREEN_PAUSE);
+			if (Options::headless == false)
+				SDL_Delay(Screen::SCREEN_PAUSE);
 		}
 
 		if (_battleSave->rfTriggerOffset().z != -1)	// NOTE: Since non-vis reactors don't set isReaction() TRUE
@@ -755,6 +778,8 @@ void BattlescapeGame::resetTraceTiles() // private.
  */
 void BattlescapeGame::handleUnitAI(BattleUnit* const unit) // private.
 {
+	const ProfileScope scope (PZ_AI);
+
 	bool debug (false);
 	//if (unit->getId() == 1000006)	_debug = true;
 	//else							_debug = false;
@@ -1026,14 +1051,21 @@ void BattlescapeGame::selectNextAiUnit(const BattleUnit* const unit) // private.
 
 		if (_AISecondMove == false)
 		{
+			const std::vector<BattleUnit*>* units;	// Faction_Player turns cycle the regular '_units' vector;
+			switch (_battleSave->getSide())			// only the bench has the AI play those.
+			{
+				case FACTION_PLAYER: units = _battleSave->getUnits(); break;
+				default:             units = _battleSave->getShuffleUnits();
+			}
+
 			if (std::find(
-					_battleSave->getShuffleUnits()->begin(),
-					_battleSave->getShuffleUnits()->end(),
+					units->begin(),
+					units->end(),
 					nextUnit)
 						 -
 				std::find(
-					_battleSave->getShuffleUnits()->begin(),
-					_battleSave->getShuffleUnits()->end(),
+					units->begin(),
+					units->end(),
 					unit) < 1)
 			{
 				//Log(LOG_INFO) << "BATTLESCAPE::selectNextAiUnit() --- second Move ---";
@@ -1433,6 +1465,9 @@ void BattlescapeGame::endTurn() // private.
 	//Log(LOG_INFO) << "bg::endTurn()";
 	_debugPlay =
 	_AISecondMove = false;
+
+	if (BattleBench::isActive() == true) // the bench's xCom turns start w/ a unit already selected.
+		_AIActionCounter = 0;
 	_battleState->showLaunchButton(false);
 
 	_playerAction.targeting = false;
@@ -1613,6 +1648,11 @@ void BattlescapeGame::endTurn() // private.
 	{
 		_battleState->finishBattle(false, livePlayer);
 	}
+	else if (BattleBench::isActive() == true
+		&& BattleBench::isTurnCapped(_battleSave) == true)
+	{
+		_battleState->finishBattle(true, livePlayer);
+	}
 	else if (_battleSave->getTurnLimit() != 0
 		&&   _battleSave->getTurnLimit() < _battleSave->getTurn())
 	{
@@ -1680,7 +1720,8 @@ void BattlescapeGame::endTurn() // private.
 																	pacified));
 			}
 
-			if (_battleSave->getSide() == FACTION_PLAYER)
+			if (_battleSave->getSide() == FACTION_PLAYER
+				&& BattleBench::isActive() == false)
 			{
 //				const int turn (_battleSave->getTurn());
 //				std::string file ("tac_BEG_" + std::to_string(turn));
@@ -1691,7 +1732,7 @@ void BattlescapeGame::endTurn() // private.
 //				playSave->save(file + SavedGame::SAVE_ExtDot);
 
 				playSave->setLabel(SavedGame::SAVELABEL_TacTurnBeg);	// this Save is done auto at the start of Player's turn
-				playSave->save(SavedGame::SAVE_TacTurnBeg);				// vid SavedBattleGame::factionEndTurn() for end of Player's turn
+				playSave->saveAsync(SavedGame::SAVE_TacTurnBeg);			// vid SavedBattleGame::factionEndTurn() for end of Player's turn
 			}															// vid InventoryState::btnOkClick() for start of tactical
 		}
 	}
@@ -2209,7 +2250,10 @@ void BattlescapeGame::showInfoBoxQueue() // private.
 			i != _infoboxQueue.end();
 			++i)
 	{
-		_battleState->getGame()->pushState(*i);
+		if (BattleBench::isActive() == false)
+			_battleState->getGame()->pushState(*i);
+		else
+			delete *i; // no one to click them away
 	}
 	_infoboxQueue.clear();
 }
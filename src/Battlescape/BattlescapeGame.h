@@ -301,7 +301,7 @@ private:
 		void think();
 
 		/// Handles BattleStates per the tactical-timer.
-		void handleBattleState();
+		void handleBattleState(bool draw = true);
 		/// Pushes a BattleState to the front of the list.
 		void stateBPushFront(BattleState* const battleState);
 		/// Pushes a BattleState to second on the list.
@@ -19,7 +19,6 @@
 
 #include "BattlescapeGenerator.h"
 
-#include <fstream>
 //#include <sstream>
 //#include <assert.h>
 
@@ -45,6 +44,7 @@
 #include "../Ruleset/MapBlock.h"
 #include "../Ruleset/MapData.h"
 #include "../Ruleset/MapDataSet.h"
+#include "../Ruleset/MapFileCache.h"
 #include "../Ruleset/MCDPatch.h"
 #include "../Ruleset/RuleAlienDeployment.h"
 #include "../Ruleset/RuleAlienRace.h"
@@ -1828,7 +1828,7 @@ void BattlescapeGenerator::setTacticalSprites() const // private.
 		if ((_craft == nullptr || (*i)->getCraft() == _craft)
 			&& (*i)->getArmor()->isBasic() == true)
 		{
-			(*i)->setArmor(arRule);
+			base->equipArmor(*i, arRule);
 		}
 	}
 }
@@ -2366,22 +2366,16 @@ int BattlescapeGenerator::loadBlockFile( // private.
 	std::ostringstream file;
 	file << "MAPS/" << block->getType() << ".MAP";
 
-	std::ifstream ifstr (
-					CrossPlatform::getDataFile(file.str()).c_str(),
-					std::ios::in | std::ios::binary);
-	if (ifstr.fail() == true)
+	const MapFile* const mapFile (MapFileCache::getMap(block->getType()));
+	if (mapFile == nullptr)
 	{
 		throw Exception("bGen:loadBlockFile() " + file.str() + " not found.");
 	}
 
-	char xyz[3u];
-	ifstr.read(
-			reinterpret_cast<char*>(&xyz),
-			sizeof(xyz));
 	const int
-		size_x (static_cast<int>(xyz[1u])), // note X-Y switch!
-		size_y (static_cast<int>(xyz[0u])), // note X-Y switch!
-		size_z (static_cast<int>(xyz[2u]));
+		size_x (mapFile->size_x),
+		size_y (mapFile->size_y),
+		size_z (mapFile->size_z);
 
 	std::ostringstream oststr;
 	if (size_z > _battleSave->getMapSizeZ())
@@ -2428,14 +2422,16 @@ int BattlescapeGenerator::loadBlockFile( // private.
 	}
 
 	Tile* tile;
-	unsigned char parts[Tile::TILE_PARTS];
+	const unsigned char* parts;
 	size_t partId;
 
 	bool revealDone;
-	while (ifstr.read(
-					reinterpret_cast<char*>(&parts),
-					sizeof(parts)))
+	for (size_t
+			j  = 0u;
+			j != mapFile->parts.size();
+			j += Tile::TILE_PARTS)
 	{
+		parts = &mapFile->parts[j];
 		revealDone = false;
 
 		for (size_t
@@ -2515,13 +2511,6 @@ int BattlescapeGenerator::loadBlockFile( // private.
 		}
 	}
 
-	if (ifstr.eof() == false)
-	{
-		throw Exception("bGen:loadBlockFile() Invalid MAP file: " + file.str());
-	}
-
-	ifstr.close();
-
 	if ((_generateFuel = (block->getPlacedItems().empty() == true)) == false) // don't deploy fuel algorithmically if one of the MapBlocks has an items-array defined
 	{
 		const RuleItem* itRule;
@@ -2571,10 +2560,8 @@ void BattlescapeGenerator::loadRouteFile( // private.
 	std::ostringstream file;
 	file << "ROUTES/" << block->getType() << ".RMP";
 
-	std::ifstream ifstr (
-					CrossPlatform::getDataFile(file.str()).c_str(),
-					std::ios::in | std::ios::binary);
-	if (ifstr.fail() == true)
+	const std::vector<RouteRecord>* const routes (MapFileCache::getRoutes(block->getType()));
+	if (routes == nullptr)
 	{
 		throw Exception("bGen:loadRouteFile() " + file.str() + " not found");
 	}
@@ -2598,18 +2585,16 @@ void BattlescapeGenerator::loadRouteFile( // private.
 	Node* node;
 	Position pos;
 
-	char dataArray[24u]; // NOTE: These are signed values. I want unsigned values.
-	while (ifstr.read(
-					reinterpret_cast<char*>(&dataArray),
-					sizeof(dataArray)))
+	for (std::vector<RouteRecord>::const_iterator
+			i  = routes->begin();
+			i != routes->end();
+			++i)
 	{
 		//Log(LOG_INFO) << ". _nodeId= " << _nodeId;
 
-		pos_x = static_cast<int>(static_cast<unsigned char>(dataArray[1u])); // NOTE: Here is where x-y values get reversed
-		pos_y = static_cast<int>(static_cast<unsigned char>(dataArray[0u])); // vis-a-vis x/y values in the .RMP files vs. IG loaded values.
-		pos_z = static_cast<int>(static_cast<unsigned char>(dataArray[2u]));
-
-		// NOTE: 'dataArray[3u]' is not used.
+		pos_x = i->pos_x;
+		pos_y = i->pos_y;
+		pos_z = i->pos_z;
 
 		if (   pos_x < block->getSizeX()
 			&& pos_y < block->getSizeY()
@@ -2620,11 +2605,11 @@ void BattlescapeGenerator::loadRouteFile( // private.
 						offset_y + pos_y,
 						block->getSizeZ() - pos_z - 1); // NOTE: Invert the z-level.
 
-			unittype       = static_cast<int>(static_cast<unsigned char>(dataArray[19u])); // -> Any=0; Flying=1; Small=2; FlyingLarge=3; Large=4
-			noderank       = static_cast<int>(static_cast<unsigned char>(dataArray[20u]));
-			patrolpriority = static_cast<int>(static_cast<unsigned char>(dataArray[21u]));
-			attackfacility = static_cast<int>(static_cast<unsigned char>(dataArray[22u]));
-			spawnweight    = static_cast<int>(static_cast<unsigned char>(dataArray[23u]));
+			unittype       = i->unitType; // -> Any=0; Flying=1; Small=2; FlyingLarge=3; Large=4
+			noderank       = i->rank;
+			patrolpriority = i->patrol;
+			attackfacility = i->attack;
+			spawnweight    = i->spawn;
 
 			// TYPE_SMALLFLYING = 0x01 -> ref Savegame/Node.h
 			// TYPE_SMALL       = 0x02
@@ -2652,8 +2637,7 @@ void BattlescapeGenerator::loadRouteFile( // private.
 					j != Node::NODE_LINKS; // Max links that a node can have.
 					++j)
 			{
-				linkId = static_cast<int>(static_cast<unsigned char>(dataArray[j * 3u + 4u]));	// <- 4[5,6],7[8,9],10[11,12],13[14,15],16[17,18]
-																								// -> [distance & unitType of linked nodes are not used]
+				linkId = i->links[j];
 				//Log(LOG_INFO) << ". #" << j << " linkId[0]= " << linkId;
 
 				if (linkId < 251) // do not offset special values; ie. links to N,S,E,W, and None.
@@ -2692,12 +2676,6 @@ void BattlescapeGenerator::loadRouteFile( // private.
 
 		++_nodeId;
 	}
-
-	if (ifstr.eof() == false)
-	{
-		throw Exception("bGen:loadRouteFile() Invalid RMP file: " + file.str());
-	}
-	ifstr.close();
 }
 
 /**
@@ -2986,6 +2964,16 @@ void BattlescapeGenerator::generateMap(const std::vector<RuleMapScript*>* const
 
 	init(); // setup generation vars
 
+	std::vector<std::string> blockTypes; // read the MapBlocks that the script can pick from in parallel
+	for (std::vector<MapBlock*>::const_iterator
+			i  = _terrainRule->getMapBlocks()->begin();
+			i != _terrainRule->getMapBlocks()->end();
+			++i)
+	{
+		blockTypes.push_back((*i)->getType());
+	}
+	MapFileCache::prefetch(blockTypes);
+
 	MapBlock* craftBlock (nullptr);
 	std::vector<MapBlock*> ufoBlocks;
 
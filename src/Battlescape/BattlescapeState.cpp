@@ -31,6 +31,7 @@
 
 #include "AbortMissionState.h"
 #include "ActionMenuState.h"
+#include "BattleBench.h"
 #include "BattlescapeGame.h"
 #include "BattlescapeGenerator.h"
 #include "BriefingState.h"
@@ -1133,6 +1134,34 @@ void BattlescapeState::think()
 			_timerTactical->think(this, nullptr);
 			//Log(LOG_INFO) << "BattlescapeState::think() -> back from thinks";
 
+			if (BattleBench::isActive() == true) // play the battle flat-out instead of by the timers
+			{
+				for (int
+						i = 0;
+						i != BattleBench::BURST
+							&& _game->isState(this) == true
+							&& _game->isQuitting() == false;
+						++i)
+				{
+					_battle->think();
+					_battle->handleBattleState();
+				}
+			}
+			else if (Options::battleFastAlienTurn == true // resolve what the player can't see flat-out instead of by the timers
+				&& _battleSave->getSide() != FACTION_PLAYER)
+			{
+				const Uint32 start (SDL_GetTicks());
+				while (_game->isState(this) == true
+					&& _game->isQuitting() == false
+					&& _battleSave->getSide() != FACTION_PLAYER
+					&& _map->isActionHidden() == true
+					&& SDL_GetTicks() - start < HIDDEN_BURST)
+				{
+					_battle->think();
+					_battle->handleBattleState(false);
+				}
+			}
+
 			if (popped == true)
 			{
 				popped = false;
@@ -3788,6 +3817,12 @@ void BattlescapeState::finishBattle(
 		bool aborted,
 		int playerUnits)
 {
+	if (BattleBench::isActive() == true)
+	{
+		BattleBench::finish(_game, _battleSave, aborted);
+		return;
+	}
+
 	while (_game->isState(this) == false)
 		_game->popState();
 
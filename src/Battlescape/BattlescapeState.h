@@ -69,6 +69,8 @@ private:
 		PHASE_TARGET  =  6u,
 		PHASE_FUSE    = 22u;
 
+	static const Uint32 HIDDEN_BURST = 30u; // max ms per engine-cycle to resolve hidden aLien actions
+
 	static const Uint8
 		TRANSP   =   0u,
 		WHITE    =   2u,
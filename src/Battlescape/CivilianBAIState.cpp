@@ -19,6 +19,8 @@
 
 #include "CivilianBAIState.h"
 
+#include "../Savegame/UnitTable.h"
+
 
 namespace OpenXcom
 {
@@ -203,6 +205,8 @@ void CivilianBAIState::setupEscape() // private.
 	std::vector<Position> tileSearch (_battleSave->getTileSearch());
 	RNG::shuffle(tileSearch.begin(), tileSearch.end());
 
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+
 //	const int tuHalf (_unit->getTu() >> 1u);
 //	_reachable = _pf->findReachable(_unit, tuHalf); // done in BattlescapeGame::handleUnitAi().
 
@@ -437,6 +441,7 @@ int CivilianBAIState::selectHostile() // private.
 
 /**
  * Counts how many aLiens spot the civilian.
+ * @note The units are tested from the rows of the UnitTable.
  * @param pos - reference to a Position to check
  * @return, qty of spotters
  */
@@ -453,21 +458,23 @@ int CivilianBAIState::tallySpotters(const Position& pos) const // private.
 	else
 		hypoUnit = nullptr;
 
-	for (std::vector<BattleUnit*>::const_iterator
-			i = _battleSave->getUnits()->begin();
-			i != _battleSave->getUnits()->end();
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+	const std::vector<UnitTable::Row>& rows (_battleSave->getUnitTable()->getRows());
+	for (std::vector<UnitTable::Row>::const_iterator
+			i  = rows.begin();
+			i != rows.end();
 			++i)
 	{
-		if ((*i)->getFaction() == FACTION_HOSTILE // Could exclude MC'd xCom ...
-			&& (*i)->isOut_t(OUT_STAT) == false
-			&& TileEngine::distSqr(pos, (*i)->getPosition()) <= TileEngine::SIGHTDIST_TSp_Sqr) // Could use checkViewSector() and/or visible()
+		if (i->faction == FACTION_HOSTILE // Could exclude MC'd xCom ...
+			&& UnitTable::isOut(*i) == false
+			&& TileEngine::distSqr(pos, i->pos) <= TileEngine::SIGHTDIST_TSp_Sqr) // Could use checkViewSector() and/or visible()
 		{
-			originVoxel = _te->getSightOriginVoxel(*i);
+			originVoxel = _te->getSightOriginVoxel(i->unit);
 			if (_te->doTargetUnit(
 							&originVoxel,
 							_battleSave->getTile(pos),
 							&targetVoxel,
-							*i,
+							i->unit,
 							hypoUnit) == true)
 			{
 				++ret;
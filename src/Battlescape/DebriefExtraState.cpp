@@ -606,7 +606,7 @@ void DebriefExtraState::btnOkClick(Action*)
 						transfer->setTransferItems(
 											_typesBuy[i],
 											_qtysBuy[i]);
-						_base->getTransfers()->push_back(transfer);
+						_base->addTransfer(transfer);
 					}
 				}
 			}
@@ -745,16 +745,7 @@ void DebriefExtraState::styleList( // private.
 				++j)
 		{
 			if ((*j)->getRules()->getSoldierCapacity() != 0)			// is transport-craft
-			{
-				for (std::map<std::string, int>::const_iterator
-						k = (*j)->getCraftItems()->getContents()->begin();
-						k != (*j)->getCraftItems()->getContents()->end();
-						++k)
-				{
-					if (k->first == type)
-						baseQty += k->second;
-				}
-			}
+				baseQty += (*j)->getCraftItems()->getItemQuantity(type);
 
 			if ((*j)->getRules()->getVehicleCapacity() != 0)			// is transport-craft capable of vehicles
 			{
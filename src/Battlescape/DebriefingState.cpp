@@ -422,7 +422,7 @@ DebriefingState::DebriefingState()
 							_tactical->injuryList[sol->getId()] = tacstats->daysWounded;
 
 						sol->getDiary()->postTactical(tacstats, _tactical);
-						if (sol->getDiary()->updateAwards(_rules, tacticals) == true)
+						if (sol->getDiary()->updateAwards(_rules) == true)
 							_soldiersFeted.push_back(sol);
 						break;
 
@@ -456,7 +456,7 @@ DebriefingState::DebriefingState()
 							_tactical->injuryList[solDead->getId()] = -2; // mia
 
 						solDead->getDiary()->postTactical(tacstats, _tactical);
-						solDead->getDiary()->updateAwards(_rules, tacticals);
+						solDead->getDiary()->updateAwards(_rules);
 						_soldiersLost.push_back(solDead);
 				}
 			}
@@ -1176,8 +1176,7 @@ void DebriefingState::prepareDebriefing() // private.
 								if (*j == sol) // NOTE: Could return any armor the Soldier was wearing to Stores. CHEATER!!!!!
 								{
 									(*j)->die(_playSave);
-									delete *j;
-									_base->getSoldiers()->erase(j);
+									_base->removeSoldier(j, true);
 									break;
 								}
 							}
@@ -1304,8 +1303,7 @@ void DebriefingState::prepareDebriefing() // private.
 									if (*j == sol) // NOTE: Could return any armor the Soldier was wearing to Stores. CHEATER!!!!!
 									{
 										(*j)->die(_playSave);
-										delete *j;
-										_base->getSoldiers()->erase(j);
+										_base->removeSoldier(j, true);
 										break;
 									}
 								}
@@ -19,10 +19,14 @@
 
 #include "Explosion.h"
 
+#include "../Engine/ObjectPool.h"
+
 
 namespace OpenXcom
 {
 
+ObjectPool Explosion::_pool (sizeof(Explosion), 64u); // static/private.
+
 /**
  * Sets up an Explosion sprite to animate at a specified position.
  * @param type			- the ExplosionType (Explosion.h)
@@ -49,6 +53,28 @@ Explosion::Explosion(
 Explosion::~Explosion()
 {}
 
+/**
+ * Gets memory for an Explosion from its ObjectPool.
+ * @param size - size of the object
+ * @return, pointer to the memory
+ */
+void* Explosion::operator new(size_t size) // static.
+{
+	return _pool.allocate(size);
+}
+
+/**
+ * Returns the memory of an Explosion to its ObjectPool.
+ * @param block	- pointer to the memory
+ * @param size	- size of the object
+ */
+void Explosion::operator delete( // static.
+		void* block,
+		size_t size)
+{
+	_pool.release(block, size);
+}
+
 /**
  * Steps the Explosion forward frame-by-frame.
  * @note These animations are played by Map::drawTerrain() at the end of that
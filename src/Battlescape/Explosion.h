@@ -26,6 +26,8 @@
 namespace OpenXcom
 {
 
+class ObjectPool;
+
 enum ExplosionType
 {
 	ET_AOE,			// 0
@@ -46,6 +48,8 @@ class Explosion
 {
 
 private:
+	static ObjectPool _pool;
+
 	static const int
 		FRAMES_AOE			=  8,
 		FRAMES_BULLET		= 10,
@@ -72,6 +76,13 @@ private:
 		/// Cleans up the Explosion.
 		~Explosion();
 
+		/// Gets memory for an Explosion from its ObjectPool.
+		static void* operator new(size_t size);
+		/// Returns the memory of an Explosion to its ObjectPool.
+		static void operator delete(
+				void* block,
+				size_t size);
+
 		/// Steps the Explosion forward.
 		bool animate();
 
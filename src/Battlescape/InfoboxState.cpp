@@ -21,6 +21,7 @@
 
 #include "../Engine/Action.h"
 #include "../Engine/Game.h"
+#include "../Engine/Options.h"
 #include "../Engine/Timer.h"
 
 #include "../Interface/Frame.h"
@@ -91,10 +92,14 @@ void InfoboxState::handle(Action* action)
 
 /**
  * Exits this InfoboxState on a single timer-tick.
+ * @note Exits at once if there's no display.
  */
 void InfoboxState::think()
 {
-	_timer->think(this, nullptr);
+	if (Options::headless == false)
+		_timer->think(this, nullptr);
+	else
+		exit();
 }
 
 /**
@@ -730,7 +730,7 @@ void InventoryState::btnOkClick(Action*)
 
 			SavedGame* const playSave (_battleSave->getSavedGame());
 			playSave->setLabel(SavedGame::SAVELABEL_TacMission);	// this Save is done auto at the start of tactical
-			playSave->save(SavedGame::SAVE_TacMission);				// vid BattlescapeGame::endTurn() for start of Player turn
+			playSave->saveAsync(SavedGame::SAVE_TacMission);				// vid BattlescapeGame::endTurn() for start of Player turn
 		}															// vid SavedBattleGame::factionEndTurn() for end of Player's turn
 	}
 }
@@ -19,6 +19,8 @@
 
 #include "Map.h"
 
+#include <algorithm>	// std::fill, std::find, std::min, std::max
+#include <cstring>		// std::memcpy, std::memmove, std::memset
 //#include <fstream>
 
 #include "../fmath.h"
@@ -36,11 +38,13 @@
 #include "../Engine/Action.h"
 #include "../Engine/Game.h"
 #include "../Engine/Language.h"
-//#include "../Engine/Logger.h"
+#include "../Engine/Logger.h"
 #include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
 #include "../Engine/Screen.h"
 #include "../Engine/SurfaceSet.h"
 #include "../Engine/Timer.h"
+#include "../Engine/WorkerPool.h"
 
 #include "../Interface/NumberText.h"
 #include "../Interface/Text.h"
@@ -124,6 +128,17 @@ Map::Map(
 		_battle(nullptr), // is Set in BattlescapeGame cTor.
 		_res(game->getResourcePack()),
 		_fuseColor(31u),
+		_aniUnitsTally(0u),
+		_cacheValid(false),
+		_recording(false),
+		_drawBands(0u),
+		_drawTarget(nullptr),
+		_srfCheck(nullptr),
+		_cacheChunksX(0),
+		_cacheChunksY(0),
+		_cacheKey(0uLL),
+		_srfCache(nullptr),
+		_unitSprite(nullptr),
 		_tile(nullptr),
 		_unit(nullptr)
 {
@@ -198,6 +213,11 @@ Map::~Map()
 	delete _numExposed;
 	delete _numWaypoint;
 	delete _srfFuse;
+	delete _srfCache;
+	delete _srfCheck;
+	delete _unitSprite;
+
+	clearUnitFrames();
 }
 
 /**
@@ -316,6 +336,8 @@ void Map::think()
 void Map::draw()
 {
 	//Log(LOG_INFO) << "Map::draw()";
+	const ProfileScope scope (PZ_MAP);
+
 	if (_noDraw == false) // don't draw if MiniMap is open. Or if Inventory is open.
 	{
 	// removed setting this here and in BattlescapeGame::handleBattleState(),
@@ -340,10 +362,10 @@ void Map::draw()
 				_flashScreen = false;
 			}
 
+			_cacheValid = false;
 			clear(SCREEN_WHITE);
 			return;
 		}
-		clear(SCREEN_BLACK);
 
 //		const Tile* tile;
 		if (_projectile != nullptr) //&& _battleSave->getSide() == FACTION_PLAYER)
@@ -387,14 +409,7 @@ void Map::draw()
 
 //		static int debug (1);
 
-		if (   _battleSave->getSelectedUnit() == nullptr
-			|| _battleSave->getSelectedUnit()->getUnitVisible() == true
-			|| _unitDying == true
-			|| _explosionInFOV == true
-			|| _projectileInFOV == true
-			|| _reveal == true // stop flashing the Hidden Movement screen between waypoints and/or autoshots.
-			|| _te->isReaction() == true
-			|| _battleSave->getDebugTac() == true)
+		if (isActionHidden() == false)
 		{
 			// REVEAL //
 //			if (debug == 1)
@@ -412,7 +427,7 @@ void Map::draw()
 
 			delayHide = true;
 			_mapIsHidden = false;
-			drawTerrain(this);
+			drawTerrainCached();
 		}
 		else
 		{
@@ -437,6 +452,8 @@ void Map::draw()
 			}
 
 			_mapIsHidden = true;
+			_cacheValid = false;
+			clear(SCREEN_BLACK);
 			_hiddenScreen->blit(this);
 		}
 	}
@@ -678,9 +695,13 @@ void Map::drawUnit(
  * Draws the battlefield.
  * @note Keep this function as optimized as possible - it's big and needs to be
  * fast so minimize overhead of function calls. Etc.
- * @param surface - the Surface on which to draw the entire battlefield
+ * @param surface	- the Surface on which to draw the entire battlefield
+ * @param dirtyOnly	- true to skip tiles that can't draw on a dirty screen-chunk
+ *					  (default false)
  */
-void Map::drawTerrain(Surface* const surface) // private.
+void Map::drawTerrain( // private.
+		Surface* const surface,
+		bool dirtyOnly)
 {
 	//Log(LOG_INFO) << "Map::drawTerrain() " << _camera->getMapOffset();
 	Position bullet; // x-y position of bullet on screen.
@@ -839,44 +860,15 @@ void Map::drawTerrain(Surface* const surface) // private.
 		beginZ (0),
 		endX,
 		endY,
-		endZ,
-		d;
-
-	_camera->convertScreenToMap(
-							0,
-							0,
-							&beginX,
-							&d);
-	_camera->convertScreenToMap(
-							surface->getWidth(),
-							0,
-							&d,
-							&beginY);
-	_camera->convertScreenToMap(
-							surface->getWidth()  + _spriteWidth,
-							surface->getHeight() + _spriteHeight,
-							&endX,
-							&d);
-	_camera->convertScreenToMap(
-							0,
-							surface->getHeight() + _spriteHeight,
-							&d,
-							&endY);
-
-	if (_camera->getShowLayers() == true)
-	{
-		endZ = _battleSave->getMapSizeZ() - 1;
-		endY += endZ - viewLevel;
-		if (endY > _battleSave->getMapSizeY() - 1)
-			endY = _battleSave->getMapSizeY() - 1;
-	}
-	else
-		endZ = viewLevel;
-
-	beginY -= viewLevel << 1u;
-	beginX -= viewLevel << 1u;
-	if (beginX < 0) beginX = 0;
-	if (beginY < 0) beginY = 0;
+		endZ;
+	getDrawBounds(
+				surface,
+				viewLevel,
+				&beginX,
+				&beginY,
+				&endX,
+				&endY,
+				&endZ);
 
 
 	static Surface* const srfBorder (_res->getSurfaceSet("SCANG.DAT")->getFrame(330));
@@ -941,7 +933,8 @@ void Map::drawTerrain(Surface* const surface) // private.
 					if (   posScreen.x > -_spriteWidth // only render cells that are inside the surface (ie viewport ala player's monitor)
 						&& posScreen.x <  _spriteWidth + surface->getWidth()
 						&& posScreen.y > -_spriteHeight
-						&& posScreen.y <  _spriteHeight + surface->getHeight())
+						&& posScreen.y <  _spriteHeight + surface->getHeight()
+						&& (dirtyOnly == false || isTileAreaDirty(posScreen) == true))
 					{
 						if (itZ != 0)
 							tileBelow = _battleSave->getTile(posField + POS_BELOW);
@@ -966,8 +959,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 						if ((sprite = _tile->getSprite(O_FLOOR)) != nullptr)
 						{
 							hasFloor = true;
-							sprite->blitNShade(
+							blitSprite(
 									surface,
+									sprite,
 									posScreen.x,
 									posScreen.y - _tile->getMapData(O_FLOOR)->getOffsetY(),
 									tileShade);
@@ -996,6 +990,7 @@ void Map::drawTerrain(Surface* const surface) // private.
 										&& unitEastBelow->getFaction() == FACTION_PLAYER)
 									{
 										drawRankIcon(
+												surface,
 												unitEastBelow,
 												posScreen.x + 16,
 												posScreen.y + 32);
@@ -1052,8 +1047,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 																		shade = tileShade;
 
 																	calcWalkOffset(unitNorth, &walkOffset, isLocation);
-																	sprite->blitNShade(
+																	blitSprite(
 																			surface,
+																			sprite,
 																			posScreen.x + walkOffset.x + 16 - _spriteWidth_2,
 																			posScreen.y + walkOffset.y -  8 + offsetZ_y,
 																			shade);
@@ -1062,8 +1058,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 																	{
 																		sprite = _res->getSurfaceSet("SMOKE.PCK")->getFrame(4 + (_aniCycle >> 1u));
 																		//if (sprite != nullptr)
-																			sprite->blitNShade(
+																			blitSprite(
 																					surface,
+																					sprite,
 																					posScreen.x + walkOffset.x + 16,
 																					posScreen.y + walkOffset.y -  8);
 																	}
@@ -1119,8 +1116,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 
 								sprite = _res->getSurfaceSet("CURSOR.PCK")->getFrame(spriteId);
 								//if (sprite != nullptr)
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y);
 							}
@@ -1128,8 +1126,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 							{
 								sprite = _res->getSurfaceSet("CURSOR.PCK")->getFrame(2); // blue static box
 								//if (sprite != nullptr)
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y);
 							}
@@ -1173,8 +1172,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								else
 									shade = SHADE_BLACK;
 
-								sprite->blitNShade(
+								blitSprite(
 										surface,
+										sprite,
 										posScreen.x,
 										posScreen.y - _tile->getMapData(O_WESTWALL)->getOffsetY(),
 										shade);
@@ -1193,8 +1193,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								else
 									shade = SHADE_BLACK;
 
-								sprite->blitNShade(
+								blitSprite(
 										surface,
+										sprite,
 										posScreen.x,
 										posScreen.y - _tile->getMapData(O_NORTHWALL)->getOffsetY(),
 										shade,
@@ -1214,8 +1215,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 									case BIGWALL_NORTH:
 //									case BIGWALL_W_N: // NOT USED in stock UFO.
 										hasObject = true;
-										sprite->blitNShade(
+										blitSprite(
 												surface,
+												sprite,
 												posScreen.x,
 												posScreen.y - _tile->getMapData(O_CONTENT)->getOffsetY(),
 												tileShade);
@@ -1228,8 +1230,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 							{
 								sprite = _res->getSurfaceSet("FLOOROB.PCK")->getFrame(spriteId);
 								//if (sprite != nullptr)
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y + _tile->getTerrainLevel(),
 											tileShade);
@@ -1238,8 +1241,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								{
 									sprite = _res->getSurfaceSet("SMOKE.PCK")->getFrame(4 + (_aniCycle >> 1u));
 									//if (sprite != nullptr)
-										sprite->blitNShade(
+										blitSprite(
 												surface,
+												sprite,
 												posScreen.x,
 												posScreen.y + _tile->getTerrainLevel());
 								}
@@ -1250,8 +1254,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								sprite = _res->getSurfaceSet("FLOOROB.PCK")->getFrame(spriteId);
 								//if (sprite != nullptr)
 								{
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y + _tile->getTerrainLevel(),
 											tileShade);
@@ -1265,8 +1270,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 										{
 											_srfFuse->setPixelColor(x, 0, _fuseColor);
 										}
-										_srfFuse->blitNShade(
+										blitSprite(
 												surface,
+												_srfFuse,
 												posScreen.x + 15,
 												posScreen.y + 28 + _tile->getTerrainLevel());
 									}
@@ -1287,6 +1293,7 @@ void Map::drawTerrain(Surface* const surface) // private.
 									&& unitBelow->getFaction() == FACTION_PLAYER)
 								{
 									drawRankIcon(
+											surface,
 											unitBelow,
 											posScreen.x,
 											posScreen.y + 24);
@@ -1312,8 +1319,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 										&&  voxel.z / 24 ==  itZ)
 									{
 										_camera->convertVoxelToScreen(voxel, &bullet);
-										sprite->blitNShade(
+										blitSprite(
 												surface,
+												sprite,
 												bullet.x - 16,
 												bullet.y - 26,
 												SHADE_BLACK);
@@ -1327,8 +1335,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 										&&  voxel.z / 24 ==  itZ)
 									{
 										_camera->convertVoxelToScreen(voxel, &bullet);
-										sprite->blitNShade(
+										blitSprite(
 												surface,
+												sprite,
 												bullet.x - 16,
 												bullet.y - 26);
 									}
@@ -1359,8 +1368,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 
 												bullet.x -= sprite->getWidth() >> 1u;
 												bullet.y -= sprite->getHeight() >> 1u;
-												sprite->blitNShade(
+												blitSprite(
 														surface,
+														sprite,
 														bullet.x,
 														bullet.y,
 														SHADE_BLACK);
@@ -1375,8 +1385,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 
 												bullet.x -= sprite->getWidth() >> 1u;
 												bullet.y -= sprite->getHeight() >> 1u;
-												sprite->blitNShade(
+												blitSprite(
 														surface,
+														sprite,
 														bullet.x,
 														bullet.y);
 											}
@@ -1496,8 +1507,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 										shade = tileShade;
 
 									calcWalkOffset(_unit, &walkOffset, isLocation);
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x + walkOffset.x - _spriteWidth_2,
 											posScreen.y + walkOffset.y,
 											shade, halfRight,
@@ -1507,8 +1519,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 									{
 										sprite = _res->getSurfaceSet("SMOKE.PCK")->getFrame(4 + (_aniCycle >> 1u));
 										//if (sprite != nullptr)
-											sprite->blitNShade(
+											blitSprite(
 													surface,
+													sprite,
 													posScreen.x + walkOffset.x,
 													posScreen.y + walkOffset.y,
 													0, halfRight,
@@ -1525,8 +1538,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 											&& tileNorth->getMapData(O_CONTENT)->getBigwall() == BIGWALL_EAST)
 										{
 											sprite = tileNorth->getSprite(O_CONTENT);
-											sprite->blitNShade(
+											blitSprite(
 													surface,
+													sprite,
 													posScreen.x + 16,
 													posScreen.y -  8 - tileNorth->getMapData(O_CONTENT)->getOffsetY(),
 													tileNorth->getShade());
@@ -1542,8 +1556,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 											&& tileWest->getMapData(O_CONTENT)->getBigwall() == BIGWALL_SOUTH)
 										{
 											sprite = tileWest->getSprite(O_CONTENT);
-											sprite->blitNShade(
+											blitSprite(
 													surface,
+													sprite,
 													posScreen.x - 16,
 													posScreen.y -  8 - tileWest->getMapData(O_CONTENT)->getOffsetY(),
 													tileWest->getShade());
@@ -1563,6 +1578,7 @@ void Map::drawTerrain(Surface* const surface) // private.
 												&& _unit != _battleSave->getSelectedUnit())
 											{
 												drawRankIcon(
+														surface,
 														_unit,
 														posScreen.x + walkOffset.x,
 														posScreen.y + walkOffset.y,
@@ -1595,8 +1611,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 													_numExposed->setValue(static_cast<unsigned>(exposure));
 													_numExposed->setColor(color);
 													_numExposed->draw();
-													_numExposed->blitNShade(
+													blitNumber(
 															surface,
+															_numExposed,
 															posScreen.x + walkOffset.x + 21,
 															posScreen.y + walkOffset.y + 5);
 												}
@@ -1614,8 +1631,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 							const int hurt (_tile->hasUnconsciousUnit());
 							if (hurt != 0)
 							{
-								_srfRookiBadge->blitNShade(			// background panel for red cross icon.
+								blitSprite(			// background panel for red cross icon.
 													surface,
+													_srfRookiBadge,
 													posScreen.x,
 													posScreen.y);
 								int color;
@@ -1625,8 +1643,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 									case 1: color = WHITE_i; break;	// unconscious soldier here
 									case 2: color = RED_i;			// wounded unconscious soldier
 								}
-								_srfCross->blitNShade(				// small gray cross
+								blitSprite(				// small gray cross
 												surface,
+												_srfCross,
 												posScreen.x + 2,
 												posScreen.y + 1,
 												(_aniCycle << 1u),
@@ -1658,8 +1677,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 											shade = SHADE_BLACK;
 
 										calcWalkOffset(unitBelow, &walkOffset, isLocation);
-										sprite->blitNShade(
+										blitSprite(
 												surface,
+												sprite,
 												posScreen.x + walkOffset.x - _spriteWidth_2,
 												posScreen.y + walkOffset.y + 24,
 												shade);
@@ -1668,8 +1688,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 										{
 											sprite = _res->getSurfaceSet("SMOKE.PCK")->getFrame(4 + (_aniCycle >> 1u));
 											//if (sprite != nullptr)
-												sprite->blitNShade(
+												blitSprite(
 														surface,
+														sprite,
 														posScreen.x + walkOffset.x,
 														posScreen.y + walkOffset.y + 24);
 										}
@@ -1703,8 +1724,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								spriteId += ((_aniCycle >> 1u) + _tile->getAnimationOffset()) % 4;
 								sprite = _res->getSurfaceSet(st)->getFrame(spriteId);
 								//if (sprite != nullptr)
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y, //+ _tile->getTerrainLevel(),
 											shade);
@@ -1720,8 +1742,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 							{
 								sprite = _res->getSurfaceSet("Pathfinding")->getFrame(11);
 								//if (sprite != nullptr)
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y + 2,
 											0, false,
@@ -1730,8 +1753,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 
 							sprite = _res->getSurfaceSet("Pathfinding")->getFrame(_tile->getPreviewDir());
 							//if (sprite != nullptr)
-								sprite->blitNShade(
+								blitSprite(
 										surface,
+										sprite,
 										posScreen.x,
 										posScreen.y,
 										0, false,
@@ -1746,8 +1770,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								case BIGWALL_EAST:
 								case BIGWALL_SOUTH:
 								case BIGWALL_E_S:
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y - _tile->getMapData(O_CONTENT)->getOffsetY(),
 											tileShade);
@@ -1765,8 +1790,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 							if (viewLevel > itZ)
 							{
 								sprite = _res->getSurfaceSet("CURSOR.PCK")->getFrame(5); // blue static box
-								sprite->blitNShade(
+								blitSprite(
 										surface,
+										sprite,
 										posScreen.x,
 										posScreen.y);
 							}
@@ -1801,8 +1827,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								}
 
 								sprite = _res->getSurfaceSet("CURSOR.PCK")->getFrame(spriteId);
-								sprite->blitNShade(
+								blitSprite(
 										surface,
+										sprite,
 										posScreen.x,
 										posScreen.y);// + vertOffset);
 
@@ -1822,8 +1849,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 											//if (sprite != nullptr)
 											{
 												calcWalkOffset(_unit, &walkOffset, isLocation);
-												sprite->blitNShade(
+												blitSprite(
 														surface,
+														sprite,
 														posScreen.x + walkOffset.x - _spriteWidth_2,
 														posScreen.y + walkOffset.y,
 														tileShade);
@@ -1913,8 +1941,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 										_numAccuracy->setValue(static_cast<unsigned>(accuracy));
 										_numAccuracy->setColor(color);
 										_numAccuracy->draw();
-										_numAccuracy->blitNShade(
+										blitNumber(
 												surface,
+												_numAccuracy,
 												posScreen.x,
 												posScreen.y);
 										break;
@@ -1950,8 +1979,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 										_numAccuracy->setValue(accuracy);
 										_numAccuracy->setColor(color);
 										_numAccuracy->draw();
-										_numAccuracy->blitNShade(
+										blitNumber(
 												surface,
+												_numAccuracy,
 												posScreen.x,
 												posScreen.y);
 									}
@@ -1965,8 +1995,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 									{
 										static const int cursorSprites[6u] {0,0,0,11,13,15};
 										sprite = _res->getSurfaceSet("CURSOR.PCK")->getFrame(cursorSprites[_selectorType] + (_aniCycle >> 2u));
-										sprite->blitNShade(
+										blitSprite(
 												surface,
+												sprite,
 												posScreen.x,
 												posScreen.y);
 									}
@@ -1991,16 +2022,18 @@ void Map::drawTerrain(Surface* const surface) // private.
 								if (offset_x == 2 && offset_y == 2)
 								{
 									sprite = _res->getSurfaceSet("Targeter")->getFrame(0); // was "CURSOR.PCK" spriteId= 7
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y);
 								}
 
 								_numWaypoint->setValue(wpVal);
 								_numWaypoint->draw();
-								_numWaypoint->blitNShade(
+								blitNumber(
 										surface,
+										_numWaypoint,
 										posScreen.x + offset_x,
 										posScreen.y + offset_y);
 
@@ -2026,8 +2059,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								|| itY == 0
 								|| itY == _battleSave->getMapSizeY() - 1)
 							{
-								srfBorder->blitNShade(
+								blitSprite(
 										surface,
+										srfBorder,
 										posScreen.x + 14,
 										posScreen.y + 31);
 							}
@@ -2045,8 +2079,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 //									_battleSave->scannerDots().end(),
 //									dotTest) != _battleSave->scannerDots().end())
 //							{
-//								srfBorder->blitNShade(
+//								blitSprite(
 //										surface,
+//										srfBorder,
 //										posScreen.x + 14,
 //										posScreen.y + 30,
 //										0, false, RED_i);
@@ -2100,14 +2135,16 @@ void Map::drawTerrain(Surface* const surface) // private.
 					static const int phaseCycle[8u] {0,-3,3,-2,-3,-2,0,1};
 
 					if (_unit->isKneeled() == true)
-						_arrow_kneel->blitNShade(
+						blitSprite(
 								surface,
+								_arrow_kneel,
 								posScreen.x - (_arrow_kneel->getWidth() >> 1u),
 								posScreen.y -  _arrow_kneel->getHeight() - 4 - phaseCycle[_aniCycle]);
 //								posScreen.y -  _arrow_kneel->getHeight() - 4 - phaseCycle);
 					else
-						_arrow->blitNShade(
+						blitSprite(
 								surface,
+								_arrow,
 								posScreen.x - (_arrow->getWidth() >> 1u),
 								posScreen.y -  _arrow->getHeight() + phaseCycle[_aniCycle]);
 //								posScreen.y -  _arrow->getHeight() + phaseCycle);
@@ -2144,7 +2181,8 @@ void Map::drawTerrain(Surface* const surface) // private.
 					if (   posScreen.x > -_spriteWidth // only render pathPreview inside the screen-surface
 						&& posScreen.x <  _spriteWidth + surface->getWidth()
 						&& posScreen.y > -_spriteHeight
-						&& posScreen.y <  _spriteHeight + surface->getHeight())
+						&& posScreen.y <  _spriteHeight + surface->getHeight()
+						&& (dirtyOnly == false || isTileAreaDirty(posScreen) == true))
 					{
 						if ((_tile = _battleSave->getTile(posField)) != nullptr
 							&& _tile->isRevealed() == true
@@ -2159,8 +2197,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 								{
 									sprite = _res->getSurfaceSet("Pathfinding")->getFrame(23);
 									//if (sprite != nullptr)
-										sprite->blitNShade(
+										blitSprite(
 												surface,
+												sprite,
 												posScreen.x,
 												posScreen.y + 2,
 												0, false,
@@ -2169,8 +2208,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 
 								sprite = _res->getSurfaceSet("Pathfinding")->getFrame(_tile->getPreviewDir() + 12);
 								//if (sprite != nullptr)
-									sprite->blitNShade(
+									blitSprite(
 											surface,
+											sprite,
 											posScreen.x,
 											posScreen.y - offset_y,
 											0, false,
@@ -2196,13 +2236,15 @@ void Map::drawTerrain(Surface* const surface) // private.
 								_numWaypoint->draw();
 
 								if (_previewSetting & PATH_ARROWS)
-									_numWaypoint->blitNShade(
+									blitNumber(
 												surface,
+												_numWaypoint,
 												posScreen.x + 16 - offset_x,
 												posScreen.y + 30 - offset_y);
 								else
-									_numWaypoint->blitNShade(
+									blitNumber(
 												surface,
+												_numWaypoint,
 												posScreen.x + 16 - offset_x,
 												posScreen.y + 37 - offset_y,
 												0, false,
@@ -2246,8 +2288,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 				{
 					case ET_AOE: // Explosions, http://ufopaedia.org/index.php?title=X1.PCK
 						sprite = _res->getSurfaceSet("X1.PCK")->getFrame(spriteId);
-						sprite->blitNShade(
+						blitSprite(
 								surface,
+								sprite,
 								bullet.x - (sprite->getWidth()  >> 1u),
 								bullet.y - (sprite->getHeight() >> 1u));
 						break;
@@ -2255,8 +2298,9 @@ void Map::drawTerrain(Surface* const surface) // private.
 					case ET_BULLET: // Bullet-hits, http://ufopaedia.org/index.php?title=SMOKE.PCK
 					case ET_TORCH:
 						sprite = _res->getSurfaceSet("ProjectileHits")->getFrame(spriteId); // was "SMOKE.PCK" w/ different sprite-offsets.
-						sprite->blitNShade(
+						blitSprite(
 								surface,
+								sprite,
 								bullet.x - 15,
 								bullet.y - 15);
 						break;
@@ -2264,16 +2308,18 @@ void Map::drawTerrain(Surface* const surface) // private.
 					case ET_MELEE_HIT:	// Melee success, http://ufopaedia.org/index.php?title=HIT.PCK
 					case ET_PSI:		// Psiamp strikes
 							sprite = _res->getSurfaceSet("HIT.PCK")->getFrame(spriteId);
-							sprite->blitNShade(
+							blitSprite(
 									surface,
+									sprite,
 									bullet.x - 15,
 									bullet.y - 25);
 						break;
 
 					case ET_MELEE_ATT: // Melee swing
 							sprite = _res->getSurfaceSet("ClawTooth")->getFrame(spriteId);
-							sprite->blitNShade(
+							blitSprite(
 									surface,
+									sprite,
 									bullet.x - 15,
 									bullet.y - 25);
 				}
@@ -2284,14 +2330,801 @@ void Map::drawTerrain(Surface* const surface) // private.
 	surface->unlock();
 }
 
+/**
+ * Draws the battlefield on the WorkerPool's threads.
+ * @note drawTerrain() runs as usual but records its sprite-blits instead of
+ * doing them. The surface is then split into horizontal screen-bands; each band
+ * blits - clipped to itself and in the recorded order - only the sprites that
+ * touch it. The painter's order only matters where sprites overlap and each
+ * pixel gets the same blits in the same order as the serial draw, so the result
+ * is identical. With 'Options::battleDrawCheck' drawTerrain() first draws the
+ * usual serial frame on a copy of the surface and any difference between it
+ * and the banded frame is logged. Frames with a projectile in flight aren't
+ * checked since drawing those can move the Camera.
+ * @param surface	- the Surface on which to draw the battlefield
+ * @param dirtyOnly	- true to skip tiles that can't draw on a dirty screen-chunk
+ *					  (default false)
+ */
+void Map::rasterTerrain( // private.
+		Surface* const surface,
+		bool dirtyOnly)
+{
+	if (WorkerPool::getThreads() < 2u)
+	{
+		drawTerrain(surface, dirtyOnly);
+		return;
+	}
+
+	const int
+		width  (surface->getWidth()),
+		height (surface->getHeight());
+
+	const bool check (Options::battleDrawCheck == true
+				   && _projectile == nullptr);
+	if (check == true)
+	{
+		if (_srfCheck == nullptr
+			|| _srfCheck->getWidth()  != width
+			|| _srfCheck->getHeight() != height)
+		{
+			delete _srfCheck;
+			_srfCheck = new Surface(width, height);
+		}
+
+		surface->lock();
+		_srfCheck->lock();
+		for (int
+				y = 0;
+				y != height;
+				++y)
+		{
+			std::memcpy(
+					static_cast<Uint8*>(_srfCheck->getSurface()->pixels) + y * _srfCheck->getSurface()->pitch,
+					static_cast<Uint8*>(surface  ->getSurface()->pixels) + y * surface  ->getSurface()->pitch,
+					static_cast<size_t>(width));
+		}
+		_srfCheck->unlock();
+		surface->unlock();
+
+		drawTerrain(_srfCheck, dirtyOnly); // the reference: the serial draw.
+	}
+
+	_recording = true;
+	drawTerrain(surface, dirtyOnly);
+	_recording = false;
+
+	_drawTarget = surface;
+	_drawBands = std::min(
+					static_cast<size_t>(height),
+					WorkerPool::getThreads() * static_cast<size_t>(BANDS_PER_THREAD));
+
+	surface->lock();
+	WorkerPool::run(rasterBand, this, _drawBands);
+	surface->unlock();
+
+	if (check == true)
+	{
+		size_t diff (0u);
+		_srfCheck->lock();
+		surface->lock();
+		for (int
+				y = 0;
+				y != height;
+				++y)
+		{
+			const Uint8
+				* const pixels      (static_cast<Uint8*>(surface  ->getSurface()->pixels) + y * surface  ->getSurface()->pitch),
+				* const pixelsCheck (static_cast<Uint8*>(_srfCheck->getSurface()->pixels) + y * _srfCheck->getSurface()->pitch);
+			for (int
+					x = 0;
+					x != width;
+					++x)
+			{
+				if (pixels[x] != pixelsCheck[x])
+					++diff;
+			}
+		}
+		surface->unlock();
+		_srfCheck->unlock();
+
+		if (diff != 0u)
+			Log(LOG_WARNING) << "Map: threaded draw differs from serial draw in " << diff << " pixels";
+	}
+
+	for (std::vector<Surface*>::const_iterator
+			i  = _drawCopies.begin();
+			i != _drawCopies.end();
+			++i)
+	{
+		delete *i;
+	}
+	_drawCopies.clear();
+	_drawOps.clear();
+	_drawTarget = nullptr;
+}
+
+/**
+ * Draws the recorded sprite-blits that touch a screen-band.
+ * @note This is a WorkerPool::Task. Bands don't overlap so they can be drawn
+ * at the same time.
+ * @param data - pointer to the Map
+ * @param band - the band to draw
+ */
+void Map::rasterBand( // static/private.
+		void* data,
+		size_t band)
+{
+	const Map* const map (static_cast<const Map*>(data));
+	Surface* const surface (map->_drawTarget);
+
+	const int
+		height (surface->getHeight()),
+		bands  (static_cast<int>(map->_drawBands)),
+		yBeg   (height *  static_cast<int>(band)       / bands),
+		yEnd   (height * (static_cast<int>(band) + 1) / bands);
+
+	const GraphSubset clip (
+						std::make_pair(0, surface->getWidth()),
+						std::make_pair(yBeg, yEnd));
+
+	for (std::vector<DrawOp>::const_iterator
+			i  = map->_drawOps.begin();
+			i != map->_drawOps.end();
+			++i)
+	{
+		if (i->y < yEnd && i->y + i->sprite->getHeight() > yBeg)
+			i->sprite->blitNShade(
+							surface,
+							i->x,
+							i->y,
+							i->colorOffset,
+							i->halfRight,
+							i->colorGroup,
+							i->halfLeft,
+							&clip);
+	}
+}
+
+/**
+ * Blits a sprite or records it for threaded rasterizing.
+ * @note The arguments are those of Surface::blitNShade().
+ * @param surface		- the Surface to blit to
+ * @param sprite		- the Surface to blit
+ * @param x				- x-position on 'surface'
+ * @param y				- y-position on 'surface'
+ * @param colorOffset	- color offset (default 0)
+ * @param halfRight		- blit only the right half (default false)
+ * @param colorGroup	- colorblock + 1 or 0 (default 0)
+ * @param halfLeft		- blit only the left half (default false)
+ */
+void Map::blitSprite( // private.
+		Surface* const surface,
+		Surface* const sprite,
+		int x,
+		int y,
+		int colorOffset,
+		bool halfRight,
+		int colorGroup,
+		bool halfLeft)
+{
+	if (_recording == true)
+	{
+		DrawOp op;
+		op.sprite		= sprite;
+		op.x			= x;
+		op.y			= y;
+		op.colorOffset	= colorOffset;
+		op.colorGroup	= colorGroup;
+		op.halfRight	= halfRight;
+		op.halfLeft		= halfLeft;
+		_drawOps.push_back(op);
+	}
+	else
+		sprite->blitNShade(
+						surface,
+						x,y,
+						colorOffset,
+						halfRight,
+						colorGroup,
+						halfLeft);
+}
+
+/**
+ * Blits a NumberText or records a copy of it for threaded rasterizing.
+ * @note A NumberText is redrawn with different values during a draw so what it
+ * shows now has to be copied if the blit is recorded.
+ * @param surface		- the Surface to blit to
+ * @param number		- the NumberText to blit
+ * @param x				- x-position on 'surface'
+ * @param y				- y-position on 'surface'
+ * @param colorOffset	- color offset (default 0)
+ * @param halfRight		- blit only the right half (default false)
+ * @param colorGroup	- colorblock + 1 or 0 (default 0)
+ */
+void Map::blitNumber( // private.
+		Surface* const surface,
+		NumberText* const number,
+		int x,
+		int y,
+		int colorOffset,
+		bool halfRight,
+		int colorGroup)
+{
+	if (_recording == true)
+	{
+		Surface* const copy (new Surface(*number));
+		_drawCopies.push_back(copy);
+		blitSprite(
+				surface,
+				copy,
+				x,y,
+				colorOffset,
+				halfRight,
+				colorGroup);
+	}
+	else
+		number->blitNShade(
+						surface,
+						x,y,
+						colorOffset,
+						halfRight,
+						colorGroup);
+}
+
+/**
+ * Gets the rough boundaries of the tiles to draw.
+ * @param surface	- pointer to the Surface that will be drawn on
+ * @param viewLevel	- the Camera's view-level
+ * @param beginX	- pointer to the first x-column
+ * @param beginY	- pointer to the first y-row
+ * @param endX		- pointer to the last x-column
+ * @param endY		- pointer to the last y-row
+ * @param endZ		- pointer to the last z-level
+ */
+void Map::getDrawBounds( // private.
+		const Surface* const surface,
+		int viewLevel,
+		int* beginX,
+		int* beginY,
+		int* endX,
+		int* endY,
+		int* endZ) const
+{
+	int d;
+	_camera->convertScreenToMap(
+							0,
+							0,
+							beginX,
+							&d);
+	_camera->convertScreenToMap(
+							surface->getWidth(),
+							0,
+							&d,
+							beginY);
+	_camera->convertScreenToMap(
+							surface->getWidth()  + _spriteWidth,
+							surface->getHeight() + _spriteHeight,
+							endX,
+							&d);
+	_camera->convertScreenToMap(
+							0,
+							surface->getHeight() + _spriteHeight,
+							&d,
+							endY);
+
+	if (_camera->getShowLayers() == true)
+	{
+		*endZ = _battleSave->getMapSizeZ() - 1;
+		*endY += *endZ - viewLevel;
+		if (*endY > _battleSave->getMapSizeY() - 1)
+			*endY = _battleSave->getMapSizeY() - 1;
+	}
+	else
+		*endZ = viewLevel;
+
+	*beginY -= viewLevel << 1u;
+	*beginX -= viewLevel << 1u;
+	if (*beginX < 0) *beginX = 0;
+	if (*beginY < 0) *beginY = 0;
+}
+
+/**
+ * Mixes a value into a signature.
+ * @param sig - the signature so far
+ * @param val - the value to add
+ * @return, the new signature
+ */
+static inline uint64_t mixSig(
+		uint64_t sig,
+		uint64_t val)
+{
+	return (sig ^ val) * 1099511628211uLL; // FNV-1a prime
+}
+
+/**
+ * Redraws only the parts of the battlefield that changed since the last draw.
+ * @note The pixels of the previous draw are kept on the Map. Every Tile in the
+ * viewport gets a signature of what drawTerrain() would draw for it; a Tile
+ * whose signature differs from the one it had at the previous draw - or one
+ * that is animated, holds a visible unit, or is under the selector or a
+ * waypoint - marks the screen-chunks it can draw on as dirty. Only the tiles
+ * that can draw on a dirty chunk are redrawn onto '_srfCache' in the usual
+ * painter's order, so that walls and objects still overlap units correctly,
+ * and then only the dirty chunks are copied to the Map. A scroll of the Camera
+ * shifts the kept pixels and dirties the exposed strips. Projectiles,
+ * explosions, and any change that affects the whole Map redraw everything.
+ */
+void Map::drawTerrainCached() // private.
+{
+	const int
+		width  (getWidth()),
+		height (getHeight());
+
+	if (_srfCache == nullptr
+		|| _srfCache->getWidth()  != width
+		|| _srfCache->getHeight() != height)
+	{
+		delete _srfCache;
+		_srfCache = new Surface(width, height);
+		_srfCache->setPalette(getPalette());
+
+		_cacheChunksX = (width  + CACHE_CHUNK - 1) / CACHE_CHUNK;
+		_cacheChunksY = (height + CACHE_CHUNK - 1) / CACHE_CHUNK;
+		_chunkDirty.assign(static_cast<size_t>(_cacheChunksX * _cacheChunksY), 0u);
+		_cacheValid = false;
+	}
+
+	if (_tileSigs.size() != _battleSave->getMapSizeXYZ())
+	{
+		_tileSigs.assign(_battleSave->getMapSizeXYZ(), 0uLL);
+		_cacheValid = false;
+	}
+
+	const Position offset (_camera->getMapOffset());
+	const int
+		dx (offset.x - _cacheOffset.x),
+		dy (offset.y - _cacheOffset.y);
+
+	if (_cacheValid == false
+		|| _projectile != nullptr
+		|| _explosions.empty() == false
+		|| getCacheKey() != _cacheKey
+		|| std::abs(dx) >= width
+		|| std::abs(dy) >= height)
+	{
+		clear(SCREEN_BLACK);
+		rasterTerrain(this);
+
+		hashTiles(false); // NOTE: drawTerrain() can move the Camera while following a projectile.
+		_cacheKey = getCacheKey();
+		_cacheOffset = _camera->getMapOffset();
+		_cacheValid = _projectile == nullptr // don't keep a frame that has a bullet or explosion on it
+				   && _explosions.empty() == true;
+		return;
+	}
+
+	std::fill(
+			_chunkDirty.begin(),
+			_chunkDirty.end(),
+			0u);
+
+	if (dx != 0 || dy != 0)
+	{
+		scrollPixels(dx, dy);
+		_cacheOffset = offset;
+	}
+
+	hashTiles(true);
+
+	if (std::find(
+			_chunkDirty.begin(),
+			_chunkDirty.end(),
+			1u) == _chunkDirty.end())
+	{
+		return; // nothing changed.
+	}
+
+	SDL_Surface
+		* const srfMap   (getSurface()),
+		* const srfCache (_srfCache->getSurface());
+	Uint8
+		* const pixelsMap   (static_cast<Uint8*>(srfMap  ->pixels)),
+		* const pixelsCache (static_cast<Uint8*>(srfCache->pixels));
+	int
+		x,y,
+		chunkWidth,
+		chunkEnd;
+
+	_srfCache->lock();
+	for (int
+			cy = 0;
+			cy != _cacheChunksY;
+			++cy)
+	{
+		for (int
+				cx = 0;
+				cx != _cacheChunksX;
+				++cx)
+		{
+			if (_chunkDirty[static_cast<size_t>(cy * _cacheChunksX + cx)] != 0u)
+			{
+				x = cx * CACHE_CHUNK;
+				chunkWidth = std::min(CACHE_CHUNK, width - x);
+				chunkEnd = std::min(height, (cy + 1) * CACHE_CHUNK);
+				for (
+						y = cy * CACHE_CHUNK;
+						y != chunkEnd;
+						++y)
+				{
+					std::memset(
+							pixelsCache + y * srfCache->pitch + x,
+							static_cast<int>(SCREEN_BLACK),
+							static_cast<size_t>(chunkWidth));
+				}
+			}
+		}
+	}
+	_srfCache->unlock();
+
+	rasterTerrain(_srfCache, true);
+
+	lock();
+	_srfCache->lock();
+	for (int
+			cy = 0;
+			cy != _cacheChunksY;
+			++cy)
+	{
+		for (int
+				cx = 0;
+				cx != _cacheChunksX;
+				++cx)
+		{
+			if (_chunkDirty[static_cast<size_t>(cy * _cacheChunksX + cx)] != 0u)
+			{
+				x = cx * CACHE_CHUNK;
+				chunkWidth = std::min(CACHE_CHUNK, width - x);
+				chunkEnd = std::min(height, (cy + 1) * CACHE_CHUNK);
+				for (
+						y = cy * CACHE_CHUNK;
+						y != chunkEnd;
+						++y)
+				{
+					std::memcpy(
+							pixelsMap   + y * srfMap  ->pitch + x,
+							pixelsCache + y * srfCache->pitch + x,
+							static_cast<size_t>(chunkWidth));
+				}
+			}
+		}
+	}
+	_srfCache->unlock();
+	unlock();
+}
+
+/**
+ * Updates the signatures of the tiles in the viewport.
+ * @param markDirty - true to mark the screen-chunks of tiles that changed as
+ *					  dirty
+ */
+void Map::hashTiles(bool markDirty) // private.
+{
+	const int viewLevel (_camera->getViewLevel());
+	int
+		beginX,
+		beginY,
+		endX,
+		endY,
+		endZ;
+	getDrawBounds(
+				this,
+				viewLevel,
+				&beginX,
+				&beginY,
+				&endX,
+				&endY,
+				&endZ);
+
+	const bool cursor (_selectorType != CT_NONE
+					&& _battleSave->getBattleState()->getMouseOverToolbar() == false);
+
+	const Tile* tile;
+	Position
+		posField,
+		posScreen;
+	uint64_t sig;
+
+	for (int
+			itX = beginX;
+			itX <= endX;
+			++itX)
+	{
+		for (int
+				itY = beginY;
+				itY <= endY;
+				++itY)
+		{
+			for (int
+					itZ = 0;
+					itZ <= endZ;
+					++itZ)
+			{
+				if ((tile = _battleSave->getTile(posField = Position(itX,itY,itZ))) != nullptr)
+				{
+					_camera->convertMapToScreen(posField, &posScreen);
+					posScreen += _camera->getMapOffset();
+
+					if (   posScreen.x > -_spriteWidth
+						&& posScreen.x <  _spriteWidth + getWidth()
+						&& posScreen.y > -_spriteHeight
+						&& posScreen.y <  _spriteHeight + getHeight())
+					{
+						if (cursor == true
+							&& _selectorX >  itX - _selectorSize
+							&& _selectorY >  itY - _selectorSize
+							&& _selectorX <= itX
+							&& _selectorY <= itY)
+						{
+							sig = 0uLL;
+						}
+						else if (_waypoints.empty() == false
+							&& std::find(
+									_waypoints.begin(),
+									_waypoints.end(),
+									posField) != _waypoints.end())
+						{
+							sig = 0uLL;
+						}
+						else
+							sig = getTileSignature(tile);
+
+						uint64_t& sigPre (_tileSigs[_battleSave->getTileIndex(posField)]);
+						if (markDirty == true
+							&& (sig == 0uLL || sig != sigPre))
+						{
+							dirtyTileArea(posScreen);
+						}
+						sigPre = sig;
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Hashes what drawTerrain() draws for a Tile that isn't animated.
+ * @param tile - pointer to a Tile
+ * @return, the signature or 0 if the Tile must be redrawn every draw
+ */
+uint64_t Map::getTileSignature(const Tile* const tile) const // private.
+{
+	const BattleUnit* const unit (tile->getTileUnit());
+	if ((unit != nullptr
+			&& (unit->getUnitVisible() == true || _battleSave->getDebugTac() == true))
+		|| tile->getFire() != 0
+		|| tile->getSmoke() != 0
+		|| tile->hasUnconsciousUnit() != 0)
+	{
+		return 0uLL;
+	}
+
+	bool var;
+	const int corpseId (tile->getCorpseSprite(&var));
+	if (var == true) return 0uLL; // burning corpse
+
+	const int topId (tile->getTopSprite(&var));
+	if (var == true) return 0uLL; // primed grenade
+
+	uint64_t sig (14695981039346656037uLL); // FNV-1a offset basis
+	for (int
+			i = 0;
+			i != 4;
+			++i)
+	{
+		const MapDataType partType (static_cast<MapDataType>(i));
+		sig = mixSig(sig, reinterpret_cast<uintptr_t>(tile->getSprite(partType)));
+		sig = mixSig(sig, reinterpret_cast<uintptr_t>(tile->getMapData(partType)));
+	}
+
+	sig = mixSig(sig, static_cast<uint64_t>(tile->getShade()));
+	sig = mixSig(sig, static_cast<uint64_t>(tile->isRevealed(ST_CONTENT))
+					| static_cast<uint64_t>(tile->isRevealed(ST_WEST))  << 1u
+					| static_cast<uint64_t>(tile->isRevealed(ST_NORTH)) << 2u
+					| static_cast<uint64_t>(tile->isVoid(true, false))  << 3u
+					| static_cast<uint64_t>(unit != nullptr)            << 4u); // border-marks aren't drawn under hidden units
+	sig = mixSig(sig, static_cast<uint64_t>(tile->getTerrainLevel()));
+	sig = mixSig(sig, static_cast<uint64_t>(corpseId));
+	sig = mixSig(sig, static_cast<uint64_t>(topId));
+	sig = mixSig(sig, static_cast<uint64_t>(tile->getPreviewDir()));
+	sig = mixSig(sig, static_cast<uint64_t>(tile->getPreviewTu()));
+	sig = mixSig(sig, static_cast<uint64_t>(tile->getPreviewColor()));
+
+	if (sig == 0uLL) sig = 1uLL; // 0 is reserved for "always redraw"
+	return sig;
+}
+
+/**
+ * Hashes the state that affects all tiles on the Map.
+ * @note A change of this redraws the whole Map.
+ * @return, the signature
+ */
+uint64_t Map::getCacheKey() const // private.
+{
+	uint64_t key (14695981039346656037uLL);
+	key = mixSig(key, static_cast<uint64_t>(_camera->getViewLevel()));
+	key = mixSig(key, static_cast<uint64_t>(_camera->getShowLayers()));
+	key = mixSig(key, static_cast<uint64_t>(_selectorType));
+	key = mixSig(key, static_cast<uint64_t>(_selectorSize));
+	key = mixSig(key, static_cast<uint64_t>(_battleSave->getBattleState()->getMouseOverToolbar()));
+	key = mixSig(key, static_cast<uint64_t>(_previewSetting));
+	key = mixSig(key, static_cast<uint64_t>(_battleSave->getPathfinding()->isPathPreviewed()));
+	key = mixSig(key, static_cast<uint64_t>(Options::traceAI));
+	key = mixSig(key, static_cast<uint64_t>(_battleSave->getSide()));
+	key = mixSig(key, static_cast<uint64_t>(_battleSave->getDebugTac()));
+	key = mixSig(key, reinterpret_cast<uintptr_t>(_battleSave->getSelectedUnit()));
+	return key;
+}
+
+/**
+ * Marks the screen-chunks that a Tile can draw on as dirty.
+ * @note The area is generous: a Tile draws units that stand on its neighbors
+ * as well as tall objects, rank-icons, and the bouncing arrow above itself.
+ * @param posScreen - reference to the screen-position of the Tile
+ */
+void Map::dirtyTileArea(const Position& posScreen) // private.
+{
+	const int
+		xBeg (std::max(0, posScreen.x - _spriteWidth) / CACHE_CHUNK),
+		xEnd (std::min(_cacheChunksX - 1, (posScreen.x + (_spriteWidth << 1u) - 1) / CACHE_CHUNK)),
+		yBeg (std::max(0, posScreen.y - (_spriteHeight << 1u)) / CACHE_CHUNK),
+		yEnd (std::min(_cacheChunksY - 1, (posScreen.y + (_spriteHeight << 1u) - 1) / CACHE_CHUNK));
+
+	for (int
+			cy = yBeg;
+			cy <= yEnd;
+			++cy)
+	{
+		for (int
+				cx = xBeg;
+				cx <= xEnd;
+				++cx)
+		{
+			_chunkDirty[static_cast<size_t>(cy * _cacheChunksX + cx)] = 1u;
+		}
+	}
+}
+
+/**
+ * Checks if a Tile can draw on a dirty screen-chunk.
+ * @note Uses the same area as dirtyTileArea().
+ * @param posScreen - reference to the screen-position of the Tile
+ * @return, true if the Tile needs to be redrawn
+ */
+bool Map::isTileAreaDirty(const Position& posScreen) const // private.
+{
+	const int
+		xBeg (std::max(0, posScreen.x - _spriteWidth) / CACHE_CHUNK),
+		xEnd (std::min(_cacheChunksX - 1, (posScreen.x + (_spriteWidth << 1u) - 1) / CACHE_CHUNK)),
+		yBeg (std::max(0, posScreen.y - (_spriteHeight << 1u)) / CACHE_CHUNK),
+		yEnd (std::min(_cacheChunksY - 1, (posScreen.y + (_spriteHeight << 1u) - 1) / CACHE_CHUNK));
+
+	for (int
+			cy = yBeg;
+			cy <= yEnd;
+			++cy)
+	{
+		for (int
+				cx = xBeg;
+				cx <= xEnd;
+				++cx)
+		{
+			if (_chunkDirty[static_cast<size_t>(cy * _cacheChunksX + cx)] != 0u)
+				return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Shifts the pixels of the Map by a camera-scroll.
+ * @note The strips that are exposed are marked dirty.
+ * @param dx - pixels to shift rightward
+ * @param dy - pixels to shift downward
+ */
+void Map::scrollPixels( // private.
+		int dx,
+		int dy)
+{
+	const int
+		width  (getWidth()),
+		height (getHeight()),
+		xSrc   (std::max(0, -dx)),
+		xDst   (std::max(0,  dx)),
+		span   (width - std::abs(dx)),
+		pitch  (getSurface()->pitch);
+	Uint8* const pixels (static_cast<Uint8*>(getSurface()->pixels));
+
+	lock();
+	if (dy > 0) // rows move down so copy bottom-up
+	{
+		for (int
+				y = height - 1;
+				y >= dy;
+				--y)
+		{
+			std::memmove(
+					pixels + y * pitch + xDst,
+					pixels + (y - dy) * pitch + xSrc,
+					static_cast<size_t>(span));
+		}
+	}
+	else
+	{
+		for (int
+				y = 0;
+				y < height + dy;
+				++y)
+		{
+			std::memmove(
+					pixels + y * pitch + xDst,
+					pixels + (y - dy) * pitch + xSrc,
+					static_cast<size_t>(span));
+		}
+	}
+	unlock();
+
+	int
+		xBeg (0),
+		xEnd (-1),
+		yBeg (0),
+		yEnd (-1);
+
+	if (dx > 0)
+		xEnd = (dx - 1) / CACHE_CHUNK;
+	else if (dx < 0)
+	{
+		xBeg = (width + dx) / CACHE_CHUNK;
+		xEnd = _cacheChunksX - 1;
+	}
+
+	if (dy > 0)
+		yEnd = (dy - 1) / CACHE_CHUNK;
+	else if (dy < 0)
+	{
+		yBeg = (height + dy) / CACHE_CHUNK;
+		yEnd = _cacheChunksY - 1;
+	}
+
+	for (int
+			cy = 0;
+			cy != _cacheChunksY;
+			++cy)
+	{
+		for (int
+				cx = 0;
+				cx != _cacheChunksX;
+				++cx)
+		{
+			if ((cx >= xBeg && cx <= xEnd)
+				|| (cy >= yBeg && cy <= yEnd))
+			{
+				_chunkDirty[static_cast<size_t>(cy * _cacheChunksX + cx)] = 1u;
+			}
+		}
+	}
+}
+
 /**
  * Draws a Soldier's rank-icon above its sprite on the Map.
+ * @param surface	- pointer to the Surface being drawn on
  * @param unit		- pointer to a BattleUnit
  * @param offset_x	- how much to offset in the x-direction
  * @param offset_y	- how much to offset in the y-direction
  * @param tLevel	- true to add terrain-level, false if calcWalkOffset (default true)
  */
 void Map::drawRankIcon( // private.
+		Surface* const surface,
 		const BattleUnit* const unit,
 		int offset_x,
 		int offset_y,
@@ -2311,21 +3144,24 @@ void Map::drawRankIcon( // private.
 
 			Surface* const sprite (_res->getSurface(solRank));
 			if (sprite != nullptr)
-				sprite->blitNShade(
-								this,
+				blitSprite(
+								surface,
+								sprite,
 								offset_x + 2,
 								offset_y + 3);
 			break;
 		}
 
 		default:
-			_srfRookiBadge->blitNShade(		// background panel for red cross icon.
-								this,
+			blitSprite(		// background panel for red cross icon.
+								surface,
+								_srfRookiBadge,
 								offset_x + 2,
 								offset_y + 3);
 
-			_srfCross->blitNShade(			// small gray cross drawn RED.
-								this,
+			blitSprite(			// small gray cross drawn RED.
+								surface,
+								_srfCross,
 								offset_x + 4,
 								offset_y + 4,
 								(_aniCycle << 1u),
@@ -2608,21 +3444,42 @@ void Map::animateMap(bool redraw)
 {
  	if (++_aniCycle == 8) _aniCycle = 0;
 
-	for (size_t
-			i = 0u;
-			i != _battleSave->getMapSizeXYZ();
-			++i)
+	std::vector<Tile*>& tiles (_battleSave->getAnimatedTiles());
+	for (std::vector<Tile*>::const_iterator
+			i  = tiles.begin();
+			i != tiles.end();
+			)
 	{
-		_battleSave->getTiles()[i]->animateTile();
+		if ((*i)->animateTile(_aniCycle) == true)
+			++i;
+		else // its animated parts got destroyed
+		{
+			(*i)->setAniListed(false);
+			i = tiles.erase(i);
+		}
+	}
+
+	if (_aniUnitsTally != _battleSave->getUnits()->size()) // units have been added; rebuild the list of constantly animated units
+	{
+		_aniUnitsTally = _battleSave->getUnits()->size();
+		_aniUnits.clear();
+
+		for (std::vector<BattleUnit*>::const_iterator
+				i  = _battleSave->getUnits()->begin();
+				i != _battleSave->getUnits()->end();
+				++i)
+		{
+			if ((*i)->getArmor()->getConstantAnimation() == true)
+				_aniUnits.push_back(*i);
+		}
 	}
 
 	for (std::vector<BattleUnit*>::const_iterator	// animate certain units
-			i = _battleSave->getUnits()->begin();	// eg. large flying units have a propulsion animation
-			i != _battleSave->getUnits()->end();
+			i  = _aniUnits.begin();					// eg. large flying units have a propulsion animation
+			i != _aniUnits.end();
 			++i)
 	{
-		if ((*i)->getUnitTile() != nullptr
-			&& (*i)->getArmor()->getConstantAnimation() == true)
+		if ((*i)->getUnitTile() != nullptr)
 		{
 			(*i)->setCacheInvalid();
 			cacheUnitSprite(*i);
@@ -2951,16 +3808,35 @@ void Map::cacheUnitSprites()
 
 /**
  * Checks if a BattleUnit needs to be redrawn and if so updates its sprite(s).
+ * @note Composited frames are kept by their UnitSpriteKey and copied to any
+ * unit that would draw the same frame, so units that animate constantly or
+ * look alike don't get re-composited from their spritesheets. The UnitSprite
+ * and the units' caches are reused so there are no allocations once the
+ * frames have been seen.
  * @param unit - pointer to a BattleUnit
  */
 void Map::cacheUnitSprite(BattleUnit* const unit)
 {
 	if (unit->isCacheInvalid() == true)
 	{
-		UnitSprite* const sprite (new UnitSprite(
-											_spriteWidth << 1u,
-											_spriteHeight));
-		sprite->setPalette(this->getPalette());
+		if (_unitSprite == nullptr)
+			_unitSprite = new UnitSprite(
+									_spriteWidth << 1u,
+									_spriteHeight);
+		_unitSprite->setPalette(this->getPalette());
+
+		const BattleItem
+			* rtItem (unit->getItem(ST_RIGHTHAND)),
+			* ltItem (unit->getItem(ST_LEFTHAND));
+
+		if (rtItem != nullptr && rtItem->getRules()->isFixed() == true)
+			rtItem = nullptr;
+
+		if (ltItem != nullptr && ltItem->getRules()->isFixed() == true)
+			ltItem = nullptr;
+
+		UnitSpriteKey key;
+		std::map<UnitSpriteKey, Surface*>::const_iterator frame;
 
 		const size_t quadrants (static_cast<size_t>(unit->getArmor()->getSize() * unit->getArmor()->getSize()));
 		for (size_t
@@ -2976,41 +3852,67 @@ void Map::cacheUnitSprite(BattleUnit* const unit)
 								_spriteHeight);
 				cache->setPalette(this->getPalette());
 			}
+			cache->clear();
 
-			sprite->setBattleUnit(unit, i);
-
-			if (i == 0u)
+			const bool shared (UnitSprite::buildKey(
+												unit, i,
+												rtItem,
+												ltItem,
+												_aniCycle,
+												key));
+			if (shared == true
+				&& (frame = _unitFrames.find(key)) != _unitFrames.end())
 			{
-				const BattleItem
-					* const rtItem (unit->getItem(ST_RIGHTHAND)),
-					* const ltItem (unit->getItem(ST_LEFTHAND));
-
-				if (rtItem != nullptr && rtItem->getRules()->isFixed() == false)
-					sprite->setBattleItRH(rtItem);
-				else
-					sprite->setBattleItRH();
-
-				if (ltItem != nullptr && ltItem->getRules()->isFixed() == false)
-					sprite->setBattleItLH(ltItem);
-				else
-					sprite->setBattleItLH();
+				frame->second->blit(cache);
 			}
+			else
+			{
+				_unitSprite->setBattleUnit(unit, i);
+				_unitSprite->setBattleItRH(rtItem);
+				_unitSprite->setBattleItLH(ltItem);
 
-			sprite->setSurfaces(
-							_res->getSurfaceSet(unit->getArmor()->getSpriteSheet()),
-							_res->getSurfaceSet("HANDOB.PCK"),
-							_res->getSurfaceSet("HANDOB2.PCK"));
-			sprite->setSpriteCycle(_aniCycle);
+				_unitSprite->setSurfaces(
+								_res->getSurfaceSet(unit->getArmor()->getSpriteSheet()),
+								_res->getSurfaceSet("HANDOB.PCK"),
+								_res->getSurfaceSet("HANDOB2.PCK"));
+				_unitSprite->setSpriteCycle(_aniCycle);
 
-			cache->clear();
-			sprite->blit(cache);
+				_unitSprite->blit(cache);
+
+				if (shared == true)
+				{
+					if (_unitFrames.size() == UNIT_FRAMES_MAX)
+						clearUnitFrames();
+
+					Surface* const srf (new Surface(
+												_spriteWidth << 1u,
+												_spriteHeight));
+					srf->setPalette(this->getPalette());
+					cache->blit(srf);
+					_unitFrames[key] = srf;
+				}
+			}
 
 			unit->setCache(cache, i);
 		}
-		delete sprite;
 	}
 }
 
+/**
+ * Deletes the composited unit-frames that are kept for sharing.
+ */
+void Map::clearUnitFrames() // private.
+{
+	for (std::map<UnitSpriteKey, Surface*>::const_iterator
+			i  = _unitFrames.begin();
+			i != _unitFrames.end();
+			++i)
+	{
+		delete i->second;
+	}
+	_unitFrames.clear();
+}
+
 /**
  * Puts a Projectile on this Map.
  * @param projectile - projectile to place (default nullptr)
@@ -3216,6 +4118,25 @@ bool Map::getMapHidden() const
 	return _mapIsHidden;
 }
 
+/**
+ * Checks if the current action would be drawn behind the hidden-movement
+ * screen.
+ * @note This is the same test that draw() uses to reveal or hide the
+ * battlefield. Projectiles and explosions always reveal it.
+ * @return, true if there is nothing for the player to see
+ */
+bool Map::isActionHidden() const
+{
+	return _battleSave->getSelectedUnit() != nullptr
+		&& _battleSave->getSelectedUnit()->getUnitVisible() == false
+		&& _unitDying == false
+		&& _explosions.empty() == true
+		&& _projectile == nullptr
+		&& _reveal == false // stop flashing the Hidden Movement screen between waypoints and/or autoshots.
+		&& _te->isReaction() == false
+		&& _battleSave->getDebugTac() == false;
+}
+
 /**
  * Gets the SavedBattleGame.
  * @return, pointer to SavedBattleGame
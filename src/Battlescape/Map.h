@@ -20,9 +20,11 @@
 #ifndef OPENXCOM_MAP_H
 #define OPENXCOM_MAP_H
 
+#include <cstdint>	// uint64_t
 //#include <vector>
 
 #include "Position.h"
+#include "UnitSprite.h"
 
 #include "../Engine/Options.h"
 #include "../Engine/InteractiveSurface.h"
@@ -101,6 +103,27 @@ private:
 		ACU_RED		= 35u,
 		ACU_GREEN	= 51u;
 
+	static const size_t UNIT_FRAMES_MAX = 512u; // max composited unit-frames to keep for sharing
+
+	static const int
+		CACHE_CHUNK      = 32,	// edge in pixels of the screen-chunks that are redrawn or kept
+		BANDS_PER_THREAD =  2;	// screen-bands per thread when drawing threaded so that busy bands even out
+
+	/**
+	 * A sprite-blit that drawTerrain() records for threaded rasterizing.
+	 */
+	struct DrawOp
+	{
+		Surface* sprite;
+		int
+			x,y,
+			colorOffset,
+			colorGroup;
+		bool
+			halfRight,
+			halfLeft;
+	};
+
 	static const Uint32
 		SCROLL_INTERVAL	= 15u,
 
@@ -111,17 +134,21 @@ private:
 
 	bool
 		_bulletStart,
+		_cacheValid,
 		_explosionInFOV,
 		_flashScreen,
 		_mapIsHidden,
 		_noDraw,
 		_projectileInFOV,
+		_recording,
 		_reveal,
 		_showProjectile,
 		_smoothingEngaged,
 		_unitDying;
 	int
 		_aniCycle,
+		_cacheChunksX,
+		_cacheChunksY,
 		_selectorSize,
 		_toolbarHeight,
 		_toolbarWidth,
@@ -135,6 +162,12 @@ private:
 		_playableHeight;
 	Uint8
 		_fuseColor;
+	size_t
+		_aniUnitsTally,
+		_drawBands;
+	uint64_t _cacheKey;
+
+	Position _cacheOffset;
 
 	PathPreview _previewSetting;
 
@@ -153,6 +186,9 @@ private:
 	Surface
 		* _arrow,
 		* _arrow_kneel,
+		* _drawTarget,
+		* _srfCache,
+		* _srfCheck,
 		* _srfCross,
 		* _srfFuse,
 		* _srfRookiBadge;
@@ -162,9 +198,16 @@ private:
 	Timer
 		* _scrollMouseTimer,
 		* _scrollKeyTimer;
+	UnitSprite* _unitSprite;
 
 	std::list<Explosion*> _explosions;
+	std::map<UnitSpriteKey, Surface*> _unitFrames;
+	std::vector<BattleUnit*> _aniUnits;
 	std::vector<Position> _waypoints;
+	std::vector<uint64_t> _tileSigs;
+	std::vector<Uint8> _chunkDirty;
+	std::vector<DrawOp> _drawOps;
+	std::vector<Surface*> _drawCopies;
 
 	/// Draws a battleunit. new Yankes' funct.
 /*	void drawUnit(
@@ -175,9 +218,67 @@ private:
 			int shade,
 			bool isTopLayer); */
 	/// Draws the battlefield.
-	void drawTerrain(Surface* const surface);
+	void drawTerrain(
+			Surface* const surface,
+			bool dirtyOnly = false);
+	/// Draws the battlefield on the WorkerPool's threads.
+	void rasterTerrain(
+			Surface* const surface,
+			bool dirtyOnly = false);
+	/// Draws the recorded sprite-blits that touch a screen-band.
+	static void rasterBand(
+			void* data,
+			size_t band);
+	/// Blits a sprite or records it for threaded rasterizing.
+	void blitSprite(
+			Surface* const surface,
+			Surface* const sprite,
+			int x,
+			int y,
+			int colorOffset = 0,
+			bool halfRight = false,
+			int colorGroup = 0,
+			bool halfLeft = false);
+	/// Blits a NumberText or records a copy of it for threaded rasterizing.
+	void blitNumber(
+			Surface* const surface,
+			NumberText* const number,
+			int x,
+			int y,
+			int colorOffset = 0,
+			bool halfRight = false,
+			int colorGroup = 0);
+	/// Gets the rough boundaries of the tiles to draw.
+	void getDrawBounds(
+			const Surface* const surface,
+			int viewLevel,
+			int* beginX,
+			int* beginY,
+			int* endX,
+			int* endY,
+			int* endZ) const;
+
+	/// Redraws only the parts of the battlefield that changed since the last draw.
+	void drawTerrainCached();
+	/// Updates the signatures of the tiles in the viewport.
+	void hashTiles(bool markDirty);
+	/// Hashes what drawTerrain() draws for a Tile that isn't animated.
+	uint64_t getTileSignature(const Tile* const tile) const;
+	/// Hashes the state that affects all tiles on the Map.
+	uint64_t getCacheKey() const;
+	/// Marks the screen-chunks that a Tile can draw on as dirty.
+	void dirtyTileArea(const Position& posScreen);
+	/// Checks if a Tile can draw on a dirty screen-chunk.
+	bool isTileAreaDirty(const Position& posScreen) const;
+	/// Shifts the pixels of the Map by a camera-scroll.
+	void scrollPixels(
+			int dx,
+			int dy);
+	/// Deletes the composited unit-frames that are kept for sharing.
+	void clearUnitFrames();
 	/// Draws a Soldier's rank-icon above its sprite on the Map.
 	void drawRankIcon(
+			Surface* const surface,
 			const BattleUnit* const unit,
 			int offset_x,
 			int offset_y,
@@ -330,6 +431,8 @@ private:
 		void setNoDraw(bool noDraw = true);
 		/// Gets if the hidden-movement screen is displayed.
 		bool getMapHidden() const;
+		/// Checks if the current action would be drawn behind the hidden-movement screen.
+		bool isActionHidden() const;
 
 		/// Gets the SavedBattleGame.
 		SavedBattleGame* getBattleSave() const;
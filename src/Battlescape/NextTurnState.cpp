@@ -21,6 +21,7 @@
 
 //#include <sstream>
 
+#include "BattleBench.h"
 #include "BattlescapeGame.h"			// for terrain explosions
 #include "BattlescapeState.h"
 #include "ExplosionBState.h"			// for terrain explosions
@@ -68,8 +69,9 @@ NextTurnState::NextTurnState(
 	//Log(LOG_INFO) << "NextTurnState:cTor";
 	switch (_battleSave->getSide())
 	{
-		case FACTION_PLAYER:					// in case a Hostile/Neutral unit just revealed the screen
-			SDL_Delay(Screen::SCREEN_PAUSE);	// sustain the reveal.
+		case FACTION_PLAYER:						// in case a Hostile/Neutral unit just revealed the screen
+			if (Options::headless == false)
+				SDL_Delay(Screen::SCREEN_PAUSE);	// sustain the reveal.
 			break;
 
 		case FACTION_HOSTILE:
@@ -170,6 +172,20 @@ void NextTurnState::handle(Action* action)
 	}
 }
 
+/**
+ * Starts the next turn at once if the battle is being benched.
+ */
+void NextTurnState::think()
+{
+	State::think();
+
+	if (BattleBench::isActive() == true)
+	{
+		_state->updateTurnText();
+		nextTurn();
+	}
+}
+
 /**
  * Does turn-start stuff.
  */
@@ -207,6 +223,7 @@ void NextTurnState::nextTurn() // private.
 
 				const int turn (_battleSave->getTurn());
 				if (_battleSave->getSide() == FACTION_PLAYER
+					&& BattleBench::isActive() == false
 					&& (turn == 1 || (turn % Options::autosaveFrequency) == 0))
 				{
 					_state->requestAutosave(); // NOTE: Auto-save points are fucked; they should be done *before* important events, not after.
@@ -68,6 +68,8 @@ private:
 
 		/// Handler for clicking anything.
 		void handle(Action* action) override;
+		/// Starts the next turn at once if the battle is being benched.
+		void think() override;
 
 		///
 //		void resize(int& dX, int& dY);
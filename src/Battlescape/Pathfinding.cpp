@@ -28,6 +28,7 @@
 #include "PathfindingOpenSet.h"
 
 #include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
 
 #include "../Ruleset/RuleArmor.h"
 
@@ -66,7 +67,12 @@ Pathfinding::Pathfinding(SavedBattleGame* const battleSave)
 		_alt(false),
 		_zPath(false),
 		_mType(MT_WALK),
-		_doorCost(0)
+		_doorCost(0),
+		_fieldCap(0),
+		_fieldSig(0uLL),
+		_fieldTu(battleSave->getMapSizeXYZ(), TU_INFINITE),
+		_fieldPrior(battleSave->getMapSizeXYZ(), -1),
+		_fieldDir(battleSave->getMapSizeXYZ(), -1)
 //		_tuFirst(-1)
 {
 	//Log(LOG_INFO) << "Create Pathfinding";
@@ -190,6 +196,8 @@ void Pathfinding::calculatePath(
 		const BattleUnit* const launchTarget,
 		bool strafeRejected)
 {
+	const ProfileScope scope (PZ_PATHFINDING);
+
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "pf:calculatePath() id-" << unit->getId();
 	//Log(LOG_INFO) << ". posStop " << posStop;
@@ -389,7 +397,19 @@ void Pathfinding::calculatePath(
 //		const bool sneak (Options::sneakyAI == true
 //					   && _unit->getFaction() == FACTION_HOSTILE);
 
-		if (aStarPath(
+		const bool useField (launchTarget == nullptr // the player's selected unit paths from its reachability-field when it can
+						  && _strafe == false
+						  && _zPath == false
+						  && _unit->getFaction() == FACTION_PLAYER
+						  && _battleSave->getSide() == FACTION_PLAYER);
+		if (useField == true)
+			updateReachField(_unit);
+
+		if ((useField == true
+				&& fieldPath(
+						posStop,
+						tuCap) == true)
+			|| aStarPath(
 					posStart,
 					posStop,
 					launchTarget,
@@ -593,7 +613,8 @@ int Pathfinding::getTuFirst() const
 
 /**
  * Locates all tiles reachable to @a unit with a TU-cost no more than @a tuCap.
- * @note Uses Dijkstra's algorithm.
+ * @note Uses Dijkstra's algorithm. The costs and the prior tiles are also kept
+ * as the reachability-field of the unit for calculatePath() - see fieldPath().
  * @sa aStarPath().
  * @param unit	- pointer to a BattleUnit
  * @param tuCap	- maximum turn units the path can cost
@@ -604,6 +625,8 @@ std::vector<size_t> Pathfinding::findReachable(
 		const BattleUnit* const unit,
 		int tuCap)
 {
+	const ProfileScope scope (PZ_PATHFINDING);
+
 	for (std::vector<PathfindingNode>::iterator
 			i = _nodes.begin();
 			i != _nodes.end();
@@ -669,6 +692,31 @@ std::vector<size_t> Pathfinding::findReachable(
 		nodes.push_back(nodeCurrent);
 	}
 
+	std::fill(_fieldTu.begin(), _fieldTu.end(), TU_INFINITE);
+
+	size_t tileId;
+	for (std::vector<PathfindingNode*>::const_iterator
+			i  = nodes.begin();
+			i != nodes.end();
+			++i)
+	{
+		tileId = _battleSave->getTileIndex((*i)->getPosition());
+		_fieldTu[tileId] = (*i)->getTuCostTill();
+		if ((*i)->getPriorNode() != nullptr)
+		{
+			_fieldPrior[tileId] = static_cast<int>(_battleSave->getTileIndex((*i)->getPriorNode()->getPosition()));
+			_fieldDir[tileId] = static_cast<signed char>((*i)->getPriorDir());
+		}
+		else
+			_fieldPrior[tileId] = -1;
+	}
+
+	_fieldCap = tuCap;
+	if (_strafe == false) // strafing adds turning-costs that depend on the unit's facing
+		_fieldSig = getFieldSig(unit, tuCap);
+	else
+		_fieldSig = 0uLL;
+
 	std::sort(
 			nodes.begin(),
 			nodes.end(),
@@ -687,6 +735,109 @@ std::vector<size_t> Pathfinding::findReachable(
 	return nodeList;
 }
 
+/**
+ * Refloods the reachability-field of a unit if it is out of date.
+ * @note The field is the set of tiles that the unit can reach with its current
+ * TU and energy. It goes out of date when the unit's position, TU, energy or
+ * movement-type change or when any Tile's parts, fire or unit change.
+ * @param unit - pointer to a BattleUnit
+ */
+void Pathfinding::updateReachField(const BattleUnit* const unit)
+{
+	if (_fieldSig == 0uLL
+		|| _fieldCap != unit->getTu()
+		|| _fieldSig != getFieldSig(unit, unit->getTu()))
+	{
+		findReachable(unit, unit->getTu());
+	}
+}
+
+/**
+ * Mixes a value into a hash.
+ * @param sig - the hash so far
+ * @param val - the value to mix in
+ * @return, the hash
+ */
+static inline uint64_t mixSig(
+		uint64_t sig,
+		uint64_t val)
+{
+	return (sig ^ val) * 1099511628211uLL; // FNV-1a prime
+}
+
+/**
+ * Hashes the state that the reachability-field depends on.
+ * @note The BattleUnits are hashed for the status and visibility that
+ * isBlockedTile() checks and for the kneeling that changes their height to a
+ * flyer above; their positions are covered by Tile::getStamp().
+ * @param unit	- pointer to the BattleUnit that the field is for
+ * @param tuCap	- maximum TU that the field was flooded with
+ * @return, the signature - never 0
+ */
+uint64_t Pathfinding::getFieldSig( // private.
+		const BattleUnit* const unit,
+		int tuCap) const
+{
+	uint64_t sig (14695981039346656037uLL);
+	sig = mixSig(sig, reinterpret_cast<uintptr_t>(unit));
+	sig = mixSig(sig, static_cast<uint64_t>(_battleSave->getTileIndex(unit->getPosition())));
+	sig = mixSig(sig, static_cast<uint64_t>(tuCap));
+	sig = mixSig(sig, static_cast<uint64_t>(unit->getEnergy()));
+	sig = mixSig(sig, static_cast<uint64_t>(_mType));
+	sig = mixSig(sig, static_cast<uint64_t>(_alt));
+	sig = mixSig(sig, static_cast<uint64_t>(Tile::getStamp()));
+
+	for (std::vector<BattleUnit*>::const_iterator
+			i  = _battleSave->getUnits()->begin();
+			i != _battleSave->getUnits()->end();
+			++i)
+	{
+		sig = mixSig(sig, static_cast<uint64_t>((*i)->getUnitStatus())
+						| static_cast<uint64_t>((*i)->getUnitVisible()) << 8u
+						| static_cast<uint64_t>((*i)->isKneeled())      << 9u
+						| static_cast<uint64_t>((*i)->getFaction())     << 10u);
+	}
+
+	if (sig == 0uLL) sig = 1uLL; // 0 is reserved for "invalid"
+	return sig;
+}
+
+/**
+ * Builds the path to a Position from the reachability-field.
+ * @note Helper for calculatePath(). The field holds the cheapest cost to every
+ * tile in reach so the path costs the same as the one aStarPath() would find
+ * although it can differ between routes of equal cost.
+ * @param posStop	- reference to the Position to path to
+ * @param tuCap		- maximum TU that the path can cost
+ * @return, true if the field is current and has a path to the Position
+ */
+bool Pathfinding::fieldPath( // private.
+		const Position& posStop,
+		int tuCap)
+{
+	if (_fieldSig == 0uLL
+		|| _fieldSig != getFieldSig(_unit, _fieldCap))
+	{
+		return false;
+	}
+
+	const size_t tileId (_battleSave->getTileIndex(posStop));
+	if (_fieldTu[tileId] == TU_INFINITE || _fieldTu[tileId] > tuCap)
+		return false;
+
+	_path.clear();
+	for (int
+			i = static_cast<int>(tileId);
+			_fieldPrior[static_cast<size_t>(i)] != -1;
+			i = _fieldPrior[static_cast<size_t>(i)])
+	{
+		_path.push_back(static_cast<int>(_fieldDir[static_cast<size_t>(i)]));
+	}
+
+	_tuCostTally = _fieldTu[tileId];
+	return true;
+}
+
 /**
  * Gets the PathfindingNode at a specified Position.
  * @param pos - reference to a Position
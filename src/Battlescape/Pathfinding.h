@@ -20,6 +20,7 @@
 #ifndef OPENXCOM_PATHFINDING_H
 #define OPENXCOM_PATHFINDING_H
 
+#include <cstdint>	// uint64_t
 //#include <vector> // std::vector
 
 #include "PathfindingNode.h"
@@ -62,8 +63,10 @@ private:
 		_zPath;
 	int
 		_doorCost, // to get an accurate preview when dashing through doors etc.
+		_fieldCap,
 		_tuCostTally;
 //		_tuFirst,
+	uint64_t _fieldSig; // 0 if the reachability-field is invalid
 
 	BattleUnit* _unit;
 	const SavedBattleGame* _battleSave;
@@ -76,6 +79,11 @@ private:
 
 	std::vector<PathfindingNode> _nodes;
 
+	std::vector<int>
+		_fieldTu,		// TU-cost to reach each tile-index - TU_INFINITE if unreachable
+		_fieldPrior;	// tile-index of the prior tile on the path to each tile - -1 at the start
+	std::vector<signed char> _fieldDir; // direction from the prior tile
+
 	/// Sets the movement-type.
 	void setMoveType();
 
@@ -95,6 +103,15 @@ private:
 	/// Gets the PathfindingNode at a specified Position.
 	PathfindingNode* getPfNode(const Position& pos);
 
+	/// Hashes the state that the reachability-field depends on.
+	uint64_t getFieldSig(
+			const BattleUnit* const unit,
+			int tuCap) const;
+	/// Builds the path to a Position from the reachability-field.
+	bool fieldPath(
+			const Position& posStop,
+			int tuCap);
+
 	/// Gets the TU-cost for crossing over walls.
 	int getWallTuCost(
 			int dir,
@@ -163,6 +180,8 @@ private:
 		std::vector<size_t> findReachable(
 				const BattleUnit* const unit,
 				int tuCap);
+		/// Refloods the reachability-field of a unit if it is out of date.
+		void updateReachField(const BattleUnit* const unit);
 
 		/// Gets the TU-cost to move from 1 tile to the other.
 		int getTuCostPf(
@@ -28,6 +28,7 @@
 
 //#include "../Engine/Logger.h"
 //#include "../Engine/Options.h"
+#include "../Engine/ObjectPool.h"
 #include "../Engine/RNG.h"
 #include "../Engine/SurfaceSet.h"
 
@@ -47,6 +48,8 @@
 namespace OpenXcom
 {
 
+ObjectPool Projectile::_pool (sizeof(Projectile), 16u); // static/private.
+
 Position Projectile::targetVoxel_cache; // static across all Projectile invokations <-
 
 const double Projectile::PCT = 0.01;
@@ -142,6 +145,28 @@ Projectile::Projectile(
 Projectile::~Projectile()
 {}
 
+/**
+ * Gets memory for a Projectile from its ObjectPool.
+ * @param size - size of the object
+ * @return, pointer to the memory
+ */
+void* Projectile::operator new(size_t size) // static.
+{
+	return _pool.allocate(size);
+}
+
+/**
+ * Returns the memory of a Projectile to its ObjectPool.
+ * @param block	- pointer to the memory
+ * @param size	- size of the object
+ */
+void Projectile::operator delete( // static.
+		void* block,
+		size_t size)
+{
+	_pool.release(block, size);
+}
+
 /**
  * Calculates the trajectory for a straight/line path.
  * @note Accuracy affects the VoxelType result. This is a wrapper for
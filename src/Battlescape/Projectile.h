@@ -34,6 +34,7 @@ namespace OpenXcom
 {
 
 class BattleItem;
+class ObjectPool;
 class ResourcePack;
 class SavedBattleGame;
 class Surface;
@@ -50,6 +51,8 @@ class Projectile
 {
 
 private:
+	static ObjectPool _pool;
+
 	static const double PCT;
 	static Position targetVoxel_cache;
 
@@ -102,6 +105,13 @@ private:
 		/// Cleans up the Projectile.
 		~Projectile();
 
+		/// Gets memory for a Projectile from its ObjectPool.
+		static void* operator new(size_t size);
+		/// Returns the memory of a Projectile to its ObjectPool.
+		static void operator delete(
+				void* block,
+				size_t size);
+
 		/// Calculates the trajectory of a line-path for a non-BL weapon.
 		VoxelType calculateShot(double accuracy);
 		/// Calculates the trajectory of a line-path for a Blaster Launch.
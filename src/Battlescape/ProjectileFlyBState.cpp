@@ -24,6 +24,7 @@
 #include "../fmath.h"
 
 #include "AlienBAIState.h"
+#include "BattleBench.h"
 #include "BattlescapeState.h"
 #include "Camera.h"
 #include "Explosion.h"
@@ -35,7 +36,7 @@
 
 #include "../Engine/Game.h"
 //#include "../Engine/Logger.h"
-//#include "../Engine/Options.h"
+#include "../Engine/Options.h"
 #include "../Engine/RNG.h"
 #include "../Engine/Screen.h"
 #include "../Engine/Sound.h"
@@ -572,7 +573,7 @@ bool ProjectileFlyBState::createProjectile() // private.
 			case VOXEL_WESTWALL:
 			case VOXEL_NORTHWALL:
 				//Log(LOG_INFO) << ". . VALID";
-				if (_unit->getFaction() != FACTION_PLAYER
+				if ((_unit->getFaction() != FACTION_PLAYER || BattleBench::isActive() == true)
 					&& _weapon->getRules()->isGrenade() == true)
 				{
 					//Log(LOG_INFO) << ". . auto-prime for AI, unitID " << _unit->getId();
@@ -808,8 +809,9 @@ void ProjectileFlyBState::think()
 				case BA_SNAPSHOT:
 				case BA_AIMEDSHOT:
 					//if (debug) Log(LOG_INFO) << "FlyB: . stored posCamera " << _action.posCamera;
-					if (_action.posCamera.z != -1
-						|| _battle->getTileEngine()->isReaction() == true)
+					if (Options::headless == false
+						&& (_action.posCamera.z != -1
+							|| _battle->getTileEngine()->isReaction() == true))
 					{
 						//if (debug) Log(LOG_INFO) << "FlyB: . . setting Camera to shooter pos";
 						Camera* const shotCamera (_battle->getMap()->getCamera());
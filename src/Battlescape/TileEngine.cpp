@@ -40,8 +40,10 @@
 #include "../Engine/Language.h"
 //#include "../Engine/Logger.h"
 //#include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
 #include "../Engine/RNG.h"
 #include "../Engine/Sound.h"
+#include "../Engine/WorkerPool.h"
 
 #include "../Resource/ResourcePack.h"
 
@@ -50,6 +52,7 @@
 
 #include "../Savegame/BattleUnit.h"
 #include "../Savegame/SavedGame.h"
+#include "../Savegame/UnitTable.h"
 
 
 namespace OpenXcom
@@ -84,10 +87,13 @@ TileEngine::TileEngine(
 		_spotSound(true),
 		_trueTile(nullptr),
 		_dirRay(-1),
-		_isReaction(false)
+		_isReaction(false),
 //		_missileDirection(-1)
+		_rayDepth(0),
+		_rayStamp(0u)
 {
 	_rfAction = new BattleAction();
+	clearReactors();
 }
 
 /**
@@ -104,16 +110,14 @@ TileEngine::~TileEngine()
  */
 void TileEngine::calculateSunShading() const
 {
-	Tile* tile;
-	for (size_t // reset and re-calculate sunlight.
-			i = 0u;
-			i != _battleSave->getMapSizeXYZ();
-			++i)
-	{
-		tile = _battleSave->getTiles()[i];
-		tile->resetLight(LIGHT_LAYER_AMBIENT);
-		calculateSunShading(tile);
-	}
+	const ProfileScope scope (PZ_LIGHTING);
+
+	LightPass pass;
+	pass.te = this;
+	pass.bands = getLightBands();
+	pass.sources = nullptr;
+
+	WorkerPool::run(shadeBand, &pass, pass.bands); // reset and re-calculate sunlight.
 }
 
 /**
@@ -175,16 +179,13 @@ void TileEngine::calculateSunShading(Tile* const tile) const
  */
 void TileEngine::calculateTerrainLighting() const
 {
-	for (size_t // reset.
-			i = 0u;
-			i != _battleSave->getMapSizeXYZ();
-			++i)
-	{
-		_battleSave->getTiles()[i]->resetLight(LIGHT_LAYER_STATIC);
-	}
+	const ProfileScope scope (PZ_LIGHTING);
+
+	std::vector<LightSource> sources;
+	LightSource source;
 
 	int light;
-	Tile* tile;
+	const Tile* tile;
 
 	for (size_t
 			i = 0u;
@@ -224,10 +225,157 @@ void TileEngine::calculateTerrainLighting() const
 			}
 		}
 
-		addLight(
-				tile->getPosition(),
-				light,
-				LIGHT_LAYER_STATIC);
+		if (light != 0) // a zero-power source adds nothing
+		{
+			source.pos = tile->getPosition();
+			source.power = light;
+			sources.push_back(source);
+		}
+	}
+
+	LightPass pass;
+	pass.te = this;
+	pass.bands = getLightBands();
+	pass.sources = &sources;
+
+	WorkerPool::run(lightBand, &pass, pass.bands);
+}
+
+/**
+ * Gets the quantity of bands for a lighting-pass.
+ * @return, quantity of bands
+ */
+size_t TileEngine::getLightBands() const // private.
+{
+	return std::max(static_cast<size_t>(1u),
+					std::min(WorkerPool::getThreads() * LIGHT_BANDS_PER_THREAD,
+							 static_cast<size_t>(_battleSave->getMapSizeY())));
+}
+
+/**
+ * Gets the rows of a band of a lighting-pass.
+ * @param band		- the band
+ * @param bands		- quantity of bands
+ * @param rowBegin	- pointer to the first row of the band
+ * @param rowEnd	- pointer to the row past the last row of the band
+ */
+void TileEngine::getBandRows( // private.
+		size_t band,
+		size_t bands,
+		int* const rowBegin,
+		int* const rowEnd) const
+{
+	const size_t rows (static_cast<size_t>(_battleSave->getMapSizeY()));
+	*rowBegin = static_cast<int>(band * rows / bands);
+	*rowEnd   = static_cast<int>((band + 1u) * rows / bands);
+}
+
+/**
+ * Calculates sun-shading of a band of the battlefield.
+ * @note Runs on the WorkerPool. Each Tile is shaded from the Tiles above it
+ * only so the bands are independent.
+ * @param data	- pointer to the LightPass
+ * @param band	- the band
+ */
+void TileEngine::shadeBand( // static/private.
+		void* data,
+		size_t band)
+{
+	const LightPass& pass (*static_cast<const LightPass*>(data));
+	const SavedBattleGame* const battleSave (pass.te->_battleSave);
+
+	int
+		rowBegin,
+		rowEnd;
+	pass.te->getBandRows(
+					band,
+					pass.bands,
+					&rowBegin,
+					&rowEnd);
+
+	Tile* tile;
+	for (int
+			z = 0;
+			z != battleSave->getMapSizeZ();
+			++z)
+	{
+		for (int
+				y = rowBegin;
+				y != rowEnd;
+				++y)
+		{
+			for (int
+					x = 0;
+					x != battleSave->getMapSizeX();
+					++x)
+			{
+				tile = battleSave->getTile(Position(x,y,z));
+				tile->resetLight(LIGHT_LAYER_AMBIENT);
+				pass.te->calculateSunShading(tile);
+			}
+		}
+	}
+}
+
+/**
+ * Calculates terrain-lighting of a band of the battlefield.
+ * @note Runs on the WorkerPool. Every band applies all the light-sources that
+ * reach it but lights only its own rows; a Tile keeps the brightest light that
+ * reaches it so the result doesn't depend on the order of the sources.
+ * @param data	- pointer to the LightPass
+ * @param band	- the band
+ */
+void TileEngine::lightBand( // static/private.
+		void* data,
+		size_t band)
+{
+	const LightPass& pass (*static_cast<const LightPass*>(data));
+	const SavedBattleGame* const battleSave (pass.te->_battleSave);
+
+	int
+		rowBegin,
+		rowEnd;
+	pass.te->getBandRows(
+					band,
+					pass.bands,
+					&rowBegin,
+					&rowEnd);
+
+	for (int // reset.
+			z = 0;
+			z != battleSave->getMapSizeZ();
+			++z)
+	{
+		for (int
+				y = rowBegin;
+				y != rowEnd;
+				++y)
+		{
+			for (int
+					x = 0;
+					x != battleSave->getMapSizeX();
+					++x)
+			{
+				battleSave->getTile(Position(x,y,z))->resetLight(LIGHT_LAYER_STATIC);
+			}
+		}
+	}
+
+	for (std::vector<LightSource>::const_iterator
+			i  = pass.sources->begin();
+			i != pass.sources->end();
+			++i)
+	{
+		if (   i->pos.y + i->power >= rowBegin
+			&& i->pos.y - i->power <  rowEnd)
+		{
+			pass.te->addLight(
+							i->pos,
+							i->power,
+							LIGHT_LAYER_STATIC,
+							rowBegin,
+							rowEnd);
+		}
 	}
 }
 
@@ -236,6 +384,8 @@ void TileEngine::calculateTerrainLighting() const
  */
 void TileEngine::calculateUnitLighting() const
 {
+	const ProfileScope scope (PZ_LIGHTING);
+
 	for (size_t // reset all light to 0 first
 			i = 0u;
 			i != _battleSave->getMapSizeXYZ();
@@ -297,20 +447,37 @@ void TileEngine::togglePersonalLighting()
 /**
  * Adds a circular light-pattern starting from @a pos and losing power
  * proportional to distance.
- * @param pos	- reference to the center-position in tile-space
- * @param power	- power of light
- * @param layer	- light is separated in 3 layers: Ambient, Static, and Dynamic
+ * @param pos		- reference to the center-position in tile-space
+ * @param power		- power of light
+ * @param layer		- light is separated in 3 layers: Ambient, Static, and Dynamic
+ * @param rowBegin	- the first row that gets lit (default 0)
+ * @param rowEnd	- the row past the last row that gets lit (default -1 all rows)
  */
 void TileEngine::addLight( // private.
 		const Position& pos,
 		int power,
-		size_t layer) const
+		size_t layer,
+		int rowBegin,
+		int rowEnd) const
 {
+	static const int reflect[4u][2u] // loop through the positive quadrant only - reflect that onto the other quadrants.
+	{
+		{ 1, 1},
+		{-1,-1},
+		{ 1,-1},
+		{-1, 1}
+	};
+
+	if (rowEnd == -1)
+		rowEnd = _battleSave->getMapSizeY();
+
 	Tile* tile;
-	int light;
+	int
+		light,
+		y_lit;
 	double dZ;
 
-	for (int // loop through the positive quadrant only - reflect that onto the other quadrants.
+	for (int
 			x = 0;
 			x <= power;
 			++x)
@@ -329,25 +496,21 @@ void TileEngine::addLight( // private.
 				light = power
 					  - static_cast<int>(Round(std::sqrt(static_cast<double>(x * x + y * y) + dZ * dZ)));
 
-				if ((tile = _battleSave->getTile(Position(
-														pos.x + x,
-														pos.y + y,
-														z))) != nullptr) tile->addLight(light, layer);
-
-				if ((tile = _battleSave->getTile(Position(
-														pos.x - x,
-														pos.y - y,
-														z))) != nullptr) tile->addLight(light, layer);
-
-				if ((tile = _battleSave->getTile(Position(
-														pos.x + x,
-														pos.y - y,
-														z))) != nullptr) tile->addLight(light, layer);
-
-				if ((tile = _battleSave->getTile(Position(
-														pos.x - x,
-														pos.y + y,
-														z))) != nullptr) tile->addLight(light, layer);
+				for (size_t
+						i = 0u;
+						i != 4u;
+						++i)
+				{
+					if ((y_lit = pos.y + y * reflect[i][1u]) >= rowBegin
+						&& y_lit < rowEnd
+						&& (tile = _battleSave->getTile(Position(
+																pos.x + x * reflect[i][0u],
+																y_lit,
+																z))) != nullptr)
+					{
+						tile->addLight(light, layer);
+					}
+				}
 			}
 		}
 	}
@@ -355,11 +518,14 @@ void TileEngine::addLight( // private.
 
 /**
  * Calculates FoV vs units for a single BattleUnit.
+ * @note The other units are tested from the rows of the UnitTable.
  * @param unit - pointer to a BattleUnit
  * @return, true if previously concealed units are spotted
  */
 bool TileEngine::calcFovUnits(BattleUnit* const unit) const
 {
+	const ProfileScope scope (PZ_FOV);
+
 	//if (unit->getId() == 1000000) Log(LOG_INFO) << "CALC_FOV_UNITS id-" << unit->getId();
 
 	unit->clearHostileUnits();
@@ -379,26 +545,26 @@ bool TileEngine::calcFovUnits(BattleUnit* const unit) const
 		else
 			soundId = -1;
 
-		Position
-			posOther,
-			pos;
+		UnitTable* const table (_battleSave->getUnitTable());
+		const UnitTable::Sweep sweep (table);
+		const std::vector<UnitTable::Row>& rows (table->getRows());
 
+		Position pos;
 		int otherSize;
 
 		switch (unit->getFaction())
 		{
 			case FACTION_PLAYER:
-				for (std::vector<BattleUnit*>::const_iterator
-						i = _battleSave->getUnits()->begin(), j = _battleSave->getUnits()->end();
-						i != j;
+				for (size_t
+						i = 0u;
+						i != rows.size();
 						++i)
 				{
-					if ((*i)->getFaction() != FACTION_PLAYER
-						&& (*i)->getUnitTile() != nullptr) // otherUnit is standing.
+					const UnitTable::Row& row (rows[i]);
+					if (row.faction != FACTION_PLAYER
+						&& (row.flags & UnitTable::RF_ONMAP) != 0u) // otherUnit is standing.
 					{
-						posOther = (*i)->getPosition();
-
-						otherSize = (*i)->getArmor()->getSize();
+						otherSize = row.size;
 						for (int
 								x = 0;
 								x != otherSize;
@@ -409,20 +575,20 @@ bool TileEngine::calcFovUnits(BattleUnit* const unit) const
 									y != otherSize;
 									++y)
 							{
-								pos = posOther + Position(x,y,0);
+								pos = row.pos + Position(x,y,0);
 
 								if (unit->checkViewSector(pos) == true
 									&& visible(unit, _battleSave->getTile(pos)) == true)
 								{
-									if ((*i)->getUnitVisible() == false)
+									if ((row.flags & UnitTable::RF_VISIBLE) == 0u)
 									{
-										(*i)->setUnitVisible();
+										table->setVisible(i);
 										spotByPlayer = true; // NOTE: This will halt a player's moving-unit when spotting a new Civie even.
 									}
 
-									if ((*i)->getFaction() == FACTION_HOSTILE)
+									if (row.faction == FACTION_HOSTILE)
 									{
-										unit->addToHostileUnits((*i)); // adds spottedUnit to '_hostileUnits' and to '_hostileUnitsThisTurn'
+										unit->addToHostileUnits(row.unit); // adds spottedUnit to '_hostileUnits' and to '_hostileUnitsThisTurn'
 
 										if (soundId != -1
 											&& spotByPlayer == true) // play aggro-sound if non-MC'd [huh] xCom unit spots a not-previously-visible hostile.
@@ -445,17 +611,15 @@ bool TileEngine::calcFovUnits(BattleUnit* const unit) const
 				break;
 
 			case FACTION_HOSTILE:
-				for (std::vector<BattleUnit*>::const_iterator
-						i = _battleSave->getUnits()->begin(), j = _battleSave->getUnits()->end();
-						i != j;
+				for (std::vector<UnitTable::Row>::const_iterator
+						i  = rows.begin();
+						i != rows.end();
 						++i)
 				{
-					if ((*i)->getFaction() != FACTION_HOSTILE
-						&& (*i)->getUnitTile() != nullptr) // otherUnit is standing.
+					if (i->faction != FACTION_HOSTILE
+						&& (i->flags & UnitTable::RF_ONMAP) != 0u) // otherUnit is standing.
 					{
-						posOther = (*i)->getPosition();
-
-						otherSize = (*i)->getArmor()->getSize();
+						otherSize = i->size;
 						for (int
 								x = 0;
 								x != otherSize;
@@ -466,16 +630,16 @@ bool TileEngine::calcFovUnits(BattleUnit* const unit) const
 									y != otherSize;
 									++y)
 							{
-								pos = posOther + Position(x,y,0);
+								pos = i->pos + Position(x,y,0);
 
 								if (unit->checkViewSector(pos) == true
 									&& visible(unit, _battleSave->getTile(pos)) == true)
 								{
-									spotByHostile = unit->addToHostileUnits(*i); // adds spottedUnit to '_hostileUnits' and to '_hostileUnitsThisTurn'
+									spotByHostile = unit->addToHostileUnits(i->unit); // adds spottedUnit to '_hostileUnits' and to '_hostileUnitsThisTurn'
 
 									if (_battleSave->getSide() == FACTION_HOSTILE)
-										(*i)->setExposed();	// NOTE: xCom agents can be seen by enemies but *not* become Exposed.
-															// Only potential reactionFire should set them Exposed during xCom's turn.
+										i->unit->setExposed();	// NOTE: xCom agents can be seen by enemies but *not* become Exposed.
+																// Only potential reactionFire should set them Exposed during xCom's turn.
 
 									x =
 									y = otherSize - 1; // stop.
@@ -506,6 +670,8 @@ bool TileEngine::calcFovUnits(BattleUnit* const unit) const
  */
 void TileEngine::calcFovTiles(const BattleUnit* const unit) const
 {
+	const ProfileScope scope (PZ_FOV);
+
 //	if (unit->getId() == 418) _debug = true;
 //	else _debug = false;
 //	if (_debug) Log(LOG_INFO) << "CALC_FOV_TILES id-" << unit->getId();
@@ -784,17 +950,20 @@ void TileEngine::calcFovUnits_pos(
 		UnitFaction faction)
 {
 	_spotSound = spotSound;
-	for (std::vector<BattleUnit*>::const_iterator
-			i = _battleSave->getUnits()->begin(), j = _battleSave->getUnits()->end();
-			i != j;
+
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable()); // the spotters' scans share one refresh
+	const std::vector<UnitTable::Row>& rows (_battleSave->getUnitTable()->getRows());
+	for (std::vector<UnitTable::Row>::const_iterator
+			i  = rows.begin();
+			i != rows.end();
 			++i)
 	{
-		if ((*i)->getUnitTile() != nullptr
-			&& ((*i)->getFaction() == faction
-				|| ((*i)->getFaction() != FACTION_NEUTRAL && faction == FACTION_NONE))
-			&& distSqr((*i)->getPosition(), pos) <= SIGHTDIST_TSp_Sqr)
+		if ((i->flags & UnitTable::RF_ONMAP) != 0u
+			&& (i->faction == faction
+				|| (i->faction != FACTION_NEUTRAL && faction == FACTION_NONE))
+			&& distSqr(i->pos, pos) <= SIGHTDIST_TSp_Sqr)
 		{
-			calcFovUnits(*i);
+			calcFovUnits(i->unit);
 		}
 	}
 	_spotSound = true;
@@ -807,16 +976,18 @@ void TileEngine::calcFovUnits_pos(
  */
 void TileEngine::calcFovTiles_pos(const Position& pos)
 {
-	for (std::vector<BattleUnit*>::const_iterator
-			i = _battleSave->getUnits()->begin(), j = _battleSave->getUnits()->end();
-			i != j;
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+	const std::vector<UnitTable::Row>& rows (_battleSave->getUnitTable()->getRows());
+	for (std::vector<UnitTable::Row>::const_iterator
+			i  = rows.begin();
+			i != rows.end();
 			++i)
 	{
-		if ((*i)->getFaction() == FACTION_PLAYER
-			&& (*i)->getUnitTile() != nullptr
-			&& distSqr((*i)->getPosition(), pos) <= SIGHTDIST_TSp_Sqr)
+		if (i->faction == FACTION_PLAYER
+			&& (i->flags & UnitTable::RF_ONMAP) != 0u
+			&& distSqr(i->pos, pos) <= SIGHTDIST_TSp_Sqr)
 		{
-			calcFovTiles(*i);
+			calcFovTiles(i->unit);
 		}
 	}
 }
@@ -831,15 +1002,18 @@ void TileEngine::calcFovTiles_pos(const Position& pos)
 void TileEngine::calcFovUnits_all(bool spotSound)
 {
 	_spotSound = spotSound;
-	for (std::vector<BattleUnit*>::const_iterator
-			i = _battleSave->getUnits()->begin(), j = _battleSave->getUnits()->end();
-			i != j;
+
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable()); // the spotters' scans share one refresh
+	const std::vector<UnitTable::Row>& rows (_battleSave->getUnitTable()->getRows());
+	for (std::vector<UnitTable::Row>::const_iterator
+			i  = rows.begin();
+			i != rows.end();
 			++i)
 	{
-		if ((*i)->getUnitTile() != nullptr
-			&& (*i)->getFaction() != FACTION_NEUTRAL)
+		if ((i->flags & UnitTable::RF_ONMAP) != 0u
+			&& i->faction != FACTION_NEUTRAL)
 		{
-			calcFovUnits(*i);
+			calcFovUnits(i->unit);
 		}
 	}
 	_spotSound = true;
@@ -850,15 +1024,17 @@ void TileEngine::calcFovUnits_all(bool spotSound)
  */
 void TileEngine::calcFovTiles_all()
 {
-	for (std::vector<BattleUnit*>::const_iterator
-			i = _battleSave->getUnits()->begin(), j = _battleSave->getUnits()->end();
-			i != j;
+	const UnitTable::Sweep sweep (_battleSave->getUnitTable());
+	const std::vector<UnitTable::Row>& rows (_battleSave->getUnitTable()->getRows());
+	for (std::vector<UnitTable::Row>::const_iterator
+			i  = rows.begin();
+			i != rows.end();
 			++i)
 	{
-		if ((*i)->getFaction() == FACTION_PLAYER
-			&& (*i)->getUnitTile() != nullptr)
+		if (i->faction == FACTION_PLAYER
+			&& (i->flags & UnitTable::RF_ONMAP) != 0u)
 		{
-			calcFovTiles(*i);
+			calcFovTiles(i->unit);
 		}
 	}
 }
@@ -1094,7 +1270,6 @@ bool TileEngine::doTargetUnit(
 		offsetX,
 		offsetY;
 
-	bool hypothetical;
 	if (targetUnit == nullptr)
 	{
 //		if ((targetUnit = tileTarget->getTileUnit()) == nullptr)
@@ -1103,13 +1278,11 @@ bool TileEngine::doTargetUnit(
 			//if (debug) Log(LOG_INFO) << ". no Unit, ret FALSE";
 			return false; // no unit in the tileTarget even if it's elevated and appearing in it. TODO: Could use getTargetUnit().
 		}
-		hypothetical = false;
 		offsetX =
 		offsetY = 0;
 	}
 	else
 	{
-		hypothetical = true;
 		offsetX = targetUnit->getPosition().x - tileTarget->getPosition().x;
 		offsetY = targetUnit->getPosition().y - tileTarget->getPosition().y;
 	}
@@ -1188,13 +1361,8 @@ bool TileEngine::doTargetUnit(
 		Log(LOG_INFO) << ". targetLow= " << targetLow;
 	} */
 
-	std::vector<Position> trj;
-	std::vector<int>
-		targetable_x,
-		targetable_y,
-		targetable_z;
-
-	VoxelType voxelType;
+	std::vector<Position> scanVoxels; // gather the scan-voxels and trace them in one batch
+	scanVoxels.reserve(static_cast<size_t>(height) * 5u);
 
 	for (size_t // scan from a horizontal center-line up and down using scanOffsetZ[]
 			i = 0u;
@@ -1203,12 +1371,6 @@ bool TileEngine::doTargetUnit(
 	{
 		if ((scanVoxel->z = targetMid + scanOffsetZ[i]) > -1) // account for probable truncation of (int)'targetMid'.
 		{
-/*			if (debug)
-			{
-				Log(LOG_INFO) << "";
-				Log(LOG_INFO) << ". . i= " << i << " scan.Z= " << scanVoxel->z << " (" << (scanVoxel->z / 24) << ")";
-			} */
-
 			for (size_t // scan from vertical center-line outwards left and right using scanOffsetXY[]
 					j  = 0u;
 					j != 5u;
@@ -1216,63 +1378,40 @@ bool TileEngine::doTargetUnit(
 			{
 				scanVoxel->x = targetVoxel.x + scanOffsetXY[j * 2u];
 				scanVoxel->y = targetVoxel.y + scanOffsetXY[j * 2u + 1u];
-/*				if (debug)
-				{
-					Log(LOG_INFO) << ". . . j= " << j;
-					Log(LOG_INFO) << ". . . scan.X= " << scanVoxel->x << " (" << (scanVoxel->x >> 4) << ")";
-					Log(LOG_INFO) << ". . . scan.Y= " << scanVoxel->y << " (" << (scanVoxel->y >> 4) << ")";
-				} */
+				scanVoxels.push_back(*scanVoxel);
+			}
+		}
+	}
 
-				trj.clear();
-				voxelType = plotLine(
-									*originVoxel,
-									*scanVoxel,
-									false,
-									&trj,
-									excludeUnit);
-/*				if (debug)
-				{
-					if (trj.empty() == false) Log(LOG_INFO) << ". . . . impact " << trj.at(0u) << " ts " << (trj.at(0u) / Position(16,16,24));
-					Log(LOG_INFO) << ". . . . impactType= " << MapData::debugVoxelType(voxelType);
-				} */
+	std::vector<VoxelType> voxelTypes;
+	std::vector<Position> impacts;
+	plotLines(
+			*originVoxel,
+			scanVoxels,
+			voxelTypes,
+			impacts,
+			excludeUnit);
 
-				switch (voxelType)
-				{
-					case VOXEL_UNIT:
-//						for (int // voxel of hit must be inside of scanned tileTarget(s)
-//								x = 0;
-//								x <= unitSize;
-//								++x)
-//						{
-//							if (debug) Log(LOG_INFO) << ". . . . iterate x-Size";
-//							for (int
-//									y = 0;
-//									y <= unitSize;
-//									++y)
-//						{
-//							if (debug) Log(LOG_INFO) << ". . . . . iterate y-Size";
-						if (   (trj.at(0u).x >> 4) == (scanVoxel->x >> 4) /*+ x*/ + offsetX
-							&& (trj.at(0u).y >> 4) == (scanVoxel->y >> 4) /*+ y*/ + offsetY
-							&&  trj.at(0u).z >= targetLow
-							&&  trj.at(0u).z <= targetHigh)
-						{
-							//if (debug) Log(LOG_INFO) << ". . . . . . TargetUnit found @ scanVoxel " << (*scanVoxel);
-							targetable_x.push_back(scanVoxel->x);
-							targetable_y.push_back(scanVoxel->y);
-							targetable_z.push_back(scanVoxel->z);
-						}
-//							}
-//						}
-						break;
+	std::vector<int>
+		targetable_x,
+		targetable_y,
+		targetable_z;
 
-					case VOXEL_EMPTY:
-						if (hypothetical == true && trj.empty() == false)
-						{
-							//if (debug) Log(LOG_INFO) << ". . . hypothetical Found, ret TRUE";
-							return true;
-						}
-				}
-			}
+	for (size_t
+			i = 0u;
+			i != scanVoxels.size();
+			++i)
+	{
+		if (voxelTypes[i] == VOXEL_UNIT // voxel of hit must be inside of scanned tileTarget(s)
+			&& (impacts[i].x >> 4) == (scanVoxels[i].x >> 4) + offsetX
+			&& (impacts[i].y >> 4) == (scanVoxels[i].y >> 4) + offsetY
+			&&  impacts[i].z >= targetLow
+			&&  impacts[i].z <= targetHigh)
+		{
+			//if (debug) Log(LOG_INFO) << ". . . . . . TargetUnit found @ scanVoxel " << scanVoxels[i];
+			targetable_x.push_back(scanVoxels[i].x);
+			targetable_y.push_back(scanVoxels[i].y);
+			targetable_z.push_back(scanVoxels[i].z);
 		}
 	}
 
@@ -1628,6 +1767,8 @@ bool TileEngine::checkReactionFire(
 		int actionTu,
 		bool quickSpot)
 {
+	const ProfileScope scope (PZ_REACTION);
+
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "TileEngine::checkReactionFire() vs id-" << triggerUnit->getId();
 	//Log(LOG_INFO) << ". actionTu = " << actionTu;
@@ -1717,9 +1858,19 @@ std::vector<BattleUnit*> TileEngine::getSpottingUnits(const BattleUnit* const un
 	const Tile* const tile (unit->getUnitTile());
 	std::vector<BattleUnit*> spotters;
 
+	const std::vector<BattleUnit*>* units;
+	if (_rfCandidates.unit == unit // test only the units gathered for a walk if it's still on its path
+		&& _rfCandidates.units == _battleSave->getUnits()->size()
+		&& isOnRfPath(unit->getPosition()) == true)
+	{
+		units = &_rfCandidates.reactors;
+	}
+	else
+		units = _battleSave->getUnits();
+
 	for (std::vector<BattleUnit*>::const_iterator
-			i  = _battleSave->getUnits()->begin();
-			i != _battleSave->getUnits()->end();
+			i  = units->begin();
+			i != units->end();
 			++i)
 	{
 		//Log(LOG_INFO) << ". check id-" << (*i)->getId();
@@ -1746,6 +1897,100 @@ std::vector<BattleUnit*> TileEngine::getSpottingUnits(const BattleUnit* const un
 	return spotters;
 }
 
+/**
+ * Gathers the units that could react to a unit along its path.
+ * @note Called when a unit starts to walk. getSpottingUnits() then tests only
+ * these units for as long as the walker is on a tile of the path - every other
+ * unit is beyond the sight-range of visible() at every tile of it. The test is
+ * done in x/y only so that rising and falling along the path are covered.
+ * @param unit	- pointer to the walking BattleUnit
+ * @param path	- reference to the path as held by Pathfinding (last step first)
+ */
+void TileEngine::gatherReactors(
+		const BattleUnit* const unit,
+		const std::vector<int>& path)
+{
+	_rfCandidates.unit = unit;
+	_rfCandidates.units = _battleSave->getUnits()->size();
+	_rfCandidates.cells.clear();
+	_rfCandidates.reactors.clear();
+
+	Position
+		pos (unit->getPosition().x, unit->getPosition().y, 0),
+		posVect;
+	_rfCandidates.cells.push_back(pos);
+
+	for (std::vector<int>::const_reverse_iterator
+			i  = path.rbegin();
+			i != path.rend();
+			++i)
+	{
+		if (*i < Pathfinding::DIR_UP)
+		{
+			Pathfinding::directionToVector(*i, &posVect);
+			pos.x += posVect.x;
+			pos.y += posVect.y;
+			_rfCandidates.cells.push_back(pos);
+		}
+	}
+
+	int
+		dx,
+		dy;
+	for (std::vector<BattleUnit*>::const_iterator
+			i  = _battleSave->getUnits()->begin();
+			i != _battleSave->getUnits()->end();
+			++i)
+	{
+		if (*i != unit)
+		{
+			for (std::vector<Position>::const_iterator
+					j  = _rfCandidates.cells.begin();
+					j != _rfCandidates.cells.end();
+					++j)
+			{
+				dx = (*i)->getPosition().x - j->x;
+				dy = (*i)->getPosition().y - j->y;
+				if (dx * dx + dy * dy <= SIGHTDIST_TSp_Sqr + (*i)->getArmor()->getSize()) // cf. visible()
+				{
+					_rfCandidates.reactors.push_back(*i);
+					break;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Drops the gathered reactors.
+ * @note getSpottingUnits() then tests all units again.
+ */
+void TileEngine::clearReactors()
+{
+	_rfCandidates.unit = nullptr;
+	_rfCandidates.units = 0u;
+	_rfCandidates.cells.clear();
+	_rfCandidates.reactors.clear();
+}
+
+/**
+ * Checks if a Position is on the path of the gathered reactors.
+ * @param pos - reference to a Position
+ * @return, true if the Position is above or below a tile of the path
+ */
+bool TileEngine::isOnRfPath(const Position& pos) const // private.
+{
+	for (std::vector<Position>::const_iterator
+			i  = _rfCandidates.cells.begin();
+			i != _rfCandidates.cells.end();
+			++i)
+	{
+		if (i->x == pos.x && i->y == pos.y)
+			return true;
+	}
+	return false;
+}
+
 /**
  * Gets the unit with the highest reaction-score from the spotters-vector.
  * @param spotters	- vector of the pointers to spotting BattleUnits
@@ -2323,6 +2568,8 @@ void TileEngine::explode(
 		bool defusePulse,
 		bool isLaunched)
 {
+	const ProfileScope scope (PZ_EXPLOSION);
+
 //	int iFalse (0);
 //	for (int i = 0; i < 1000; ++i)
 //	{
@@ -4324,6 +4571,8 @@ void TileEngine::setProjectileDirection(const int dir)
  */
 void TileEngine::detonateTile(Tile* const tile) const
 {
+	const ProfileScope scope (PZ_EXPLOSION);
+
 	int power (tile->getExplosive());
 	//if (tile->getPosition() == Position(36,31,0)) Log(LOG_INFO) << "detonateTile() power= " << power;
 	if (power != 0)
@@ -4682,6 +4931,8 @@ DoorResult TileEngine::unitOpensDoor(
 						switch (ret = tileDoor->openDoor(partType, unit)) //_battleSave->getBatReserved());
 						{
 							case DR_WOOD_OPEN:
+								_battleSave->addAnimatedTile(tileDoor); // in case the alt-part animates
+
 								if (rtClick == true)
 									calcTu = true;
 
@@ -4889,6 +5140,8 @@ bool TileEngine::closeSlideDoors() const
 /**
  * Calculates a line trajectory using bresenham algorithm in 3D.
  * @note Accuracy is NOT considered; this is a true path/trajectory.
+ * @note The voxel-checks share the Tile look-ups of an enclosing RayBatch if
+ * any; otherwise the line is a batch of its own.
  * @param origin		- reference to the origin (voxel-space for 'doVoxelCheck'; tile-space otherwise)
  * @param target		- reference to the target (voxel-space for 'doVoxelCheck'; tile-space otherwise)
  * @param storeTrj		- true will store the whole trajectory; otherwise only the last position gets stored
@@ -4925,6 +5178,7 @@ VoxelType TileEngine::plotLine(
 		const BattleUnit* const excludeAllBut) const
 {
 	//if (_debug) Log(LOG_INFO) << "TileEngine::plotLine()";
+	const RayBatch batch (this);
 	VoxelType voxelType;
 
 	int
@@ -5007,10 +5261,9 @@ VoxelType TileEngine::plotLine(
 
 		if (doVoxelCheck == true) // passes through this voxel, for Unit visibility & LoS/LoF
 		{
-			voxelType = voxelCheck(
+			voxelType = voxelCheckRay(
 								Position(cx,cy,cz),
 								excludeUnit,
-								false,
 								onlyVisible,
 								excludeAllBut);
 
@@ -5062,10 +5315,9 @@ VoxelType TileEngine::plotLine(
 				if (swap_xz == true) std::swap(cx,cz);
 				if (swap_xy == true) std::swap(cx,cy);
 
-				voxelType = voxelCheck(
+				voxelType = voxelCheckRay(
 									Position(cx,cy,cz),
 									excludeUnit,
-									false,
 									onlyVisible,
 									excludeAllBut);
 
@@ -5094,10 +5346,9 @@ VoxelType TileEngine::plotLine(
 				if (swap_xz == true) std::swap(cx,cz);
 				if (swap_xy == true) std::swap(cx,cy);
 
-				voxelType = voxelCheck(
+				voxelType = voxelCheckRay(
 									Position(cx,cy,cz),
 									excludeUnit,
-									false,
 									onlyVisible,
 									excludeAllBut);
 
@@ -5120,6 +5371,90 @@ VoxelType TileEngine::plotLine(
 	return VOXEL_EMPTY;
 }
 
+/**
+ * Calculates line trajectories from one origin to several targets.
+ * @note The rays are traced in a single batch so that the Tiles they pass
+ * through are looked up only once. Each ray gives the same result as a call to
+ * plotLine() with 'doVoxelCheck' true.
+ * @param origin		- reference to the origin in voxel-space
+ * @param targets		- reference to a vector of targets in voxel-space
+ * @param types			- reference to a vector that gets the VoxelType that stopped each ray
+ * @param impacts		- reference to a vector that gets the voxel of impact of each ray
+ *						  or its target if it hit nothing
+ * @param excludeUnit	- pointer to a BattleUnit to be excluded from collision detection
+ */
+void TileEngine::plotLines(
+		const Position& origin,
+		const std::vector<Position>& targets,
+		std::vector<VoxelType>& types,
+		std::vector<Position>& impacts,
+		const BattleUnit* const excludeUnit) const
+{
+	const RayBatch batch (this);
+
+	types.clear();
+	types.reserve(targets.size());
+	impacts.clear();
+	impacts.reserve(targets.size());
+
+	std::vector<Position> trj;
+	for (std::vector<Position>::const_iterator
+			i  = targets.begin();
+			i != targets.end();
+			++i)
+	{
+		trj.clear();
+		types.push_back(plotLine(
+							origin,
+							*i,
+							false,
+							&trj,
+							excludeUnit));
+
+		if (trj.empty() == false)
+			impacts.push_back(trj.front());
+		else
+			impacts.push_back(*i);
+	}
+}
+
+/**
+ * Starts a batch of rays.
+ * @note A fresh batch invalidates all Tiles that were looked up by previous
+ * batches. The state of the battlefield must not change while a batch lasts.
+ */
+void TileEngine::beginRays() const // private.
+{
+	if (_rayDepth++ == 0)
+	{
+		if (_rayTiles.size() != _battleSave->getMapSizeXYZ())
+		{
+			_rayTiles.assign(_battleSave->getMapSizeXYZ(), RayTile());
+			_rayStamp = 0u;
+		}
+
+		if (++_rayStamp == 0u) // wrapped; clear the stamps so that none is current.
+		{
+			for (std::vector<RayTile>::iterator
+					i  = _rayTiles.begin();
+					i != _rayTiles.end();
+					++i)
+			{
+				i->stamp = 0u;
+			}
+			_rayStamp = 1u;
+		}
+	}
+}
+
+/**
+ * Ends a batch of rays.
+ */
+void TileEngine::endRays() const // private.
+{
+	--_rayDepth;
+}
+
 /**
  * Calculates a parabolic trajectory for thrown items and arcing shots.
  * @note Accuracy is NOT considered; this is a true path/trajectory.
@@ -5360,6 +5695,8 @@ bool TileEngine::validateThrow(
 
 
 	// check for voxelType up from the lowest arc
+	const RayBatch batch (this); // the arcs all pass through the same few Tiles
+
 	VoxelType voxelType;
 	std::vector<Position> trj;
 
@@ -5913,7 +6250,7 @@ VoxelType TileEngine::voxelCheck(
 								// And if any voxel-checks *are* being done during pre-battle, stop it back there.
 
 	//if (_debug) Log(LOG_INFO) << "TileEngine::voxelCheck() targetVoxel " << targetVoxel;
-	const Tile* tile (_battleSave->getTile(Position::toTileSpace(targetVoxel)));
+	const Tile* const tile (_battleSave->getTile(Position::toTileSpace(targetVoxel)));
 	//Log(LOG_INFO) << ". tile " << tile->getPosition();
 
 	// check if we are out of the map <- we. It's a voxel-check, not a 'we'.
@@ -5933,6 +6270,85 @@ VoxelType TileEngine::voxelCheck(
 		return VOXEL_EMPTY;
 	}
 
+	return voxelCheckTile(
+					targetVoxel,
+					tile,
+					tileBelow,
+					excludeUnit,
+					excludeAllUnits,
+					onlyVisible,
+					excludeAllBut);
+}
+
+/**
+ * Checks for a voxel-type in voxel-space for a ray that's traced in a batch.
+ * @note This gives the same result as voxelCheck() but looks up each Tile only
+ * once per batch - the voxels of a ray and of rays from the same origin fall in
+ * the same few Tiles over and over. A Tile that can't stop a ray costs only its
+ * index after that.
+ * @param targetVoxel	- reference to the Position to check in voxel-space
+ * @param excludeUnit	- pointer to unit NOT to do checks for
+ * @param onlyVisible	- true to consider only visible units
+ * @param excludeAllBut	- pointer to an only unit to be considered
+ * @return, VoxelType (MapData.h)
+ */
+VoxelType TileEngine::voxelCheckRay( // private.
+		const Position& targetVoxel,
+		const BattleUnit* const excludeUnit,
+		const bool onlyVisible,
+		const BattleUnit* const excludeAllBut) const
+{
+	const Position posTile (Position::toTileSpace(targetVoxel));
+	const Tile* const tile (_battleSave->getTile(posTile));
+	if (tile == nullptr)
+		return VOXEL_OUTOFBOUNDS;
+
+	RayTile& rayTile (_rayTiles[_battleSave->getTileIndex(posTile)]);
+	if (rayTile.stamp != _rayStamp)
+	{
+		rayTile.stamp = _rayStamp;
+		rayTile.tile = tile;
+		rayTile.tileBelow = tile->getTileBelow(_battleSave);
+		rayTile.empty = tile->isVoid(false, false) == true
+					 && tile->getTileUnit() == nullptr
+					 && (rayTile.tileBelow == nullptr || rayTile.tileBelow->getTileUnit() == nullptr);
+	}
+
+	if (rayTile.empty == true)
+		return VOXEL_EMPTY;
+
+	return voxelCheckTile(
+					targetVoxel,
+					tile,
+					rayTile.tileBelow,
+					excludeUnit,
+					false,
+					onlyVisible,
+					excludeAllBut);
+}
+
+/**
+ * Checks for a voxel-type in a given Tile.
+ * @note Helper for voxelCheck() and voxelCheckRay() - the Tile has already been
+ * found to be not empty.
+ * @param targetVoxel		- reference to the Position to check in voxel-space
+ * @param tile				- pointer to the Tile that contains 'targetVoxel'
+ * @param tileBelow			- pointer to the Tile below 'tile' (can be nullptr)
+ * @param excludeUnit		- pointer to unit NOT to do checks for
+ * @param excludeAllUnits	- true to NOT do checks on any unit
+ * @param onlyVisible		- true to consider only visible units
+ * @param excludeAllBut		- pointer to an only unit to be considered
+ * @return, VoxelType (MapData.h)
+ */
+VoxelType TileEngine::voxelCheckTile( // private.
+		const Position& targetVoxel,
+		const Tile* tile,
+		const Tile* const tileBelow,
+		const BattleUnit* const excludeUnit,
+		const bool excludeAllUnits,
+		const bool onlyVisible,
+		const BattleUnit* const excludeAllBut) const
+{
 	if (targetVoxel.z % 24 < 2 // NOTE: This should allow items to be thrown through a gravLift down to the floor below.
 		&& tile->getMapData(O_FLOOR) != nullptr
 		&& tile->getMapData(O_FLOOR)->isGravLift() == true)
@@ -6550,7 +6966,7 @@ void TileEngine::setDangerZone(
 	Tile* tile (_battleSave->getTile(pos));
 	if (tile != nullptr)
 	{
-		tile->setDangerous(); // set the epicenter as dangerous
+		_battleSave->addDangerTile(tile); // set the epicenter as dangerous
 
 		const Position originVoxel (Position::toVoxelSpaceCentered(
 																pos,
@@ -6600,7 +7016,7 @@ void TileEngine::setDangerZone(
 								if (trj.size() != 0u
 									&& Position::toTileSpace(trj.back()) == posTest)
 								{
-									tile->setDangerous();
+									_battleSave->addDangerTile(tile);
 								}
 							}
 						}
@@ -81,7 +81,9 @@ private:
 		LIGHT_LAYER_STATIC  = 1u,
 		LIGHT_LAYER_DYNAMIC = 2u,
 
-		LOFT_LAYERS = 12u;
+		LOFT_LAYERS = 12u,
+
+		LIGHT_BANDS_PER_THREAD = 2u; // bands of rows per thread for the lighting-passes so that busy bands even out
 
 	bool
 		_isReaction,
@@ -99,11 +101,127 @@ private:
 
 	const std::vector<Uint16>* _voxelData;
 
+	/**
+	 * A Tile as looked up by a batch of rays.
+	 */
+	struct RayTile
+	{
+		unsigned stamp;	// the batch that looked up this entry - stale if not the current batch
+		bool empty;		// true if nothing in the Tile or the Tile below can stop a ray
+		const Tile
+			* tile,
+			* tileBelow;
+	};
+
+	/**
+	 * Shares the Tile look-ups of all rays that are traced during the lifetime
+	 * of this object.
+	 * @note Batches can nest; only the outermost one starts a fresh batch.
+	 */
+	class RayBatch
+	{
+		private:
+			const TileEngine* const _te;
+
+			RayBatch(const RayBatch&) = delete;
+			RayBatch& operator= (const RayBatch&) = delete;
+
+		public:
+			/// Starts a batch.
+			explicit RayBatch(const TileEngine* const te)
+				:
+					_te(te)
+			{ _te->beginRays(); }
+			/// Ends the batch.
+			~RayBatch()
+			{ _te->endRays(); }
+	};
+
+	mutable int _rayDepth;
+	mutable unsigned _rayStamp;
+	mutable std::vector<RayTile> _rayTiles;
+
+	/// Starts a batch of rays.
+	void beginRays() const;
+	/// Ends a batch of rays.
+	void endRays() const;
+	/// Checks what type of voxel occupies a specified voxel for a batched ray.
+	VoxelType voxelCheckRay(
+			const Position& targetVoxel,
+			const BattleUnit* const excludeUnit,
+			const bool onlyVisible,
+			const BattleUnit* const excludeAllBut) const;
+	/// Checks what type of voxel occupies a specified voxel in a given Tile.
+	VoxelType voxelCheckTile(
+			const Position& targetVoxel,
+			const Tile* tile,
+			const Tile* const tileBelow,
+			const BattleUnit* const excludeUnit,
+			const bool excludeAllUnits,
+			const bool onlyVisible,
+			const BattleUnit* const excludeAllBut) const;
+
+	/**
+	 * The units that could react to a walking unit.
+	 * @note Units don't move while another unit walks so a unit that is out of
+	 * sight-range of every tile of the path can never spot the walker.
+	 */
+	struct RfCandidates
+	{
+		const BattleUnit* unit;	// the walking unit
+		size_t units;			// quantity of units on the battlefield when gathered
+		std::vector<Position> cells;		// the tiles of the path w/ z=0
+		std::vector<BattleUnit*> reactors;	// the units in sight-range of any cell
+	};
+
+	RfCandidates _rfCandidates;
+
+	/// Checks if a Position is on the path of the gathered reactors.
+	bool isOnRfPath(const Position& pos) const;
+
+	/**
+	 * A light-source of the terrain.
+	 */
+	struct LightSource
+	{
+		Position pos;
+		int power;
+	};
+
+	/**
+	 * A lighting-pass that's split into bands of rows of the battlefield.
+	 */
+	struct LightPass
+	{
+		const TileEngine* te;
+		size_t bands;
+		const std::vector<LightSource>* sources;
+	};
+
 	/// Adds a pseudo-circular light pattern to the battlefield.
 	void addLight(
 			const Position& pos,
 			int power,
-			size_t layer) const;
+			size_t layer,
+			int rowBegin = 0,
+			int rowEnd = -1) const;
+
+	/// Gets the quantity of bands for a lighting-pass.
+	size_t getLightBands() const;
+	/// Gets the rows of a band of a lighting-pass.
+	void getBandRows(
+			size_t band,
+			size_t bands,
+			int* const rowBegin,
+			int* const rowEnd) const;
+	/// Calculates sun-shading of a band of the battlefield.
+	static void shadeBand(
+			void* data,
+			size_t band);
+	/// Calculates terrain-lighting of a band of the battlefield.
+	static void lightBand(
+			void* data,
+			size_t band);
 
 	/// Calculates blockage of various persuasions.
 	int blockage(
@@ -209,6 +327,12 @@ private:
 				bool quickSpot = true);
 		/// Creates a vector of units that can spot this unit.
 		std::vector<BattleUnit*> getSpottingUnits(const BattleUnit* const unit);
+		/// Gathers the units that could react to a unit along its path.
+		void gatherReactors(
+				const BattleUnit* const unit,
+				const std::vector<int>& path);
+		/// Drops the gathered reactors.
+		void clearReactors();
 		/// Given a vector of spotters, and a unit, picks the spotter with the highest reaction-score.
 		BattleUnit* getReactor(
 				std::vector<BattleUnit*> spotters,
@@ -283,6 +407,13 @@ private:
 				const bool doVoxelCheck = true,
 				const bool onlyVisible = false,
 				const BattleUnit* const excludeAllBut = nullptr) const;
+		/// Calculates line trajectories from one origin to several targets.
+		void plotLines(
+				const Position& origin,
+				const std::vector<Position>& targets,
+				std::vector<VoxelType>& types,
+				std::vector<Position>& impacts,
+				const BattleUnit* const excludeUnit) const;
 		/// Calculates a parabola trajectory.
 		VoxelType plotParabola(
 				const Position& originVoxel,
@@ -217,6 +217,65 @@ void UnitSprite::setSpriteCycle(int cycle)
 	_aniCycle = cycle;
 }
 
+/**
+ * Builds the key of what would be drawn for a BattleUnit-quadrant.
+ * @note Units that are in the middle of an animation that changes their state
+ * (aiming, collapsing) or that are out are not keyed since their frames are
+ * transient.
+ * @param unit		- pointer to a BattleUnit
+ * @param quadrant	- quadrant
+ * @param itRT		- pointer to the right-hand BattleItem that would be drawn or nullptr
+ * @param itLT		- pointer to the left-hand BattleItem that would be drawn or nullptr
+ * @param cycle		- cycle of battlescape Map
+ * @param key		- reference to a UnitSpriteKey to fill
+ * @return, true if the frame can be shared
+ */
+bool UnitSprite::buildKey( // static.
+		BattleUnit* const unit,
+		size_t quadrant,
+		const BattleItem* const itRT,
+		const BattleItem* const itLT,
+		int cycle,
+		UnitSpriteKey& key)
+{
+	switch (unit->getUnitStatus())
+	{
+		case STATUS_STANDING:
+		case STATUS_WALKING:
+		case STATUS_FLYING:
+		case STATUS_TURNING:
+			break;
+
+		default:
+			return false;
+	}
+
+	key.armor = unit->getArmor();
+	key.recolored = (Options::battleHairBleach == true && unit->getRecolor().empty() == false) ? unit : nullptr;
+	key.itRT = (itRT != nullptr) ? itRT->getRules() : nullptr;
+	key.itLT = (itLT != nullptr) ? itLT->getRules() : nullptr;
+
+	key.aniCycle    = cycle;
+	key.activeHand  = static_cast<int>(unit->deterActiveHand());
+	key.faceDir     = unit->getFaceDirection();
+	key.flags       = (unit->isFloating()         == true ? 0x01 : 0)
+					| (unit->isKneeled()          == true ? 0x02 : 0)
+					| (unit->isStrafeBackwards()  == true ? 0x04 : 0)
+					| (unit->getRaceString() == "STR_ETHEREAL" ? 0x08 : 0);
+	key.gender      = static_cast<int>(unit->getGender());
+	key.moveType    = static_cast<int>(unit->getMoveTypeUnit());
+	key.quadrant    = static_cast<int>(quadrant);
+	key.sectionRT   = (itRT != nullptr && itRT->getInventorySection() != nullptr) ? static_cast<int>(itRT->getInventorySection()->getSectionType()) : -1;
+	key.standHeight = unit->getStandHeight();
+	key.status      = static_cast<int>(unit->getUnitStatus());
+	key.turretDir   = unit->getTurretDirection();
+	key.turretType  = static_cast<int>(unit->getTurretType());
+	key.unitDir     = unit->getUnitDirection();
+	key.walkPhase   = unit->getWalkPhase();
+
+	return true;
+}
+
 /**
  * Draws a BattleUnit using the drawing rules for that unit.
  * @note This function is called by Map for each unit in the viewable area of
@@ -20,17 +20,64 @@
 #ifndef OPENXCOM_UNITSPRITE_H
 #define OPENXCOM_UNITSPRITE_H
 
+#include <tuple>
+
 #include "../Engine/Surface.h"
 
 
 namespace OpenXcom
 {
 
+class Armor;
 class BattleItem;
 class BattleUnit;
+class RuleItem;
 class SurfaceSet;
 
 
+/**
+ * The state of a BattleUnit-quadrant that determines what a UnitSprite draws.
+ * @note Units that have equal keys get the same composited frame so Map can
+ * share frames between units instead of re-compositing each of them.
+ */
+struct UnitSpriteKey
+{
+	const Armor* armor;
+	const BattleUnit* recolored;	// the unit if it gets recolored else nullptr
+	const RuleItem
+		* itRT,
+		* itLT;
+	int
+		aniCycle,
+		activeHand,
+		faceDir,
+		flags,
+		gender,
+		moveType,
+		quadrant,
+		sectionRT,
+		standHeight,
+		status,
+		turretDir,
+		turretType,
+		unitDir,
+		walkPhase;
+
+	/// Orders keys for use in a std::map.
+	bool operator <(const UnitSpriteKey& key) const
+	{
+		return std::tie(
+					armor, recolored, itRT, itLT,
+					aniCycle, activeHand, faceDir, flags, gender, moveType, quadrant,
+					sectionRT, standHeight, status, turretDir, turretType, unitDir, walkPhase)
+			 < std::tie(
+					key.armor, key.recolored, key.itRT, key.itLT,
+					key.aniCycle, key.activeHand, key.faceDir, key.flags, key.gender, key.moveType, key.quadrant,
+					key.sectionRT, key.standHeight, key.status, key.turretDir, key.turretType, key.unitDir, key.walkPhase);
+	}
+};
+
+
 /**
  * A class that renders an individual BattleUnit given its render rules
  * combining the right frames from its SurfaceSet.
@@ -114,6 +161,15 @@ private:
 		/// Sets the unit's animation state.
 		void setSpriteCycle(int cycle);
 
+		/// Builds the key of what would be drawn for a BattleUnit-quadrant.
+		static bool buildKey(
+				BattleUnit* const unit,
+				size_t quadrant,
+				const BattleItem* const itRT,
+				const BattleItem* const itLT,
+				int cycle,
+				UnitSpriteKey& key);
+
 		/// Draws the BattleUnit.
 		void draw() override;
 };
@@ -121,6 +121,8 @@ void UnitWalkBState::init()
 	_pf->setPathingUnit(_unit);
 	_dirStart = _pf->getStartDirection();
 
+	_te->gatherReactors(_unit, _pf->getPath());
+
 	if (_action.strafe == false						// not strafing
 		&& _dirStart > -1 && _dirStart < 8			// moving but not up or down
 		&& _dirStart != _unit->getUnitDirection())	// not facing in direction of movement
@@ -1014,6 +1016,7 @@ void UnitWalkBState::abortState(bool recache) // private.
 		_battle->getMap()->cacheUnitSprite(_unit);
 	}
 	_pf->abortPath();
+	_te->clearReactors();
 	_battle->popBattleState();
 }
 
@@ -1028,6 +1031,7 @@ void UnitWalkBState::postPathProcedures() // private.
 	//if (_debug) Log(LOG_INFO) << "postPathProcedures()";
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "UnitWalkBState::postPathProcedures() id-" << _unit->getId();
+	_te->clearReactors();
 	_action.TU = 0;
 
 	if (_unit->getFaction() == FACTION_HOSTILE)
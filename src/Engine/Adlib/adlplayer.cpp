@@ -162,6 +162,7 @@ int adl_gv_master_music_volume = 127;
 int adl_gv_tmp_music_volume = 127;
 bool adl_gv_want_fade = false;
 bool adl_gv_music_playing = false;
+int adl_gv_music_loops = 0;
 int adl_gv_tempo = 120;
 int adl_gv_tempo_run = 60;
 int adl_gv_tempo_inc = 70;
@@ -829,6 +830,7 @@ void func_play_tick()
 			--instruments[instr].cur_delay;
 		}
 		if (!another_loop && adl_gv_music_playing) break;
+		if (another_loop) ++adl_gv_music_loops;
 		init_music();
 		clear_channels();
 	} while (another_loop);
@@ -871,6 +873,12 @@ bool func_is_music_playing()
 	return adl_gv_music_playing;
 }
 
+//MAIN FUNCTION - count of times the music looped back to its start
+int func_get_music_loops()
+{
+	return adl_gv_music_loops;
+}
+
 void func_set_music_tempo(int value)
 {
 	adl_gv_tempo_inc = value;
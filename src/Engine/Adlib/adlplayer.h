@@ -17,6 +17,7 @@ void func_setup_music(unsigned char* music_ptr, int length);
 //MAIN FUNCTION - initialize fade procedure
 void func_fade();
 bool func_is_music_playing();
+int func_get_music_loops();
 void func_set_music_tempo(int value);
 void func_set_music_volume(int value);
 int func_get_polyphony();
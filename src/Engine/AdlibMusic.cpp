@@ -19,7 +19,7 @@
 
 #include "AdlibMusic.h"
 
-//#include <algorithm>
+#include <algorithm>
 #include <fstream>
 
 #include "Exception.h"
@@ -42,6 +42,13 @@ int AdlibMusic::rate  = 0;
 
 std::map<int, int> AdlibMusic::delayRates;
 
+AdlibMusic
+	* AdlibMusic::_current   (nullptr),	// static/private.
+	* AdlibMusic::_rendering (nullptr);	// static/private.
+SDL_Thread* AdlibMusic::_renderThread (nullptr);		// static/private.
+std::atomic<bool> AdlibMusic::_renderCancel (false);	// static/private.
+std::list<AdlibMusic*> AdlibMusic::_cached;			// static/private.
+
 
 /**
  * Initializes a new music track.
@@ -52,7 +59,11 @@ AdlibMusic::AdlibMusic(float volume)
 		Music(),
 		_data(0),
 		_size(0),
-		_volume(volume)
+		_volume(volume),
+		_loops(false),
+		_pos(0u),
+		_rendered(false),
+		_frames(0u)
 {
 	rate = Options::audioSampleRate;
 
@@ -83,11 +94,26 @@ AdlibMusic::AdlibMusic(float volume)
 
 /**
  * Deletes the loaded music content.
+ * @note A render is cancelled only if it renders this track - or if the shared
+ * emulators that it runs on are about to be destroyed.
  */
 AdlibMusic::~AdlibMusic()
 {
+	if (_rendering == this) // the render writes to this track's PCM
+		cancelRender();
+
+	if (_current == this)
+	{
+		SDL_LockAudio();
+		_current = nullptr;
+		SDL_UnlockAudio();
+	}
+	_cached.remove(this);
+	freePcm();
+
 	if (opl[0])
 	{
+		cancelRender(); // a render of another track can't outlive the shared emulators
 		stop();
 		OPLDestroy(opl[0]);
 		opl[0] = 0;
@@ -141,6 +167,9 @@ void AdlibMusic::load(
 
 /**
  * Plays the contained music track.
+ * @note The track is streamed from its rendered PCM; if it hasn't been rendered
+ * yet a render is started on a background-thread and the player streams behind
+ * it. Only if the thread can't be created is the track emulated live.
  * @param loop - not used (default -1). But needs to be here because there is a
  * virtual function in base class Music which has a default set - meaning this
  * won't overload the virtual function unless that default is removed. But that
@@ -152,13 +181,191 @@ void AdlibMusic::play(int /*loop*/) const
 	if (Options::mute == false)
 	{
 		stop();
-		func_setup_music(reinterpret_cast<unsigned char*>(_data), static_cast<int>(_size));
-		func_set_music_volume(static_cast<int>(127.f * _volume));
-		Mix_HookMusic(player, (void*)this);
+		Mix_HookMusic(nullptr, nullptr); // the live player must not run alongside a render
+
+		AdlibMusic* const music (const_cast<AdlibMusic*>(this));
+
+		if (_rendering != music)
+			cancelRender();
+
+		if (music->_rendered == false && _rendering == nullptr)
+		{
+			music->freePcm();
+			music->_pcm.assign( // the render fills these slots but never resizes the vector that the player reads
+							(static_cast<size_t>(rate) * PCM_SECONDS + PCM_BLOCK - 1u) / PCM_BLOCK,
+							nullptr);
+
+			delay = delayRates[rate]; // NOTE: The player is unhooked so this is safe.
+
+			_rendering = music;
+			if ((_renderThread = SDL_CreateThread(render, music)) == nullptr)
+			{
+				_rendering = nullptr;
+				Log(LOG_WARNING) << "AdlibMusic: could not start render - " << SDL_GetError();
+			}
+		}
+
+		if (music->_rendered == true || _rendering == music)
+		{
+			SDL_LockAudio();
+			music->_pos = 0u;
+			_current = music;
+			SDL_UnlockAudio();
+
+			_cached.remove(music);
+			_cached.push_front(music);
+			while (_cached.size() > PCM_CACHED)
+			{
+				_cached.back()->freePcm();
+				_cached.pop_back();
+			}
+
+			Mix_HookMusic(playerPcm, music);
+		}
+		else
+		{
+			SDL_LockAudio();
+			_current = nullptr;
+			SDL_UnlockAudio();
+
+			func_setup_music(reinterpret_cast<unsigned char*>(_data), static_cast<int>(_size));
+			func_set_music_volume(static_cast<int>(127.f * _volume));
+			Mix_HookMusic(player, music);
+		}
 	}
 #endif
 }
 
+/**
+ * Renders a track to PCM.
+ * @note Runs on the render-thread which has sole use of the sequencer and the
+ * emulators until it ends. Rendering stops at the end of the track, where the
+ * track loops back to its start, or after PCM_SECONDS. The rendered frames are
+ * published as they're written so the player can stream behind the render;
+ * the player reads only the frames below '_frames'. The block-slots of '_pcm'
+ * are allocated by play() so the vector itself never changes under the player.
+ * @param music - pointer to the AdlibMusic to render
+ * @return, thread status (0 = ok)
+ */
+int AdlibMusic::render(void* music) // private/static.
+{
+	AdlibMusic* const track (static_cast<AdlibMusic*>(music));
+
+	func_setup_music(reinterpret_cast<unsigned char*>(track->_data), static_cast<int>(track->_size));
+	func_set_music_volume(static_cast<int>(127.f * track->_volume));
+
+	const int loops (func_get_music_loops());
+	const size_t
+		tick (static_cast<size_t>(delay) / 4u),	// stereo-frames per tick; 'delay' is in bytes
+		framesMax (static_cast<size_t>(rate) * PCM_SECONDS);
+	size_t
+		frames (0u),
+		wait   (0u),
+		offset,
+		frameBatch;
+
+	while (_renderCancel.load() == false && frames != framesMax)
+	{
+		if (wait == 0u)
+		{
+			func_play_tick();
+
+			if (func_get_music_loops() != loops)
+			{
+				track->_loops = true;
+				break;
+			}
+
+			if (func_is_music_playing() == false)
+				break;
+
+			wait = tick;
+		}
+
+		if ((offset = frames % PCM_BLOCK) == 0u)
+			track->_pcm[frames / PCM_BLOCK] = new Sint16[PCM_BLOCK * 2u];
+
+		frameBatch = std::min(wait, std::min(PCM_BLOCK - offset, framesMax - frames));
+
+		INT16* const buf (track->_pcm[frames / PCM_BLOCK] + offset * 2u);
+		YM3812UpdateOne(
+					opl[0],
+					buf,
+					static_cast<int>(frameBatch * 2u),
+					2,
+					1.f);
+		YM3812UpdateOne(
+					opl[1],
+					buf + 1,
+					static_cast<int>(frameBatch * 2u),
+					2,
+					1.f);
+
+		frames += frameBatch;
+		wait -= frameBatch;
+		track->_frames.store(frames, std::memory_order_release);
+	}
+
+	func_mute();
+
+	if (_renderCancel.load() == false)
+		track->_rendered.store(true, std::memory_order_release);
+
+	return 0;
+}
+
+/**
+ * Stops the background-render.
+ * @note A render that was cancelled before it finished is discarded; a finished
+ * render's thread is only reaped.
+ */
+void AdlibMusic::cancelRender() // private/static.
+{
+	if (_renderThread != nullptr)
+	{
+		_renderCancel.store(true);
+		SDL_WaitThread(_renderThread, nullptr);
+		_renderThread = nullptr;
+		_renderCancel.store(false);
+
+		AdlibMusic* const music (_rendering);
+		_rendering = nullptr;
+
+		if (music->_rendered.load() == false)
+		{
+			if (_current == music)
+			{
+				SDL_LockAudio();
+				_current = nullptr;
+				SDL_UnlockAudio();
+			}
+			_cached.remove(music);
+			music->freePcm();
+		}
+	}
+}
+
+/**
+ * Frees the rendered PCM.
+ * @note Must not be called on the track that the player streams or renders.
+ */
+void AdlibMusic::freePcm() // private.
+{
+	for (std::vector<Sint16*>::const_iterator
+			i = _pcm.begin();
+			i != _pcm.end();
+			++i)
+	{
+		delete[] *i;
+	}
+	_pcm.clear();
+
+	_frames.store(0u);
+	_rendered.store(false);
+	_loops = false;
+	_pos = 0u;
+}
+
 /**
  * Custom audio player.
  * @param udata		- user data to send to the player
@@ -177,8 +384,9 @@ void AdlibMusic::player(
 	if (Options::musicAlwaysLoop
 		&& !func_is_music_playing())
 	{
-		AdlibMusic* music = (AdlibMusic*)udata;
-		music->play();
+		const AdlibMusic* const music (static_cast<const AdlibMusic*>(udata));
+		func_setup_music(reinterpret_cast<unsigned char*>(music->_data), static_cast<int>(music->_size));
+		func_set_music_volume(static_cast<int>(127.f * music->_volume));
 
 		return;
 	}
@@ -220,11 +428,82 @@ void AdlibMusic::player(
 #endif
 }
 
+/**
+ * Rendered music player.
+ * @note Streams the current track's PCM and loops it without a gap. If the
+ * player catches up with a render that's still running the rest of the buffer
+ * stays silent.
+ * @param udata		- user data to send to the player (not used)
+ * @param stream	- raw audio to output
+ * @param len		- length of audio to output
+ */
+void AdlibMusic::playerPcm( // static.
+		void*,
+		Uint8* stream,
+		int len)
+{
+#ifndef __NO_MUSIC
+	AdlibMusic* const music (_current);
+	if (music == nullptr || Options::volMusic == 0)
+		return;
+
+	const float volume (static_cast<float>(Game::volExp(Options::volMusic)));
+
+	Sint16* out (reinterpret_cast<Sint16*>(stream));
+	size_t
+		frames (static_cast<size_t>(len) / 4u),
+		framesDone,
+		offset,
+		frameBatch;
+
+	while (frames != 0u)
+	{
+		framesDone = music->_frames.load(std::memory_order_acquire);
+		if (music->_pos == framesDone)
+		{
+			if (framesDone == 0u
+				|| music->_rendered.load(std::memory_order_acquire) == false
+				|| (music->_loops == false && Options::musicAlwaysLoop == false))
+			{
+				return;
+			}
+			music->_pos = 0u;
+		}
+
+		offset = music->_pos % PCM_BLOCK;
+		frameBatch = std::min(frames, std::min(PCM_BLOCK - offset, framesDone - music->_pos));
+
+		const Sint16* const pcm (music->_pcm[music->_pos / PCM_BLOCK] + offset * 2u);
+		for (size_t
+				i = 0u;
+				i != frameBatch * 2u;
+				++i)
+		{
+			out[i] = static_cast<Sint16>(static_cast<float>(pcm[i]) * volume);
+		}
+
+		out += frameBatch * 2u;
+		music->_pos += frameBatch;
+		frames -= frameBatch;
+	}
+#endif
+}
+
+/**
+ * Checks if music is playing.
+ * @return, true if playing
+ */
 bool AdlibMusic::isPlaying()
 {
 #ifndef __NO_MUSIC
 	if (Options::mute == false)
 	{
+		if (_current != nullptr)
+			return _current->_loops == true
+				|| Options::musicAlwaysLoop == true
+				|| _current->_rendered.load() == false
+				|| _current->_pos != _current->_frames.load();
+
 		return func_is_music_playing();
 	}
 #endif
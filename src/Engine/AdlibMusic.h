@@ -20,10 +20,14 @@
 #ifndef OPENXCOM_ADLIBMUSIC_H
 #define OPENXCOM_ADLIBMUSIC_H
 
+#include <atomic>
+#include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 //#include <SDL/SDL_mixer.h>
+#include <SDL/SDL_thread.h>
 
 #include "Music.h"
 
@@ -33,7 +37,9 @@ namespace OpenXcom
 
 /**
  * Container for Adlib music tracks.
- * @note Uses a custom YM3812 music player passed to SDL_mixer.
+ * @note Uses a custom YM3812 music player passed to SDL_mixer. A track is
+ * rendered to PCM on a background-thread the first time it plays and is then
+ * streamed from that; live emulation is used only if the thread can't start.
  */
 class AdlibMusic
 	:
@@ -41,15 +47,40 @@ class AdlibMusic
 {
 
 private:
+	static const size_t
+		PCM_BLOCK	= 16384u,	// stereo-frames per block of rendered PCM
+		PCM_SECONDS	= 600u,		// longest track that gets rendered
+		PCM_CACHED	= 4u;		// most tracks that keep their rendered PCM
+
 	static int
 		delay,
 		rate;
 	static std::map<int, int> delayRates;
 
+	static AdlibMusic
+		* _current,		// the rendered track that the player streams
+		* _rendering;	// the track being rendered
+	static SDL_Thread* _renderThread;
+	static std::atomic<bool> _renderCancel;
+	static std::list<AdlibMusic*> _cached; // rendered tracks, most recently played first
+
 	char* _data;
 	size_t _size;
 	float _volume;
 
+	bool _loops;					// true if the track loops back to its start by itself
+	size_t _pos;					// the stereo-frame that the player streams next
+	std::atomic<bool> _rendered;	// true once the entire track has been rendered
+	std::atomic<size_t> _frames;	// count of stereo-frames rendered so far
+	std::vector<Sint16*> _pcm;		// blocks of interleaved stereo-samples
+
+	/// Renders a track to PCM.
+	static int render(void* music);
+	/// Stops the background-render.
+	static void cancelRender();
+	/// Frees the rendered PCM.
+	void freePcm();
+
 
 	public:
 		/// Creates a blank music track.
@@ -72,6 +103,11 @@ private:
 				void* udata,
 				Uint8* stream,
 				int len);
+		/// Rendered music player.
+		static void playerPcm(
+				void* udata,
+				Uint8* stream,
+				int len);
 
 		///
 		bool isPlaying();
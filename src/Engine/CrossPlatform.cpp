@@ -60,6 +60,7 @@
 #	endif
 
 //#	include <windows.h>
+#	include <io.h>		// _commit(), _fileno()
 #	include <shlobj.h>
 #	include <shlwapi.h>
 //#	include <dbghelp.h>
@@ -907,6 +908,20 @@ std::time_t getDateModified(const std::string& path)
 	return 0;
 }
 
+/**
+ * Gets the size of a file.
+ * @param path - reference to full path to file
+ * @return, the size in bytes (0 if the file can't be stat'd)
+ */
+size_t getFileSize(const std::string& path)
+{
+	struct stat info;
+	if (stat(path.c_str(), &info) == 0)
+		return static_cast<size_t>(info.st_size);
+
+	return 0u;
+}
+
 /**
  * Converts a date/time into a human-readable string using the ISO-8601 standard.
  * @param timeIn - value in timestamp format
@@ -1057,7 +1072,9 @@ bool moveFile(
 					dst.c_str(),
 					MOVEFILE_REPLACE_EXISTING) != 0);
 #else
-//	return (rename(src.c_str(), dest.c_str()) == 0);
+	if (rename(src.c_str(), dst.c_str()) == 0) // atomic replace on the same file-system
+		return true;
+
 	std::ifstream srcStream;
 	std::ofstream destStream;
 	srcStream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
@@ -1078,6 +1095,22 @@ bool moveFile(
 #endif
 }
 
+/**
+ * Flushes a file's buffers all the way to disk.
+ * @param file - pointer to an open file
+ * @return, true if the operation succeeded
+ */
+bool flushFile(std::FILE* const file)
+{
+	if (std::fflush(file) != 0)
+		return false;
+#ifdef _WIN32
+	return (_commit(_fileno(file)) == 0);
+#else
+	return (fsync(fileno(file)) == 0);
+#endif
+}
+
 /**
  * Notifies the user that maybe he/she should have a look.
  */
@@ -20,6 +20,7 @@
 #ifndef OPENXCOM_CROSSPLATFORM_H
 #define OPENXCOM_CROSSPLATFORM_H
 
+#include <cstdio> // std::FILE
 #include <string> // std::string, std::wstring
 #include <vector> // std::vector
 
@@ -108,6 +109,8 @@ bool isQuitShortcut(const SDL_Event& ev);
 
 /// Gets the modified date of a file.
 time_t getDateModified(const std::string& path);
+/// Gets the size of a file in bytes.
+size_t getFileSize(const std::string& path);
 
 /// Converts a timestamp to a pair of widestrings.
 std::pair<std::wstring, std::wstring> timeToString(time_t timeIn);
@@ -125,6 +128,8 @@ bool naturalCompare(
 bool moveFile(
 		const std::string& src,
 		const std::string& dest);
+/// Flushes a file's buffers to disk.
+bool flushFile(std::FILE* const file);
 
 /// Flashes the game window.
 void flashWindow();
@@ -19,6 +19,8 @@
 
 #include "Font.h"
 
+#include <algorithm>	// std::max()
+
 #include "CrossPlatform.h"
 #include "DosFont.h"
 //#include "Language.h"
@@ -145,6 +147,17 @@ void Font::init()
 	_surface->lock();
 	const int len (_surface->getWidth() / _width);
 
+	wchar_t charLast (0);
+	for (size_t
+			i = 0u;
+			i != _index.length();
+			++i)
+	{
+		charLast = std::max(charLast, _index[i]);
+	}
+	_pages.assign((static_cast<size_t>(charLast) >> PAGE_BITS) + 1u, 0u);
+	_chars.clear();
+
 	if (_monospace == true)
 	{
 		for (size_t
@@ -162,7 +175,7 @@ void Font::init()
 			rect.w = static_cast<Uint16>(_width);
 			rect.h = static_cast<Uint16>(_height);
 
-			_chars[_index[i]] = rect;
+			slotChar(_index[i]) = rect;
 		}
 	}
 	else
@@ -215,12 +228,53 @@ void Font::init()
 			rect.w = static_cast<Uint16>(right - left + 1);
 			rect.h = static_cast<Uint16>(_height);
 
-			_chars[_index[i]] = rect;
+			slotChar(_index[i]) = rect;
 		}
 	}
 	_surface->unlock();
 }
 
+/**
+ * Gets the slot of a particular character in this Font.
+ * @note The pages of characters are allocated only for blocks that the Font's
+ * index uses so a single high character doesn't size the table to itself.
+ * @param fontChar - character to look up
+ * @return, reference to the character's rect
+ */
+SDL_Rect& Font::slotChar(wchar_t fontChar) // private.
+{
+	const size_t id (static_cast<size_t>(fontChar));
+	Uint16& page (_pages[id >> PAGE_BITS]);
+	if (page == 0u)
+	{
+		const SDL_Rect rectNone {0,0,0u,0u};
+		_chars.resize(_chars.size() + (1u << PAGE_BITS), rectNone);
+		page = static_cast<Uint16>(_chars.size() >> PAGE_BITS);
+	}
+	return _chars[(static_cast<size_t>(page - 1u) << PAGE_BITS) | (id & ((1u << PAGE_BITS) - 1u))];
+}
+
+/**
+ * Gets the rect of a particular character in this Font.
+ * @param fontChar - character to look up
+ * @return, pointer to the character's rect or nullptr if this Font lacks it
+ */
+const SDL_Rect* Font::findChar(wchar_t fontChar) const // private.
+{
+	const size_t id (static_cast<size_t>(fontChar));
+	if ((id >> PAGE_BITS) < _pages.size())
+	{
+		const Uint16 page (_pages[id >> PAGE_BITS]);
+		if (page != 0u)
+		{
+			const SDL_Rect& rect (_chars[(static_cast<size_t>(page - 1u) << PAGE_BITS) | (id & ((1u << PAGE_BITS) - 1u))]);
+			if (rect.h != 0u)
+				return &rect;
+		}
+	}
+	return nullptr;
+}
+
 /**
  * Returns a particular character from the set stored in this Font.
  * @param fontChar - character to use for size/position
@@ -228,18 +282,25 @@ void Font::init()
  */
 Surface* Font::getChar(wchar_t fontChar)
 {
-	if (_chars.find(fontChar) != _chars.end())
+	const SDL_Rect* const rect (findChar(fontChar));
+	if (rect != nullptr)
 	{
-		_surface->getCrop()->x = _chars[fontChar].x;
-		_surface->getCrop()->y = _chars[fontChar].y;
-		_surface->getCrop()->w = _chars[fontChar].w;
-		_surface->getCrop()->h = _chars[fontChar].h;
-
+		*_surface->getCrop() = *rect;
 		return _surface;
 	}
 	return nullptr;
 }
 
+/**
+ * Checks if this Font has a particular character.
+ * @param fontChar - character to check for
+ * @return, true if the character is in this Font
+ */
+bool Font::hasChar(wchar_t fontChar) const
+{
+	return findChar(fontChar) != nullptr;
+}
+
 /**
  * Gets the maximum width for any character in this Font.
  * @return, width in pixels
@@ -274,7 +335,7 @@ int Font::getSpacing() const
  * @param fontChar - font character
  * @return, width and height dimensions (x/y are set as safeties)
  */
-SDL_Rect Font::getCharSize(wchar_t fontChar)
+SDL_Rect Font::getCharSize(wchar_t fontChar) const
 {
 	SDL_Rect charSize {0,0,0u,0u};
 
@@ -282,11 +343,20 @@ SDL_Rect Font::getCharSize(wchar_t fontChar)
 		&& isLinebreak(fontChar) == false
 		&& isSpace(fontChar) == false)
 	{
-		if (_chars.find(fontChar) == _chars.end()) 
-			fontChar = L'_';
+		const SDL_Rect* rect (findChar(fontChar));
+		if (rect == nullptr)
+			rect = findChar(L'_');
 
-		charSize.w = static_cast<Uint16>(_chars[fontChar].w + _spacing);
-		charSize.h = static_cast<Uint16>(_chars[fontChar].h + _spacing);
+		if (rect != nullptr)
+		{
+			charSize.w = static_cast<Uint16>(rect->w + _spacing);
+			charSize.h = static_cast<Uint16>(rect->h + _spacing);
+		}
+		else // NOTE: The map that this replaced would have inserted an empty rect.
+		{
+			charSize.w =
+			charSize.h = static_cast<Uint16>(_spacing);
+		}
 	}
 	else
 	{
@@ -20,8 +20,8 @@
 #ifndef OPENXCOM_FONT_H
 #define OPENXCOM_FONT_H
 
-#include <map>
 #include <string>
+#include <vector>
 
 #include <SDL/SDL.h>
 
@@ -59,7 +59,15 @@ private:
 
 	Surface* _surface;
 
-	std::map<wchar_t, SDL_Rect> _chars;
+	static const size_t PAGE_BITS = 8u; // characters are looked up in pages of 256
+
+	std::vector<Uint16> _pages;		// 1-based page in '_chars' of each block of characters, 0 if the Font has none of the block
+	std::vector<SDL_Rect> _chars;	// rects of the pages of characters; a rect with no height is a character that the Font lacks
+
+	/// Gets the rect of a character.
+	const SDL_Rect* findChar(wchar_t fontChar) const;
+	/// Gets the slot of a character in its page allocating the page if need be.
+	SDL_Rect& slotChar(wchar_t fontChar);
 
 
 	public:
@@ -101,6 +109,8 @@ private:
 
 		/// Gets a particular character from the Font with its real size.
 		Surface* getChar(wchar_t fontChar);
+		/// Checks if the Font has a particular character.
+		bool hasChar(wchar_t fontChar) const;
 
 		/// Gets the Font's character width.
 		int getWidth() const;
@@ -111,7 +121,7 @@ private:
 		int getSpacing() const;
 
 		/// Gets the size of a particular character.
-		SDL_Rect getCharSize(wchar_t fontChar);
+		SDL_Rect getCharSize(wchar_t fontChar) const;
 
 		/// Gets the Font's Surface.
 		Surface* getSurface() const;
@@ -35,6 +35,7 @@
 #include "Logger.h"
 #include "Music.h"
 #include "Options.h"
+#include "Profiler.h"
 #include "Screen.h"
 #include "Sound.h"
 #include "State.h"
@@ -42,6 +43,7 @@
 #include "../Interface/Cursor.h"
 #include "../Interface/FpsCounter.h"
 #include "../Interface/NumberText.h"
+#include "../Interface/ProfilerOverlay.h"
 
 //#include "../Menu/TestState.h"
 
@@ -150,6 +152,9 @@ Game::Game(const std::string& title)
 	// Create FPS-counter.
 	_fpsCounter = new FpsCounter(15,5);
 
+	// Create profiler-overlay.
+	_profOverlay = new ProfilerOverlay(96,160, 1,7);
+
 	// Create blank Language.
 	_lang = new Language();
 
@@ -181,6 +186,10 @@ Game::~Game()
 
 	SDL_FreeCursor(SDL_GetCursor());
 
+	const std::string error (SavedGame::finishSave()); // let a background-save complete
+	if (error.empty() == false)
+		Log(LOG_ERROR) << error;
+
 	delete _cursor;
 	delete _lang;
 	delete _res;
@@ -188,6 +197,7 @@ Game::~Game()
 	delete _rules;
 	delete _screen;
 	delete _fpsCounter;
+	delete _profOverlay;
 
 	NumberText::deleteStaticSurfaces();
 
@@ -362,6 +372,7 @@ void Game::run()
 						_screen->handle(&action);
 						_cursor->handle(&action);
 						_fpsCounter->handle(&action);
+						_profOverlay->handle(&action);
 
 						if (action.getDetails()->type == SDL_KEYDOWN
 							&& (SDL_GetModState() & KMOD_CTRL) != 0)
@@ -441,10 +452,15 @@ void Game::run()
 
 			_inputActive = true;
 
-			_states.back()->think();					// process logic
+			{
+				const ProfileScope scope (PZ_THINK);
+				_states.back()->think();				// process logic
+			}
 			_fpsCounter->think();
+			_profOverlay->think();
 
-			if (_init == false)							// process rendering
+			if (_init == false							// process rendering
+				&& Options::headless == false)
 			{
 #ifdef _DEBUG
 				// The player's ActionMenu won't blit/draw/flip without this. g++ (4.2) debug configuration
@@ -471,12 +487,17 @@ void Game::run()
 				}
 
 				_fpsCounter->blit(_screen->getSurface());
+				_profOverlay->blit(_screen->getSurface());
 				_cursor->blit(_screen->getSurface());
 
 				_screen->flip();
 			}
 
-			SDL_Delay(1u);
+			if (Profiler::isEnabled() == true)
+				Profiler::endFrame();
+
+			if (Options::headless == false)
+				SDL_Delay(1u);
 		} // end run loop.
 	}
 	else // anything other than Options::engineLooper= "roadrunner"
@@ -628,6 +649,7 @@ void Game::run()
 						_screen->handle(&action);
 						_cursor->handle(&action);
 						_fpsCounter->handle(&action);
+						_profOverlay->handle(&action);
 
 						if (action.getDetails()->type == SDL_KEYDOWN
 							&& (SDL_GetModState() & KMOD_CTRL) != 0)
@@ -714,10 +736,15 @@ void Game::run()
 
 			if (runState != PAUSED)
 			{
-				_states.back()->think();							// process logic
+				{
+					const ProfileScope scope (PZ_THINK);
+					_states.back()->think();						// process logic
+				}
 				_fpsCounter->think();
+				_profOverlay->think();
 
-				if (_init == false)									// process rendering
+				if (_init == false									// process rendering
+					&& Options::headless == false)
 				{
 					if (Options::FPS != 0							// update slice-delay-time based on the time of the last draw
 						&& !(Options::useOpenGL == true
@@ -760,17 +787,22 @@ void Game::run()
 						}
 
 						_fpsCounter->blit(_screen->getSurface());
+						_profOverlay->blit(_screen->getSurface());
 						_cursor->blit(_screen->getSurface());
 
 						_screen->flip();
 					}
 				}
+
+				if (Profiler::isEnabled() == true)
+					Profiler::endFrame();
 			}
 
 			switch (runState)			// save on CPU
 			{
 				case STANDARD:
-					SDL_Delay(1u);		// save CPU from going 100%
+					if (Options::headless == false)
+						SDL_Delay(1u);	// save CPU from going 100%
 					break;
 				case SLOWED:
 				case PAUSED:
@@ -1234,6 +1266,15 @@ FpsCounter* Game::getFpsCounter() const
 	return _fpsCounter;
 }
 
+/**
+ * Gets the ProfilerOverlay used by this Game.
+ * @return, pointer to the ProfilerOverlay
+ */
+ProfilerOverlay* Game::getProfilerOverlay() const
+{
+	return _profOverlay;
+}
+
 /**
  * Gets the country-cycle for debugging country-zones.
  * @return, the current country-cycle value
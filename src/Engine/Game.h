@@ -33,6 +33,7 @@ class Action;
 class Cursor;
 class FpsCounter;
 class Language;
+class ProfilerOverlay;
 class ResourcePack;
 class Ruleset;
 class SavedGame;
@@ -77,6 +78,7 @@ private:
 	Cursor*			_cursor;
 	FpsCounter*		_fpsCounter;
 	Language*		_lang;
+	ProfilerOverlay* _profOverlay;
 	ResourcePack*	_res;
 	Ruleset*		_rules;
 	SavedGame*		_playSave;
@@ -156,6 +158,8 @@ private:
 		Cursor* getCursor() const;
 		/// Gets the FpsCounter.
 		FpsCounter* getFpsCounter() const;
+		/// Gets the ProfilerOverlay.
+		ProfilerOverlay* getProfilerOverlay() const;
 
 		/// Gets the country-cycle for debugging country-zones.
 		int getDebugCycle() const;
@@ -0,0 +1,310 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef _MSC_VER
+#	ifndef _CRT_SECURE_NO_WARNINGS
+#		define _CRT_SECURE_NO_WARNINGS
+#	endif
+#endif
+
+#include "LogWriter.h"
+
+#include "CrossPlatform.h"
+#include "Logger.h"
+
+
+namespace OpenXcom
+{
+
+LogWriter::LogSlot LogWriter::_ring[RING_SIZE];	// static/private.
+
+std::atomic<bool> LogWriter::_run (false);		// static/private.
+std::atomic<size_t>								// static/private.
+	LogWriter::_dropped (0u),
+	LogWriter::_head    (0u),
+	LogWriter::_tail    (0u);
+
+std::FILE* LogWriter::_file     (nullptr);		// static/private.
+SDL_Thread* LogWriter::_thread  (nullptr);		// static/private.
+SDL_mutex* LogWriter::_control  (nullptr);		// static/private.
+
+
+/**
+ * Starts the background-writer on the log-file.
+ * @note If the file can't be opened or the thread can't be created lines
+ * continue to be written directly. The mutex is created here - before any
+ * other thread runs - and is kept for the life of the program.
+ */
+void LogWriter::start() // static.
+{
+	if (_control == nullptr)
+		_control = SDL_CreateMutex();
+
+	lock();
+	if (_thread == nullptr)
+	{
+		for (size_t
+				i = 0u;
+				i != RING_SIZE;
+				++i)
+		{
+			_ring[i].seq.store(i, std::memory_order_relaxed);
+		}
+		_head.store(0u, std::memory_order_relaxed);
+		_tail.store(0u, std::memory_order_relaxed);
+		_dropped.store(0u, std::memory_order_relaxed);
+
+		if (_file != nullptr // still open after halt()
+			|| (_file = std::fopen(Logger::logFile().c_str(), "a")) != nullptr)
+		{
+			_run.store(true);
+			if ((_thread = SDL_CreateThread(write, nullptr)) == nullptr)
+			{
+				_run.store(false);
+				std::fclose(_file);
+				_file = nullptr;
+			}
+		}
+	}
+	unlock();
+}
+
+/**
+ * Writes any queued lines and stops the background-writer.
+ */
+void LogWriter::stop() // static.
+{
+	lock();
+	halt();
+
+	if (_file != nullptr)
+	{
+		std::fclose(_file);
+		_file = nullptr;
+	}
+	unlock();
+}
+
+/**
+ * Stops the background-writer and writes any queued lines.
+ * @note The log-file is left open for writeDirect(). The caller holds the lock;
+ * the writer-thread never takes it so waiting on the thread can't deadlock.
+ */
+void LogWriter::halt() // private/static.
+{
+	if (_thread != nullptr)
+	{
+		_run.store(false);
+		SDL_WaitThread(_thread, nullptr);
+		_thread = nullptr;
+
+		drain();
+	}
+}
+
+/**
+ * Queues a line for writing.
+ * @note Safe to call from any thread. The line is copied into a slot of the
+ * ring so that the slot's buffer gets reused once it's large enough.
+ * @param line		- reference to the line without its timestamp
+ * @param echo		- true to print the line to stdout also
+ * @param direct	- true to bypass the ring (eg. fatal errors) - the writer is
+ *					  stopped and the queued lines are written first
+ */
+void LogWriter::push( // static.
+		const std::string& line,
+		bool echo,
+		bool direct)
+{
+	if (direct == true)
+	{
+		lock();
+		halt();
+		writeDirect(line, echo);
+		unlock();
+		return;
+	}
+
+	if (_run.load(std::memory_order_relaxed) == false)
+	{
+		lock();
+		writeDirect(line, echo);
+		unlock();
+		return;
+	}
+
+	size_t pos (_head.load(std::memory_order_relaxed));
+	for (;;)
+	{
+		LogSlot& slot (_ring[pos & (RING_SIZE - 1u)]);
+		const size_t seq (slot.seq.load(std::memory_order_acquire));
+
+		if (seq == pos) // slot is free; try to claim it
+		{
+			if (_head.compare_exchange_weak(
+										pos,
+										pos + 1u,
+										std::memory_order_relaxed) == true)
+			{
+				slot.line = line;
+				slot.echo = echo;
+				slot.seq.store(pos + 1u, std::memory_order_release);
+				return;
+			}
+		}
+		else if (seq < pos) // ring is full
+		{
+			_dropped.fetch_add(1u, std::memory_order_relaxed);
+			return;
+		}
+		else // another thread claimed the slot first
+			pos = _head.load(std::memory_order_relaxed);
+	}
+}
+
+/**
+ * Writes queued lines until stopped.
+ * @return, thread status (0 = ok)
+ */
+int LogWriter::write(void*) // private/static.
+{
+	while (_run.load() == true)
+	{
+		drain();
+		SDL_Delay(static_cast<Uint32>(BATCH_DELAY));
+	}
+	return 0;
+}
+
+/**
+ * Writes all queued lines to the log-file.
+ * @note Only the writer-thread - or stop() after the writer-thread has ended -
+ * consumes the ring. All lines of a batch get the same timestamp.
+ */
+void LogWriter::drain() // private/static.
+{
+	std::string stamp;
+	bool echo (false);
+
+	size_t pos (_tail.load(std::memory_order_relaxed));
+	for (;;)
+	{
+		LogSlot& slot (_ring[pos & (RING_SIZE - 1u)]);
+		if (slot.seq.load(std::memory_order_acquire) != pos + 1u)
+			break;
+
+		if (stamp.empty() == true)
+			stamp = "[" + CrossPlatform::now() + "]\t";
+
+		std::fputs(stamp.c_str(), _file);
+		std::fputs(slot.line.c_str(), _file);
+
+		if (slot.echo == true)
+		{
+			std::fputs(slot.line.c_str(), stdout);
+			echo = true;
+		}
+
+		slot.seq.store(pos + RING_SIZE, std::memory_order_release);
+		_tail.store(++pos, std::memory_order_relaxed);
+	}
+
+	const size_t dropped (_dropped.exchange(0u));
+	if (dropped != 0u)
+	{
+		if (stamp.empty() == true)
+			stamp = "[" + CrossPlatform::now() + "]\t";
+
+		std::fprintf(
+					_file,
+					"%s[%s]\tLogger dropped %u lines\n",
+					stamp.c_str(),
+					Logger::toString(LOG_WARNING).c_str(),
+					static_cast<unsigned>(dropped));
+	}
+
+	if (stamp.empty() == false)
+		std::fflush(_file);
+
+	if (echo == true)
+		std::fflush(stdout);	// NOTE: Print to console is not working as expected in MinGW-w64.
+}
+
+/**
+ * Writes a line straight to the log-file.
+ * @note Uses the writer's file-handle if it's still open - ie. after halt().
+ * @param line - reference to the line without its timestamp
+ * @param echo - true to print the line to stdout also
+ */
+void LogWriter::writeDirect( // private/static.
+		const std::string& line,
+		bool echo)
+{
+	FILE* file;
+	if (_file != nullptr)
+		file = _file;
+	else
+		file = std::fopen(Logger::logFile().c_str(), "a");
+
+	if (file != nullptr)
+	{
+		std::fprintf(
+					file,
+					"[%s]\t%s",
+					CrossPlatform::now().c_str(),
+					line.c_str());
+
+		std::fflush(file);
+		if (file != _file)
+			std::fclose(file);
+	}
+	else
+		echo = true;
+
+	if (echo == true)
+	{
+		std::fprintf(
+					stdout,
+					"%s",
+					line.c_str());
+		std::fflush(stdout);
+	}
+}
+
+/**
+ * Locks the writer-thread and file-handle against other threads.
+ * @note Does nothing before start() has created the mutex. SDL's mutexes are
+ * recursive so a fatal line logged while the lock is held can't deadlock.
+ */
+void LogWriter::lock() // private/static.
+{
+	if (_control != nullptr)
+		SDL_mutexP(_control);
+}
+
+/**
+ * Unlocks the writer-thread and file-handle.
+ */
+void LogWriter::unlock() // private/static.
+{
+	if (_control != nullptr)
+		SDL_mutexV(_control);
+}
+
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_LOGWRITER_H
+#define OPENXCOM_LOGWRITER_H
+
+#include <atomic>		// std::atomic
+#include <cstdio>		// std::FILE
+#include <string>		// std::string
+
+#include <SDL/SDL_mutex.h>
+#include <SDL/SDL_thread.h>
+
+
+namespace OpenXcom
+{
+
+/**
+ * Writes the lines of the Logger to file on a background-thread.
+ * @note Lines are queued in a bounded lock-free ring that any thread can push
+ * to; the writer keeps the log-file open and writes whatever has queued up in
+ * one batch. If the ring is full lines are dropped and a count of the dropped
+ * lines is written when there is room again. Until the writer is started - and
+ * after it's stopped - lines are written directly.
+ * @note A fatal line stops the writer first so that the lines queued ahead of
+ * it are written ahead of it through the same file-handle. The writer-thread
+ * and the file-handle are guarded by a mutex since a fatal line can come from
+ * any thread.
+ */
+class LogWriter
+{
+
+private:
+	static const size_t
+		RING_SIZE		= 4096u,	// must be a power of 2
+		BATCH_DELAY		= 10u;		// ms to sleep when there is nothing to write
+
+	/**
+	 * A line in the ring.
+	 */
+	struct LogSlot
+	{
+		std::atomic<size_t> seq;	// the ring-position that may next use this slot
+		bool echo;					// true to print the line to stdout also
+		std::string line;
+	};
+
+	static LogSlot _ring[RING_SIZE];
+
+	static std::atomic<bool> _run;
+	static std::atomic<size_t>
+		_dropped,
+		_head,
+		_tail;
+
+	static std::FILE* _file;
+	static SDL_Thread* _thread;
+	static SDL_mutex* _control;
+
+	/// Writes queued lines until stopped.
+	static int write(void*);
+	/// Stops the background-writer and writes any queued lines.
+	static void halt();
+	/// Writes all queued lines to the log-file.
+	static void drain();
+	/// Writes a line straight to the log-file.
+	static void writeDirect(
+			const std::string& line,
+			bool echo);
+
+	/// Locks the writer-thread and file-handle against other threads.
+	static void lock();
+	/// Unlocks the writer-thread and file-handle.
+	static void unlock();
+
+
+	public:
+		/// Starts the background-writer on the log-file.
+		static void start();
+		/// Writes any queued lines and stops the background-writer.
+		static void stop();
+
+		/// Queues a line for writing.
+		static void push(
+				const std::string& line,
+				bool echo,
+				bool direct);
+};
+
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <sstream>		// std::ostringstream
 
 #include "CrossPlatform.h"
+#include "LogWriter.h"
 
 
 namespace OpenXcom
@@ -50,6 +51,16 @@ enum SeverityLevel
 	LOG_VERBOSE     // 5 - Extra details that even Planck wouldn't have cared about 90% of the time.
 };
 
+/**
+ * Defines the subsystems that can be filtered separately by LogSub().
+ */
+enum LogSubsystem
+{
+	LOGSUB_GENERAL,	// 0
+	LOGSUB_AI,		// 1 - AI-tracing
+	LOGSUB_TOTAL	// 2
+};
+
 
 /**
  * A basic logging and debugging class.
@@ -69,6 +80,7 @@ private:
 
 	/*protected:*/
 	std::ostringstream _oststr;
+	SeverityLevel _level;
 
 
 		public:
@@ -83,6 +95,8 @@ private:
 			///
 			static SeverityLevel& reportLevel();
 			///
+			static SeverityLevel& subsystemLevel(LogSubsystem sub);
+			///
 			static std::string& logFile();
 			///
 			static std::string toString(SeverityLevel level);
@@ -127,6 +141,8 @@ private:
  *
  */
 inline Logger::Logger()
+	:
+		_level(LOG_INFO)
 {}
 
 /**
@@ -135,45 +151,37 @@ inline Logger::Logger()
  */
 inline std::ostringstream& Logger::get(SeverityLevel level)
 {
+	_level = level;
 	_oststr << "[" << toString(level) << "]" << "\t";
 	return _oststr;
 }
 
 /**
  * dTor.
+ * @note The line is handed to the LogWriter which timestamps it and writes it
+ * on its own thread. Fatal lines are written directly after the lines that
+ * were queued ahead of them.
  */
 inline Logger::~Logger() // virtual. NOTE: This need not be virtual.
 {
 	_oststr << std::endl;
 
-	std::ostringstream oststr;
-	oststr << "[" << CrossPlatform::now() << "]" << "\t" << _oststr.str();
-	FILE* const file (std::fopen(logFile().c_str(), "a"));
-	if (file != nullptr)
-	{
-		std::fprintf(
-					file,
-					"%s",
-					oststr.str().c_str());
-
-		std::fflush(file);
-		std::fclose(file);
-	}
-
+	bool echo;
 	switch (reportLevel())
 	{
-		default:
-			if (file != nullptr) break;
-			// no break;
-
 		case LOG_DEBUG:
 		case LOG_VERBOSE:
-			std::fprintf(			// FIX: Print to console is not working as expected in MinGW-w64.
-						stdout,		// was 'stderr'
-						"%s",
-						_oststr.str().c_str());
-			std::fflush(stdout);	// was 'stderr'
+			echo = true;
+			break;
+
+		default:
+			echo = false;
 	}
+
+	LogWriter::push(
+				_oststr.str(),
+				echo,
+				_level == LOG_FATAL);
 }
 
 /**
@@ -186,6 +194,23 @@ inline SeverityLevel& Logger::reportLevel() // static.
 	return reportLevel;
 }
 
+/**
+ * Gets/Sets the maximum SeverityLevel of a specified subsystem.
+ * @note A line logged with LogSub() is written only if it passes both the
+ * subsystem's level and the general reportLevel().
+ * @param sub - the subsystem
+ * @return, reference to the subsystem's current maximum SeverityLevel
+ */
+inline SeverityLevel& Logger::subsystemLevel(LogSubsystem sub) // static.
+{
+	static SeverityLevel subsystemLevels[LOGSUB_TOTAL]
+	{
+		LOG_VERBOSE,	// LOGSUB_GENERAL
+		LOG_VERBOSE		// LOGSUB_AI
+	};
+	return subsystemLevels[sub];
+}
+
 /**
  * Returns the log-file string.
  * @return, filename + extension
@@ -217,6 +242,8 @@ inline std::string Logger::toString(SeverityLevel level) // static.
 
 // macro: Log
 #define Log(level) if (level > Logger::reportLevel()) ; else Logger().get(level)
+// macro: LogSub
+#define LogSub(sub, level) if (level > Logger::reportLevel() || level > Logger::subsystemLevel(sub)) ; else Logger().get(level)
 
 }
 
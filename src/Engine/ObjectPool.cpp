@@ -0,0 +1,174 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+
+#include <algorithm>	// std::find()
+#include <new>			// ::operator new(), ::operator delete()
+
+
+namespace OpenXcom
+{
+
+/**
+ * Creates an ObjectPool.
+ * @note No memory is taken until the first allocate().
+ * @param size		- size of the objects
+ * @param blocks	- quantity of blocks per chunk
+ */
+ObjectPool::ObjectPool(
+		size_t size,
+		size_t blocks)
+	:
+		_blocks(blocks),
+		_live(0u),
+		_size(size),
+		_stride(((size < sizeof(Block) ? sizeof(Block) : size) + alignof(std::max_align_t) - 1u)
+					& ~(alignof(std::max_align_t) - 1u)),
+		_free(nullptr)
+{
+	getPools().push_back(this);
+}
+
+/**
+ * Frees all chunks.
+ */
+ObjectPool::~ObjectPool()
+{
+	std::vector<ObjectPool*>& pools (getPools());
+	pools.erase(std::find(
+						pools.begin(),
+						pools.end(),
+						this));
+
+	for (std::vector<char*>::const_iterator
+			i  = _chunks.begin();
+			i != _chunks.end();
+			++i)
+	{
+		::operator delete(*i);
+	}
+}
+
+/**
+ * Gets a block.
+ * @note Takes a new chunk if there are no released blocks.
+ * @param size - size of the object that will be built in the block
+ * @return, pointer to the memory
+ */
+void* ObjectPool::allocate(size_t size)
+{
+	if (size != _size)
+		return ::operator new(size);
+
+	if (_free == nullptr)
+	{
+		char* const chunk (static_cast<char*>(::operator new(_stride * _blocks)));
+		_chunks.push_back(chunk);
+
+		for (size_t
+				i = _blocks;
+				i != 0u;
+				)
+		{
+			Block* const block (reinterpret_cast<Block*>(chunk + _stride * --i));
+			block->next = _free;
+			_free = block;
+		}
+	}
+
+	Block* const block (_free);
+	_free = block->next;
+
+	++_live;
+	return block;
+}
+
+/**
+ * Returns a block.
+ * @param block	- pointer to the memory; the object in it has been destroyed
+ * @param size	- size of the object that was in the block
+ */
+void ObjectPool::release(
+		void* block,
+		size_t size)
+{
+	if (block != nullptr)
+	{
+		if (size != _size)
+			::operator delete(block);
+		else
+		{
+			Block* const released (static_cast<Block*>(block));
+			released->next = _free;
+			_free = released;
+
+			--_live;
+		}
+	}
+}
+
+/**
+ * Frees all chunks if no block is in use.
+ * @note Called at the end of a battle to hand the memory back in one go.
+ */
+void ObjectPool::trim()
+{
+	if (_live == 0u)
+	{
+		for (std::vector<char*>::const_iterator
+				i  = _chunks.begin();
+				i != _chunks.end();
+				++i)
+		{
+			::operator delete(*i);
+		}
+
+		_chunks.clear();
+		_free = nullptr;
+	}
+}
+
+/**
+ * Trims all ObjectPools.
+ */
+void ObjectPool::trimAll() // static.
+{
+	for (std::vector<ObjectPool*>::const_iterator
+			i  = getPools().begin();
+			i != getPools().end();
+			++i)
+	{
+		(*i)->trim();
+	}
+}
+
+/**
+ * Gets the list of all ObjectPools.
+ * @note The list is built on first use so that pools that are static members
+ * of other classes can register regardless of the order of initialization.
+ * @return, reference to a vector of pointers to ObjectPools
+ */
+std::vector<ObjectPool*>& ObjectPool::getPools() // static/private.
+{
+	static std::vector<ObjectPool*> pools;
+	return pools;
+}
+
+}
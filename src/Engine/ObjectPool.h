@@ -0,0 +1,98 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_OBJECTPOOL_H
+#define OPENXCOM_OBJECTPOOL_H
+
+#include <cstddef>		// size_t
+#include <vector>		// std::vector
+
+
+namespace OpenXcom
+{
+
+/**
+ * Hands out blocks of one size from large chunks of memory so that objects
+ * that are created and deleted in bulk - or often, such as Projectiles - don't
+ * each go through the general allocator.
+ * @note A block doesn't move while it is in use so pointers to the objects in
+ * it stay valid. Released blocks are reused first. The chunks are freed
+ * together by trim() once no block is in use - SavedBattleGame trims all pools
+ * at the end of a battle.
+ * @note A class uses a pool through its own operator new and operator delete
+ * - see Projectile for example. Requests of any other size - such as for a
+ * derived class - go to the general allocator.
+ * @note Main-thread only.
+ */
+class ObjectPool
+{
+
+private:
+	/**
+	 * A released block - the link to the next is stored in the block itself.
+	 */
+	struct Block
+	{
+		Block* next;
+	};
+
+	size_t
+		_blocks,	// blocks per chunk
+		_live,		// blocks in use
+		_size,		// size of the objects
+		_stride;	// size of a block
+	Block* _free;
+
+	std::vector<char*> _chunks;
+
+	/// Gets the list of all ObjectPools.
+	static std::vector<ObjectPool*>& getPools();
+
+	ObjectPool(const ObjectPool&) = delete;
+	ObjectPool& operator= (const ObjectPool&) = delete;
+
+
+	public:
+		/// Creates an ObjectPool.
+		ObjectPool(
+				size_t size,
+				size_t blocks);
+		/// Frees all chunks.
+		~ObjectPool();
+
+		/// Gets a block.
+		void* allocate(size_t size);
+		/// Returns a block.
+		void release(
+				void* block,
+				size_t size);
+
+		/// Frees all chunks if no block is in use.
+		void trim();
+		/// Trims all ObjectPools.
+		static void trimAll();
+
+		/// Gets the quantity of blocks in use.
+		size_t getLive() const
+		{ return _live; }
+};
+
+}
+
+#endif
@@ -20,6 +20,7 @@
 #include "Options.h"
 
 #include <algorithm>	// std::transform()
+#include <cstdlib>		// std::atoi(), std::strtoull()
 //#include <cstdio>		// std::fopen(), fflush(), fclose()
 #include <fstream>		// std::ofstream
 #include <iostream>		// std::cout
@@ -39,6 +40,7 @@
 #include "CrossPlatform.h"
 #include "Exception.h"
 #include "Logger.h"
+#include "LogWriter.h"
 #include "Screen.h"
 
 
@@ -108,6 +110,8 @@ bool init(
 		else
 			throw Exception(st + " not found");
 
+		LogWriter::start();
+
 
 		Log(LOG_INFO) << "Data-folders:";
 		for (std::vector<std::string>::const_iterator
@@ -190,6 +194,20 @@ bool showHelp(
 		help << " use PATH as the default User Folder instead of auto-detecting" << std::endl << std::endl;
 		help << "-cfg PATH" << std::endl;
 		help << " use PATH as the default Config Folder instead of auto-detecting" << std::endl << std::endl;
+		help << "-bench FILE" << std::endl;
+		help << " play the tactical in save FILE to its end without display or sound and report timings" << std::endl << std::endl;
+		help << "-benchGenerate N" << std::endl;
+		help << " play a tactical generated from RNG-seed N instead of a saved one" << std::endl << std::endl;
+		help << "-benchSeed N" << std::endl;
+		help << " use N as the RNG-seed of the bench instead of the seed in the save" << std::endl << std::endl;
+		help << "-benchTurns N" << std::endl;
+		help << " end the bench after N turns (default 30)" << std::endl << std::endl;
+		help << "-soak FILE" << std::endl;
+		help << " run the Geoscape of save FILE (or \"new\" for a new game) without display or sound and report timings" << std::endl << std::endl;
+		help << "-soakSeed N" << std::endl;
+		help << " use N as the RNG-seed of the soak instead of the seed in the save" << std::endl << std::endl;
+		help << "-soakDays N" << std::endl;
+		help << " end the soak after N days (default 90)" << std::endl << std::endl;
 		help << "-KEY VALUE" << std::endl;
 		help << " set option KEY to VALUE instead of default/loaded value (eg. -displayWidth 640)" << std::endl << std::endl;
 		help << "-help" << std::endl;
@@ -247,6 +265,23 @@ void loadArgs(
 					_dirConfig = CrossPlatform::endPath(argv[i + 1u]);
 				else if	(arg == "pic")
 					_dirPic = CrossPlatform::endPath(argv[i + 1u]);
+				else if	(arg == "bench")
+					benchBattle = argv[i + 1u];
+				else if	(arg == "benchgenerate")
+				{
+					benchGenerate = true;
+					benchSeed = std::strtoull(argv[i + 1u], nullptr, 10);
+				}
+				else if	(arg == "benchseed")
+					benchSeed = std::strtoull(argv[i + 1u], nullptr, 10);
+				else if	(arg == "benchturns")
+					benchTurns = std::atoi(argv[i + 1u]);
+				else if	(arg == "soak")
+					soakGame = argv[i + 1u];
+				else if	(arg == "soakseed")
+					soakSeed = std::strtoull(argv[i + 1u], nullptr, 10);
+				else if	(arg == "soakdays")
+					soakDays = std::atoi(argv[i + 1u]);
 				else
 					_cLine[arg] = argv[i + 1u]; // save this command line option for now, apply it later
 			}
@@ -564,6 +599,7 @@ void createOptions()
 
 	_info.push_back(OptionInfo("engineLooper",							&engineLooper, "wilecoyote"));
 	_info.push_back(OptionInfo("traceAI",								&traceAI, 0));
+	_info.push_back(OptionInfo("logLevelAI",							&logLevelAI, LOG_VERBOSE)); // see SeverityLevel in Logger.h
 	_info.push_back(OptionInfo("verboseLogging",						&verboseLogging, false));
 	_info.push_back(OptionInfo("stereoSound",							&stereoSound, true));
 	_info.push_back(OptionInfo("audioSampleRate",						&audioSampleRate, 22050));
@@ -602,6 +638,12 @@ void createOptions()
 	_info.push_back(OptionInfo("battleAlienSpeed",						&battleAlienSpeed, 30));
 	_info.push_back(OptionInfo("battlePreviewPath",						reinterpret_cast<int*>(&battlePreviewPath), PATH_NONE)); // requires double-click to confirm moves
 	_info.push_back(OptionInfo("fpsCounter",							&fpsCounter,       false));
+	_info.push_back(OptionInfo("profilerOverlay",						&profilerOverlay,  false));
+	_info.push_back(OptionInfo("profilerTraceSeconds",					&profilerTraceSeconds, 10)); // seconds of trace kept for export
+	_info.push_back(OptionInfo("workerThreads",							&workerThreads, 0)); // 0 = one per core
+	_info.push_back(OptionInfo("battleDrawCheck",						&battleDrawCheck, false)); // compare threaded battlescape-draws against serial draws
+	_info.push_back(OptionInfo("battleFileCache",						&battleFileCache, true)); // keep terrain MAP/RMP/MCD files in memory between battles
+	_info.push_back(OptionInfo("battleFastAlienTurn",					&battleFastAlienTurn, false)); // resolve aLien actions that the player can't see w/out animating them
 //	_info.push_back(OptionInfo("globeDetail",							&globeDetail,      true));
 //	_info.push_back(OptionInfo("globeRadarLines",						&globeRadarLines,  true));
 	_info.push_back(OptionInfo("globeFlightPaths",						&globeFlightPaths, true));
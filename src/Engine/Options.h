@@ -20,6 +20,7 @@
 #ifndef OPENXCOM_OPTIONS_H
 #define OPENXCOM_OPTIONS_H
 
+#include <cstdint>	// uint64_t
 #include <string>	// std::string
 //#include <vector>	// std::vector
 
@@ -31,7 +31,9 @@ OPT int
 	FPSUnfocused,
 	dragScrollTimeTolerance,
 	dragScrollPixelTolerance,
-	pauseMode;
+	pauseMode,
+	profilerTraceSeconds,
+	workerThreads;
 OPT bool
 	fullscreen,
 	borderless,
@@ -47,6 +49,10 @@ OPT bool
 	debug,
 	debugUi,
 	fpsCounter,
+	profilerOverlay,
+	battleDrawCheck,
+	battleFileCache,
+	battleFastAlienTurn,
 	reSeedOnLoad,
 	keepAspectRatio,
 	nonSquarePixelRatio,
@@ -142,7 +148,8 @@ OPT int
 	battleAlienSpeed,
 	battleExplosionHeight,
 	battlescapeScale,
-	traceAI;
+	traceAI,
+	logLevelAI;
 OPT bool
 	battleInstantGrenade,
 	battleNotifyDeath,
@@ -206,6 +213,8 @@ OPT SDLKey
 
 // Flags and other stuff that don't need OptionInfo's.
 OPT bool
+	benchGenerate,
+	headless,
 	mute,
 	reload,
 	safeOpenGL,
@@ -213,11 +222,19 @@ OPT bool
 	safeHQXFilter,
 	safeXBRZFilter;
 OPT int
+	benchTurns,
+	soakDays,
 	safeDisplayWidth,
 	safeDisplayHeight,
 	safeBattlescapeScale,
 	safeGeoscapeScale;
-OPT std::string safeOpenGLShader;
+OPT std::string
+	benchBattle,
+	safeOpenGLShader,
+	soakGame;
+OPT uint64_t
+	benchSeed,
+	soakSeed;
 OPT std::vector<std::string>
 	rulesets,
 	badRules;
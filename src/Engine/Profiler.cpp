@@ -0,0 +1,355 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>	// std::max
+#include <fstream>		// std::ofstream
+#include <iomanip>		// std::setw, std::setprecision
+#include <sstream>		// std::ostringstream
+
+#include "Logger.h"
+#include "Options.h"
+
+
+namespace OpenXcom
+{
+
+bool Profiler::_enabled (false);							// static/private.
+size_t														// static/private.
+	Profiler::_rollCursor (0u),
+	Profiler::_rollFrames (0u);
+Profiler::ZoneStat Profiler::_zones[PZ_ZONES] {};			// static/private.
+
+std::chrono::steady_clock::time_point						// static/private.
+	Profiler::_epoch      (std::chrono::steady_clock::now()),
+	Profiler::_frameStart (std::chrono::steady_clock::now());
+std::deque<Profiler::TraceEvent> Profiler::_trace;			// static/private.
+
+
+/**
+ * Enables or disables this Profiler.
+ * @note Totals are kept when disabled.
+ * @param enable - true to enable (default true)
+ */
+void Profiler::enable(bool enable) // static.
+{
+	_enabled = enable;
+}
+
+/**
+ * Clears all totals and the trace.
+ * @note The nesting-depths are kept since reset() can be called from inside an
+ * open zone - eg. by the bench or the soak in StartState::think().
+ */
+void Profiler::reset() // static.
+{
+	int depth;
+	for (size_t
+			i = 0u;
+			i != PZ_ZONES;
+			++i)
+	{
+		depth = _zones[i].depth;
+		_zones[i] = ZoneStat();
+		_zones[i].depth = depth;
+	}
+
+	_rollCursor =
+	_rollFrames = 0u;
+
+	_trace.clear();
+	_epoch =
+	_frameStart = std::chrono::steady_clock::now();
+}
+
+/**
+ * Enters a zone.
+ * @note Zones that are re-entered - eg. Pathfinding called by Pathfinding -
+ * are timed by their outermost entry only.
+ * @param zone - the ProfileZone
+ * @return, true if this is the outermost entry of the zone
+ */
+bool Profiler::enter(ProfileZone zone) // static.
+{
+	return (_zones[zone].depth++ == 0);
+}
+
+/**
+ * Leaves a zone and adds its elapsed time.
+ * @param zone	- the ProfileZone
+ * @param start	- reference to the time the zone was entered
+ * @param ns	- elapsed nanoseconds (0 if not the outermost entry)
+ */
+void Profiler::leave( // static.
+		ProfileZone zone,
+		const std::chrono::steady_clock::time_point& start,
+		uint64_t ns)
+{
+	if (--_zones[zone].depth == 0)
+	{
+		++_zones[zone].calls;
+		_zones[zone].ns += ns;
+		_zones[zone].frameNs += ns;
+
+		addTrace(getLabel(zone), start, ns);
+
+		size_t bucket (0u);
+		for (uint64_t
+				us = ns / 1000u;
+				us != 0u && bucket != HIST_BUCKETS - 1u;
+				us >>= 1u)
+		{
+			++bucket;
+		}
+		++_zones[zone].hist[bucket];
+	}
+}
+
+/**
+ * Adds an event to the trace.
+ * @note The oldest event is dropped once there are TRACE_CAP events.
+ * @param label	- label of the event
+ * @param start	- reference to the time the event started
+ * @param ns	- duration in nanoseconds
+ */
+void Profiler::addTrace( // static/private.
+		const char* label,
+		const std::chrono::steady_clock::time_point& start,
+		uint64_t ns)
+{
+	if (_trace.size() == TRACE_CAP)
+		_trace.pop_front();
+
+	TraceEvent event;
+	event.label = label;
+	event.start = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+										start - _epoch).count());
+	event.dur = ns / 1000u;
+	_trace.push_back(event);
+}
+
+/**
+ * Closes the current frame.
+ * @note Called by the Game once per engine-cycle. Moves the per-frame times of
+ * the zones into their rolling window, adds the frame itself to the trace, and
+ * drops trace-events older than 'Options::profilerTraceSeconds'.
+ */
+void Profiler::endFrame() // static.
+{
+	for (size_t
+			i = 0u;
+			i != PZ_ZONES;
+			++i)
+	{
+		ZoneStat& stat (_zones[i]);
+		stat.rollNs -= stat.roll[_rollCursor];
+		stat.rollNs += (stat.roll[_rollCursor] = stat.frameNs);
+		stat.frameNs = 0u;
+	}
+
+	if (++_rollCursor == ROLL_FRAMES)
+		_rollCursor = 0u;
+	if (_rollFrames != ROLL_FRAMES)
+		++_rollFrames;
+
+	const std::chrono::steady_clock::time_point now (std::chrono::steady_clock::now());
+	addTrace(
+			"frame",
+			_frameStart,
+			static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+								  now - _frameStart).count()));
+	_frameStart = now;
+
+	const uint64_t
+		nowUs (static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+									 now - _epoch).count())),
+		keepUs (static_cast<uint64_t>(std::max(1, Options::profilerTraceSeconds)) * 1000000u);
+
+	while (_trace.empty() == false
+		&& _trace.front().start + keepUs < nowUs)
+	{
+		_trace.pop_front();
+	}
+}
+
+/**
+ * Gets the total time of a zone in milliseconds.
+ * @param zone - the ProfileZone
+ * @return, milliseconds
+ */
+double Profiler::getMs(ProfileZone zone) // static.
+{
+	return static_cast<double>(_zones[zone].ns) / 1.e6;
+}
+
+/**
+ * Gets the quantity of entries to a zone.
+ * @param zone - the ProfileZone
+ * @return, quantity of outermost entries
+ */
+uint64_t Profiler::getCalls(ProfileZone zone) // static.
+{
+	return _zones[zone].calls;
+}
+
+/**
+ * Gets the average time per frame of a zone over the last frames.
+ * @param zone - the ProfileZone
+ * @return, milliseconds per frame
+ */
+double Profiler::getRollingMs(ProfileZone zone) // static.
+{
+	if (_rollFrames != 0u)
+		return static_cast<double>(_zones[zone].rollNs) / static_cast<double>(_rollFrames) / 1.e6;
+
+	return 0.;
+}
+
+/**
+ * Gets the label of a zone.
+ * @param zone - the ProfileZone
+ * @return, label
+ */
+const char* Profiler::getLabel(ProfileZone zone) // static.
+{
+	static const char* const labels[PZ_ZONES]
+	{
+		"ai",			//  0
+		"pathfinding",	//  1
+		"fov",			//  2
+		"reaction",		//  3
+		"explosion",	//  4
+		"geo5sec",		//  5
+		"geo10min",		//  6
+		"geo30min",		//  7
+		"geo1hour",		//  8
+		"geo1day",		//  9
+		"geo1month",	// 10
+		"think",		// 11
+		"map",			// 12
+		"globe",		// 13
+		"lighting",		// 14
+		"flip",			// 15
+		"zoom"			// 16
+	};
+	return labels[zone];
+}
+
+/**
+ * Formats the totals as a table.
+ * @note Zones are inclusive - eg. the FoV that the AI calculates while
+ * planning is counted under both "ai" and "fov". Zones that were never entered
+ * are skipped.
+ * @return, one line per zone: label, milliseconds, calls
+ */
+std::string Profiler::report() // static.
+{
+	std::ostringstream oststr;
+	oststr << std::fixed << std::setprecision(3);
+
+	for (size_t
+			i = 0u;
+			i != PZ_ZONES;
+			++i)
+	{
+		const ProfileZone zone (static_cast<ProfileZone>(i));
+		if (getCalls(zone) != 0u)
+			oststr << std::left  << std::setw(12) << getLabel(zone)
+				   << std::right << std::setw(14) << getMs(zone) << " ms"
+				   << std::setw(12) << getCalls(zone) << " calls\n";
+	}
+	return oststr.str();
+}
+
+/**
+ * Formats the duration-histograms as a table.
+ * @note Each line is a zone's label followed by "<bound:count" pairs for its
+ * non-empty buckets where 'bound' is the bucket's upper bound in microseconds.
+ * Zones that were never entered are skipped.
+ * @return, one line per zone
+ */
+std::string Profiler::reportHistograms() // static.
+{
+	std::ostringstream oststr;
+
+	for (size_t
+			i = 0u;
+			i != PZ_ZONES;
+			++i)
+	{
+		if (_zones[i].calls != 0u)
+		{
+			oststr << std::left << std::setw(12) << getLabel(static_cast<ProfileZone>(i));
+			for (size_t
+					j = 0u;
+					j != HIST_BUCKETS;
+					++j)
+			{
+				if (_zones[i].hist[j] != 0u)
+				{
+					if (j != HIST_BUCKETS - 1u)
+						oststr << " <" << (1uLL << j) << "us:";
+					else
+						oststr << " >=" << (1uLL << (j - 1u)) << "us:";
+					oststr << _zones[i].hist[j];
+				}
+			}
+			oststr << "\n";
+		}
+	}
+	return oststr.str();
+}
+
+
+/**
+ * Writes the trace to a file in Chrome's trace-event format.
+ * @note Load the file in "chrome://tracing" or Perfetto. Each zone-entry and
+ * each frame is a complete ("X") event on a single thread.
+ * @param file - reference to the path of the JSON output file
+ * @return, true if written
+ */
+bool Profiler::exportTrace(const std::string& file) // static.
+{
+	std::ofstream ofstr (file.c_str(), std::ios::out | std::ios::trunc);
+	if (ofstr.is_open() == false)
+	{
+		Log(LOG_ERROR) << "Profiler: could not write " << file;
+		return false;
+	}
+
+	ofstr << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	for (std::deque<TraceEvent>::const_iterator
+			i  = _trace.begin();
+			i != _trace.end();
+			++i)
+	{
+		if (i != _trace.begin()) ofstr << ",";
+		ofstr << "\n{\"name\":\"" << i->label
+			  << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << i->start
+			  << ",\"dur\":" << i->dur << "}";
+	}
+	ofstr << "\n]}\n";
+	ofstr.close();
+
+	Log(LOG_INFO) << "Profiler: wrote " << _trace.size() << " events to " << file;
+	return true;
+}
+
+}
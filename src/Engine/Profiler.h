@@ -0,0 +1,217 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_PROFILER_H
+#define OPENXCOM_PROFILER_H
+
+#include <chrono>		// std::chrono
+#include <cstdint>		// uint64_t
+#include <deque>		// std::deque
+#include <string>		// std::string
+
+
+namespace OpenXcom
+{
+
+/**
+ * The zones that the Profiler keeps time for.
+ */
+enum ProfileZone
+{
+	PZ_AI,			// 0 - AI planning
+	PZ_PATHFINDING,	// 1
+	PZ_FOV,			// 2 - field-of-view and unit-spotting
+	PZ_REACTION,	// 3 - reaction-fire checks
+	PZ_EXPLOSION,	// 4 - explosion and terrain-destruction
+	PZ_GEO_5SEC,	// 5 - the Geoscape time-handlers
+	PZ_GEO_10MIN,	// 6
+	PZ_GEO_30MIN,	// 7
+	PZ_GEO_1HOUR,	// 8
+	PZ_GEO_1DAY,	// 9
+	PZ_GEO_1MONTH,	// 10
+	PZ_THINK,		// 11 - the top State's think()
+	PZ_MAP,			// 12 - Map::draw() incl. drawTerrain()
+	PZ_GLOBE,		// 13 - Globe::draw()
+	PZ_LIGHTING,	// 14 - terrain- and unit-lighting
+	PZ_FLIP,		// 15 - Screen::flip() incl. scaling
+	PZ_ZOOM,		// 16 - Zoom::flipWithZoom()
+
+	PZ_ZONES		// 17 - quantity of zones
+};
+
+
+/**
+ * Keeps wall-time totals for the ProfileZones.
+ * @note Timing is done by a ProfileScope on the main-thread only. When the
+ * Profiler is disabled a scope costs one test of a static bool.
+ * @note Besides the totals the Profiler keeps a per-frame average of each zone
+ * over the last ROLL_FRAMES frames for ProfilerOverlay and a trace of the
+ * entries of the last 'Options::profilerTraceSeconds' seconds that can be
+ * exported in Chrome's trace-event format.
+ */
+class Profiler
+{
+
+public:
+	/// The quantity of histogram-buckets per zone. Bucket 0 holds entries
+	/// under 1 microsecond; bucket i holds entries under 2^i microseconds; the
+	/// last bucket holds everything longer.
+	static const size_t HIST_BUCKETS = 22u;
+	/// The quantity of frames that rolling timings are averaged over.
+	static const size_t ROLL_FRAMES = 60u;
+	/// The maximum quantity of trace-events kept regardless of their age.
+	static const size_t TRACE_CAP = 1u << 20u;
+
+
+private:
+	/**
+	 * The totals of a zone.
+	 */
+	struct ZoneStat
+	{
+		uint64_t
+			calls,	// quantity of outermost entries
+			ns,		// total time in nanoseconds
+			hist[HIST_BUCKETS],
+			frameNs,			// time in the current frame
+			rollNs,				// sum of 'roll'
+			roll[ROLL_FRAMES];	// time in each of the last frames
+		int depth;	// current nesting of the zone - only outermost entries are timed
+	};
+
+	/**
+	 * An entry to a zone - or a frame - for the trace.
+	 */
+	struct TraceEvent
+	{
+		const char* label;
+		uint64_t
+			start,	// microseconds since '_epoch'
+			dur;	// microseconds
+	};
+
+	static bool _enabled;
+	static size_t
+		_rollCursor,
+		_rollFrames;
+	static ZoneStat _zones[PZ_ZONES];
+
+	static std::chrono::steady_clock::time_point
+		_epoch,
+		_frameStart;
+	static std::deque<TraceEvent> _trace;
+
+	/// Adds an event to the trace.
+	static void addTrace(
+			const char* label,
+			const std::chrono::steady_clock::time_point& start,
+			uint64_t ns);
+
+
+	public:
+		/// Enables or disables the Profiler.
+		static void enable(bool enable = true);
+		/// Checks if the Profiler is enabled.
+		static bool isEnabled()
+		{ return _enabled; }
+
+		/// Clears all totals.
+		static void reset();
+
+		/// Enters a zone.
+		static bool enter(ProfileZone zone);
+		/// Leaves a zone and adds its elapsed time.
+		static void leave(
+				ProfileZone zone,
+				const std::chrono::steady_clock::time_point& start,
+				uint64_t ns);
+
+		/// Closes the current frame.
+		static void endFrame();
+
+		/// Gets the total time of a zone in milliseconds.
+		static double getMs(ProfileZone zone);
+		/// Gets the quantity of entries to a zone.
+		static uint64_t getCalls(ProfileZone zone);
+		/// Gets the average time per frame of a zone over the last frames.
+		static double getRollingMs(ProfileZone zone);
+		/// Gets the label of a zone.
+		static const char* getLabel(ProfileZone zone);
+
+		/// Formats the totals as a table.
+		static std::string report();
+		/// Formats the duration-histograms as a table.
+		static std::string reportHistograms();
+		/// Writes the trace to a file in Chrome's trace-event format.
+		static bool exportTrace(const std::string& file);
+};
+
+
+/**
+ * Times a ProfileZone for the lifetime of this object.
+ */
+class ProfileScope
+{
+
+private:
+	bool
+		_entered,
+		_outer;
+	ProfileZone _zone;
+	std::chrono::steady_clock::time_point _start;
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator= (const ProfileScope&) = delete;
+
+
+	public:
+		/// Enters a zone.
+		explicit ProfileScope(ProfileZone zone)
+			:
+				_entered(Profiler::isEnabled()),
+				_outer(false),
+				_zone(zone)
+		{
+			if (_entered == true
+				&& (_outer = Profiler::enter(zone)) == true)
+			{
+				_start = std::chrono::steady_clock::now();
+			}
+		}
+
+		/// Leaves the zone.
+		~ProfileScope()
+		{
+			if (_entered == true)
+			{
+				uint64_t ns;
+				if (_outer == true)
+					ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+											   std::chrono::steady_clock::now() - _start).count());
+				else
+					ns = 0u;
+
+				Profiler::leave(_zone, _start, ns);
+			}
+		}
+};
+
+}
+
+#endif
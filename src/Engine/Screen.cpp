@@ -34,6 +34,7 @@
 #include "Exception.h"
 #include "Logger.h"
 #include "Options.h"
+#include "Profiler.h"
 #include "Surface.h"
 #include "Timer.h"
 #include "Zoom.h"
@@ -248,6 +249,8 @@ void Screen::handle(Action* action)
  */
 void Screen::flip()
 {
+	const ProfileScope scope (PZ_FLIP);
+
 	if (useOpenGL() == true
 		|| _screen->w != _baseWidth
 		|| _screen->h != _baseHeight)
@@ -34,6 +34,7 @@
 #include "../Interface/ComboBox.h"
 #include "../Interface/Cursor.h"
 #include "../Interface/FpsCounter.h"
+#include "../Interface/ProfilerOverlay.h"
 #include "../Interface/Slider.h"
 #include "../Interface/TextButton.h"
 #include "../Interface/TextEdit.h"
@@ -290,8 +291,18 @@ void State::init() // virtual.
 	_game->getFpsCounter()->setColor(static_cast<Uint8>(_cursorColor + 2u));
 	_game->getFpsCounter()->draw();
 
+	_game->getProfilerOverlay()->setPalette(_palette);
+	_game->getProfilerOverlay()->setColor(static_cast<Uint8>(_cursorColor + 2u));
+
 	if (_game->getResourcePack() != nullptr)
+	{
+		_game->getProfilerOverlay()->initText(
+										_game->getResourcePack()->getFont("FONT_BIG"),
+										_game->getResourcePack()->getFont("FONT_SMALL"),
+										_game->getLanguage());
 		_game->getResourcePack()->setPalette(_palette);
+	}
+	_game->getProfilerOverlay()->draw();
 
 	Window* window;
 	for (std::vector<Surface*>::const_iterator
@@ -556,6 +567,9 @@ void State::setPalette(
 		_game->getFpsCounter()->setPalette(_palette);
 		_game->getFpsCounter()->draw();
 
+		_game->getProfilerOverlay()->setPalette(_palette);
+		_game->getProfilerOverlay()->draw();
+
 		if (_game->getResourcePack() != nullptr)
 			_game->getResourcePack()->setPalette(_palette);
 	}
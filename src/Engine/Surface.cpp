@@ -1045,7 +1045,9 @@ static inline void func(
  * Specific blit function to blit battlescape sprites in different shades in a
  * fast way.
  * @note There is no surface locking here - you have to make sure to lock the
- * surface at the start of blitting and unlock it when done.
+ * surface at the start of blitting and unlock it when done. A blit clipped to
+ * an area writes exactly the pixels inside it that the unclipped blit writes so
+ * that separate areas of one Surface can be drawn on separate threads.
  * @param surface		- Surface to blit to
  * @param x				- x-position of Surface blitted to
  * @param y				- y-position of Surface blitted to
@@ -1054,6 +1056,8 @@ static inline void func(
  * @param colorGroup	- the actual colorblock + 1 because 0 is no new base color (default 0)
  * @param halfLeft		- kL_add: blits only the left half - NOTE This conflicts w/ 'halfRight' (default false)
  *						  but i am far too lazy to refactor a gajillion blitNShade calls!
+ * @param clip			- pointer to the area of 'surface' that may be written
+ *						  (default nullptr for all of it)
  */
 void Surface::blitNShade(
 		Surface* const surface,
@@ -1062,7 +1066,8 @@ void Surface::blitNShade(
 		int colorOffset,
 		bool halfRight,
 		int colorGroup,
-		bool halfLeft)
+		bool halfLeft,
+		const GraphSubset* const clip)
 {
 	ShaderMove<Uint8> src (this, x,y);
 
@@ -1079,18 +1084,22 @@ void Surface::blitNShade(
 		src.setRange(area);
 	}
 
+	ShaderMove<Uint8> dst (ShaderSurface(surface));
+	if (clip != nullptr)
+		dst.setRange(*clip);
+
 	if (colorGroup != 0)
 	{
 		(--colorGroup) <<= 4u;
 		ShaderDraw<ColorReplace>(
-							ShaderSurface(surface),
+							dst,
 							src,
 							ShaderScalar(colorOffset),
 							ShaderScalar(colorGroup));
 	}
 	else
 		ShaderDraw<StandartShade>(
-							ShaderSurface(surface),
+							dst,
 							src,
 							ShaderScalar(colorOffset));
 }
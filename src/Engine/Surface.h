@@ -314,7 +314,8 @@ protected:
 				int colorOffset = 0,
 				bool halfRight = false,
 				int colorGroup = 0,
-				bool halfLeft = false);
+				bool halfLeft = false,
+				const GraphSubset* const clip = nullptr);
 		/// Specific blit function to blit battlescape sprites.
 /*		void blitNShade(
 				Surface* const surface,
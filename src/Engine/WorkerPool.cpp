@@ -0,0 +1,197 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorkerPool.h"
+
+#include <algorithm>	// std::min
+#include <thread>		// std::thread::hardware_concurrency
+
+#include "Logger.h"
+#include "Options.h"
+
+
+namespace OpenXcom
+{
+
+std::atomic<bool> WorkerPool::_quit (false);	// static/private.
+std::atomic<size_t> WorkerPool::_next (0u);		// static/private.
+
+size_t											// static/private.
+	WorkerPool::_count   (0u),
+	WorkerPool::_workers (0u);
+void* WorkerPool::_data (nullptr);				// static/private.
+WorkerPool::Task WorkerPool::_task (nullptr);	// static/private.
+
+SDL_sem											// static/private.
+	* WorkerPool::_semStart (nullptr),
+	* WorkerPool::_semDone  (nullptr);
+SDL_Thread* WorkerPool::_threads[THREADS_MAX] {}; // static/private.
+
+
+/**
+ * Creates the worker-threads.
+ * @note The calling thread counts as one of the threads so one fewer worker
+ * than the quantity of threads is created.
+ */
+void WorkerPool::start() // static.
+{
+	if (_semStart == nullptr)
+	{
+		size_t threads;
+		if (Options::workerThreads > 0)
+			threads = static_cast<size_t>(Options::workerThreads);
+		else
+			threads = static_cast<size_t>(std::thread::hardware_concurrency());
+
+		if (threads > 1u)
+		{
+			_semStart = SDL_CreateSemaphore(0u);
+			_semDone  = SDL_CreateSemaphore(0u);
+			if (_semStart != nullptr && _semDone != nullptr)
+			{
+				_quit.store(false);
+
+				const size_t workers (std::min(threads - 1u, THREADS_MAX));
+				while (_workers != workers
+					&& (_threads[_workers] = SDL_CreateThread(work, nullptr)) != nullptr)
+				{
+					++_workers;
+				}
+			}
+		}
+		Log(LOG_INFO) << "WorkerPool: " << getThreads() << " thread(s)";
+	}
+}
+
+/**
+ * Stops and joins the worker-threads.
+ */
+void WorkerPool::stop() // static.
+{
+	if (_semStart != nullptr)
+	{
+		_quit.store(true);
+		for (size_t
+				i = 0u;
+				i != _workers;
+				++i)
+		{
+			SDL_SemPost(_semStart);
+		}
+
+		for (size_t
+				i = 0u;
+				i != _workers;
+				++i)
+		{
+			SDL_WaitThread(_threads[i], nullptr);
+			_threads[i] = nullptr;
+		}
+		_workers = 0u;
+
+		SDL_DestroySemaphore(_semStart);
+		SDL_DestroySemaphore(_semDone);
+		_semStart =
+		_semDone  = nullptr;
+	}
+}
+
+/**
+ * Runs a task for each index of a loop and waits for all to finish.
+ * @note The order in which indices run is unspecified so tasks must not
+ * depend on each other.
+ * @param task	- the Task
+ * @param data	- pointer to data for the task
+ * @param count	- quantity of indices
+ */
+void WorkerPool::run( // static.
+		Task task,
+		void* data,
+		size_t count)
+{
+	if (_workers == 0u || count < 2u)
+	{
+		for (size_t
+				i = 0u;
+				i != count;
+				++i)
+		{
+			task(data, i);
+		}
+		return;
+	}
+
+	_task  = task;
+	_data  = data;
+	_count = count;
+	_next.store(0u);
+
+	for (size_t
+			i = 0u;
+			i != _workers;
+			++i)
+	{
+		SDL_SemPost(_semStart);
+	}
+
+	runTasks();
+
+	for (size_t
+			i = 0u;
+			i != _workers;
+			++i)
+	{
+		SDL_SemWait(_semDone);
+	}
+}
+
+/**
+ * Runs indices of the current loop until there are none left.
+ */
+void WorkerPool::runTasks() // static/private.
+{
+	for (size_t
+			i = _next.fetch_add(1u);
+			i < _count;
+			i = _next.fetch_add(1u))
+	{
+		_task(_data, i);
+	}
+}
+
+/**
+ * Runs loops until stopped.
+ * @note This is the function of each worker-thread.
+ * @return, 0
+ */
+int WorkerPool::work(void*) // static/private.
+{
+	for (;;)
+	{
+		SDL_SemWait(_semStart);
+		if (_quit.load() == true)
+			break;
+
+		runTasks();
+		SDL_SemPost(_semDone);
+	}
+	return 0;
+}
+
+}
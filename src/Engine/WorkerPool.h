@@ -0,0 +1,89 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_WORKERPOOL_H
+#define OPENXCOM_WORKERPOOL_H
+
+#include <atomic>		// std::atomic
+
+#include <SDL/SDL_thread.h>
+
+
+namespace OpenXcom
+{
+
+/**
+ * A fixed set of threads that run the tasks of a parallel loop.
+ * @note run() hands out the indices of a loop to the workers and to the calling
+ * thread and returns when all are done; one loop runs at a time and only the
+ * main-thread may call run(). The quantity of threads is 'Options::workerThreads'
+ * or the quantity of cores if that is 0. With one thread - or if the threads
+ * can't be created - run() is a plain loop on the calling thread.
+ */
+class WorkerPool
+{
+
+public:
+	/// A task of a loop: called once for each index.
+	typedef void (*Task)(void* data, size_t index);
+
+
+private:
+	static const size_t THREADS_MAX = 32u;
+
+	static std::atomic<bool> _quit;
+	static std::atomic<size_t> _next;
+
+	static size_t
+		_count,
+		_workers;
+	static void* _data;
+	static Task _task;
+
+	static SDL_sem
+		* _semStart,
+		* _semDone;
+	static SDL_Thread* _threads[THREADS_MAX];
+
+	/// Runs loops until stopped.
+	static int work(void*);
+	/// Runs indices of the current loop until there are none left.
+	static void runTasks();
+
+
+	public:
+		/// Creates the worker-threads.
+		static void start();
+		/// Stops and joins the worker-threads.
+		static void stop();
+
+		/// Gets the quantity of threads that run a loop incl. the calling thread.
+		static size_t getThreads()
+		{ return _workers + 1u; }
+
+		/// Runs a task for each index of a loop and waits for all to finish.
+		static void run(
+				Task task,
+				void* data,
+				size_t count);
+};
+
+}
+
+#endif
@@ -21,6 +21,7 @@
 
 //#include "Logger.h"
 #include "Options.h"
+#include "Profiler.h"
 #include "Screen.h"
 #include "Surface.h"
 
@@ -676,6 +677,8 @@ void Zoom::flipWithZoom( // static.
 		int rightBlackBand,
 		OpenGL* const glOut)
 {
+	const ProfileScope scope (PZ_ZOOM);
+
 	if (Screen::useOpenGL() == true)
 	{
 #ifndef __NO_OPENGL
@@ -0,0 +1,526 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GeoSoak.h"
+
+#include <iomanip>		// std::setprecision
+#include <iostream>		// std::cout
+
+#include "GeoscapeState.h"
+
+#include "../Battlescape/DebriefingState.h" // access TAC_RATING strings.
+
+#include "../Engine/Exception.h"
+#include "../Engine/Game.h"
+#include "../Engine/Logger.h"
+#include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
+#include "../Engine/RNG.h"
+
+#include "../Ruleset/RuleAlienDeployment.h"
+#include "../Ruleset/RuleBaseFacility.h"
+#include "../Ruleset/RuleCountry.h"
+#include "../Ruleset/RuleRegion.h"
+#include "../Ruleset/Ruleset.h"
+#include "../Ruleset/RuleUfo.h"
+
+#include "../Savegame/AlienBase.h"
+#include "../Savegame/AlienMission.h"
+#include "../Savegame/Base.h"
+#include "../Savegame/BaseFacility.h"
+#include "../Savegame/BattleUnitStatistics.h"
+#include "../Savegame/Country.h"
+#include "../Savegame/Craft.h"
+#include "../Savegame/Region.h"
+#include "../Savegame/SavedGame.h"
+#include "../Savegame/Soldier.h"
+#include "../Savegame/SoldierDead.h"
+#include "../Savegame/SoldierDiary.h"
+#include "../Savegame/TerrorSite.h"
+#include "../Savegame/Ufo.h"
+
+
+namespace OpenXcom
+{
+
+bool GeoSoak::_active (false);	// static/private.
+int								// static/private.
+	GeoSoak::_battles  (0),
+	GeoSoak::_days     (0),
+	GeoSoak::_daysDone (0);
+uint64_t GeoSoak::_seed (0uLL);	// static/private.
+
+std::chrono::steady_clock::time_point GeoSoak::_start; // static/private.
+
+std::ostringstream GeoSoak::_samples; // static/private.
+
+
+/**
+ * Loads or creates the campaign and starts the soak.
+ * @note The save-file is 'Options::soakGame' relative to the user-folder or
+ * "new" to start a new campaign. If 'Options::soakSeed' is not zero it replaces
+ * the RNG-seed; the seed is applied after all loading is done so that loading
+ * can't shift the RNG.
+ * @param game - pointer to the Game
+ * @return, true if the campaign is ready
+ */
+bool GeoSoak::start(Game* const game) // static.
+{
+	Log(LOG_INFO) << "GeoSoak: starting " << Options::soakGame;
+
+	SavedGame* playSave;
+	if (Options::soakGame == "new")
+	{
+		playSave = game->getRuleset()->createSave(game, Options::soakSeed);
+		placeFirstBase(game, playSave);
+	}
+	else
+	{
+		Options::reSeedOnLoad = false;
+
+		playSave = new SavedGame(game->getRuleset());
+		game->setSavedGame(playSave);
+		try
+		{
+			playSave->load(Options::soakGame, game->getRuleset());
+		}
+		catch (Exception& e)
+		{
+			Log(LOG_ERROR) << "GeoSoak: " << e.what();
+			return false;
+		}
+		catch (YAML::Exception& e)
+		{
+			Log(LOG_ERROR) << "GeoSoak: " << e.what();
+			return false;
+		}
+
+		if (playSave->getBattleSave() != nullptr)
+		{
+			Log(LOG_ERROR) << "GeoSoak: " << Options::soakGame << " is a tactical save";
+			return false;
+		}
+
+		if (Options::soakSeed != 0uLL)
+			RNG::setSeed(Options::soakSeed);
+	}
+	_seed = RNG::getSeed();
+
+	if ((_days = Options::soakDays) < 1)
+		_days = DAYS_DEFAULT;
+	_daysDone =
+	_battles = 0;
+	_samples.str("");
+	_samples << "day ufos missions craft transfers diary ms\n";
+
+	game->setState(new GeoscapeState());
+
+	Profiler::reset();
+	Profiler::enable();
+	_start = std::chrono::steady_clock::now();
+	_active = true;
+
+	Log(LOG_INFO) << "GeoSoak: seed " << _seed << " days " << _days;
+	return true;
+}
+
+/**
+ * Lays out and places the first Base of a new campaign.
+ * @note Does what BuildBaseState and the PlaceLift/StartFacility states do by
+ * hand: the Base is put at the label of the first Country and its Facilities
+ * are packed into the grid row by row with the access-lift first.
+ * @param game		- pointer to the Game
+ * @param playSave	- pointer to the SavedGame
+ */
+void GeoSoak::placeFirstBase( // static/private.
+		Game* const game,
+		SavedGame* const playSave)
+{
+	const Ruleset* const rules (game->getRuleset());
+	Base* const base (playSave->getBases()->front());
+
+	const RuleCountry* const countryRule (playSave->getCountries()->front()->getRules());
+	const double
+		lon (countryRule->getLabelLongitude()),
+		lat (countryRule->getLabelLatitude());
+
+	base->setLongitude(lon);
+	base->setLatitude(lat);
+	base->setLabel(L"Soak");
+
+	for (std::vector<Craft*>::const_iterator
+			i = base->getCrafts()->begin();
+			i != base->getCrafts()->end();
+			++i)
+	{
+		(*i)->setLongitude(lon);
+		(*i)->setLatitude(lat);
+	}
+
+	std::vector<RuleBaseFacility*> facRules (rules->getStartFacilities());
+	for (std::vector<std::string>::const_iterator
+			i = rules->getBaseFacilitiesList().begin();
+			i != rules->getBaseFacilitiesList().end();
+			++i)
+	{
+		RuleBaseFacility* const facRule (rules->getBaseFacility(*i));
+		if (facRule->isLift() == true)
+		{
+			facRules.insert(facRules.begin(), facRule);
+			break;
+		}
+	}
+
+	bool grid[Base::BASE_SIZE][Base::BASE_SIZE] {};
+	for (std::vector<RuleBaseFacility*>::const_iterator
+			i = facRules.begin();
+			i != facRules.end();
+			++i)
+	{
+		const size_t facSize ((*i)->getSize());
+		bool placed (false);
+		for (size_t
+				y = 0u;
+				y + facSize <= Base::BASE_SIZE && placed == false;
+				++y)
+		{
+			for (size_t
+					x = 0u;
+					x + facSize <= Base::BASE_SIZE && placed == false;
+					++x)
+			{
+				bool clear (true);
+				for (size_t
+						j = 0u;
+						j != facSize * facSize && clear == true;
+						++j)
+				{
+					clear = (grid[x + j % facSize][y + j / facSize] == false);
+				}
+
+				if (clear == true)
+				{
+					for (size_t
+							j = 0u;
+							j != facSize * facSize;
+							++j)
+					{
+						grid[x + j % facSize][y + j / facSize] = true;
+					}
+
+					BaseFacility* const fac (new BaseFacility(*i, base));
+					fac->setX(static_cast<int>(x));
+					fac->setY(static_cast<int>(y));
+					base->getFacilities()->push_back(fac);
+					placed = true;
+				}
+			}
+		}
+
+		if (placed == false)
+			Log(LOG_WARNING) << "GeoSoak: no room for " << (*i)->getType();
+	}
+	base->placeBase();
+}
+
+/**
+ * Resolves a Craft's arrival at its destination.
+ * @note Stands in for ConfirmLandingState, the tactical and DebriefingState: if
+ * the Craft carries soldiers to a crash-site, a landed UFO, a terror-site or an
+ * aLien base the tactical is scored as a win without casualties or recovery.
+ * The win is worth the UFO's score or the deployment's objective-score; it is
+ * added to the Region and Country, recorded in the TacticalStatistics and in
+ * the soldiers' diaries, and the target is removed as a won tactical removes
+ * it. The Craft then returns to base in any case.
+ * @param rules		- pointer to the Ruleset
+ * @param playSave	- pointer to the SavedGame
+ * @param craft		- pointer to the Craft
+ */
+void GeoSoak::resolveArrival( // static.
+		const Ruleset* const rules,
+		SavedGame* const playSave,
+		Craft* const craft)
+{
+	Target* const target (craft->getTarget());
+	Ufo* const ufo (dynamic_cast<Ufo*>(target));
+	TerrorSite* const site (dynamic_cast<TerrorSite*>(target));
+	AlienBase* const aBase (dynamic_cast<AlienBase*>(target));
+
+	const RuleAlienDeployment* ruleDeploy (nullptr);
+	if (site != nullptr)
+		ruleDeploy = site->getTerrorDeployed();
+	else if (aBase != nullptr)
+		ruleDeploy = aBase->getAlienBaseDeployed();
+
+	if (craft->getQtySoldiers() != 0
+		&& (ruleDeploy != nullptr
+			|| (ufo != nullptr
+				&& (ufo->getUfoStatus() == Ufo::LANDED
+					|| ufo->getUfoStatus() == Ufo::CRASHED))))
+	{
+		TacticalStatistics* const tactical (new TacticalStatistics());
+
+		if (ufo != nullptr)
+		{
+			if (ufo->getUfoStatus() == Ufo::CRASHED)
+				tactical->type = "STR_UFO_CRASH_RECOVERY";
+			else
+				tactical->type = "STR_UFO_GROUND_ASSAULT";
+
+			tactical->ufo       = ufo->getRules()->getType();
+			tactical->alienRace = ufo->getAlienRace();
+			tactical->score     = ufo->getRules()->getScore();
+		}
+		else
+		{
+			tactical->type      = ruleDeploy->getType();
+			tactical->alienRace = (site != nullptr) ? site->getAlienRace() : aBase->getAlienRace();
+
+			std::string objectiveText;
+			int objectiveScore;
+			if (ruleDeploy->getObjectiveCompleteInfo(
+												objectiveText,
+												objectiveScore) == true)
+			{
+				tactical->score = objectiveScore;
+			}
+		}
+
+		tactical->id       = static_cast<int>(playSave->getTacticalStatistics().size());
+		tactical->timeStat = *playSave->getTime();
+		tactical->success  = true;
+
+		if      (tactical->score <  101) tactical->rating = TAC_RATING[1u]; // poor
+		else if (tactical->score <  351) tactical->rating = TAC_RATING[2u]; // okay
+		else if (tactical->score <  751) tactical->rating = TAC_RATING[3u]; // good
+		else if (tactical->score < 1251) tactical->rating = TAC_RATING[4u]; // excellent
+		else                             tactical->rating = TAC_RATING[5u]; // terrific
+
+		const double
+			lon (target->getLongitude()),
+			lat (target->getLatitude());
+
+		Region* region (nullptr);
+		for (std::vector<Region*>::const_iterator
+				i  = playSave->getRegions()->begin();
+				i != playSave->getRegions()->end();
+				++i)
+		{
+			if ((*i)->getRules()->insideRegion(lon, lat) == true)
+			{
+				region = *i;
+				tactical->region = region->getRules()->getType();
+				break;
+			}
+		}
+
+		Country* country (nullptr);
+		for (std::vector<Country*>::const_iterator
+				i  = playSave->getCountries()->begin();
+				i != playSave->getCountries()->end();
+				++i)
+		{
+			if ((*i)->getRules()->insideCountry(lon, lat) == true)
+			{
+				country = *i;
+				tactical->country = country->getRules()->getType();
+				break;
+			}
+		}
+
+		playSave->scorePoints(
+						region,
+						country,
+						tactical->score,
+						false);
+
+		Base* const base (craft->getBase());
+		base->expenseCraft(craft);
+
+		for (std::vector<Soldier*>::const_iterator
+				i  = base->getSoldiers()->begin();
+				i != base->getSoldiers()->end();
+				++i)
+		{
+			if ((*i)->getCraft() == craft)
+			{
+				BattleUnitStatistics tacstats;
+				(*i)->getDiary()->postTactical(&tacstats, tactical);
+				(*i)->getDiary()->updateAwards(rules);
+			}
+		}
+		playSave->getTacticalStatistics().push_back(tactical);
+
+		if (ufo != nullptr)
+			ufo->setUfoStatus(Ufo::DESTROYED); // GeoscapeState deletes it after its Craft-loop.
+		else if (site != nullptr)
+		{
+			for (std::vector<TerrorSite*>::const_iterator
+					i  = playSave->getTerrorSites()->begin();
+					i != playSave->getTerrorSites()->end();
+					++i)
+			{
+				if (*i == site)
+				{
+					delete *i; // NOTE: dTor sends Craft targeters back to Base.
+					playSave->getTerrorSites()->erase(i);
+					break;
+				}
+			}
+		}
+		else
+		{
+			for (std::vector<AlienMission*>::const_iterator
+					i  = playSave->getAlienMissions().begin();
+					i != playSave->getAlienMissions().end();
+					++i)
+			{
+				if ((*i)->getAlienBase() == aBase)
+					(*i)->setAlienBase();
+			}
+
+			for (std::vector<AlienBase*>::const_iterator
+					i  = playSave->getAlienBases()->begin();
+					i != playSave->getAlienBases()->end();
+					++i)
+			{
+				if (*i == aBase)
+				{
+					delete *i; // NOTE: dTor sends Craft targeters back to Base.
+					playSave->getAlienBases()->erase(i);
+					break;
+				}
+			}
+		}
+
+		++_battles;
+	}
+	craft->returnToBase();
+}
+
+/**
+ * Records the object-counts at the end of a day.
+ * @note Ends the soak when its quantity of days has passed or the campaign has
+ * ended.
+ * @param game		- pointer to the Game
+ * @param playSave	- pointer to the SavedGame
+ */
+void GeoSoak::sample( // static.
+		Game* const game,
+		SavedGame* const playSave)
+{
+	size_t
+		crafts    (0u),
+		transfers (0u),
+		diary     (0u);
+
+	for (std::vector<Base*>::const_iterator
+			i = playSave->getBases()->begin();
+			i != playSave->getBases()->end();
+			++i)
+	{
+		crafts    += (*i)->getCrafts()->size();
+		transfers += (*i)->getTransfers()->size();
+
+		for (std::vector<Soldier*>::const_iterator
+				j = (*i)->getSoldiers()->begin();
+				j != (*i)->getSoldiers()->end();
+				++j)
+		{
+			diary += (*j)->getDiary()->getMissionTotal();
+		}
+	}
+
+	for (std::vector<SoldierDead*>::const_iterator
+			i = playSave->getDeadSoldiers()->begin();
+			i != playSave->getDeadSoldiers()->end();
+			++i)
+	{
+		diary += (*i)->getDiary()->getMissionTotal();
+	}
+
+	const double wall (std::chrono::duration<double, std::milli>(
+					   std::chrono::steady_clock::now() - _start).count());
+
+	std::ostringstream oststr;
+	oststr << ++_daysDone
+		   << " " << playSave->getUfos()->size()
+		   << " " << playSave->getAlienMissions().size()
+		   << " " << crafts
+		   << " " << transfers
+		   << " " << diary
+		   << " " << std::fixed << std::setprecision(3) << wall;
+
+	Log(LOG_INFO) << "GeoSoak: " << oststr.str();
+	_samples << oststr.str() << "\n";
+
+	if (_daysDone >= _days || playSave->getEnding() != END_NONE)
+		finish(game, playSave);
+}
+
+/**
+ * Reports the outcome and timings and quits the Game.
+ * @note The outcome - days played, the daily object-counts, and the state of
+ * the RNG - is what a regression-test should compare between builds; the
+ * timings are what a benchmark should compare.
+ * @param game		- pointer to the Game
+ * @param playSave	- pointer to the SavedGame
+ */
+void GeoSoak::finish( // static.
+		Game* const game,
+		SavedGame* const playSave)
+{
+	if (_active == true)
+	{
+		const double wall (std::chrono::duration<double, std::milli>(
+						   std::chrono::steady_clock::now() - _start).count());
+		Profiler::enable(false);
+		_active = false;
+
+		std::string result;
+		switch (playSave->getEnding())
+		{
+			case END_WIN:  result = "won";     break;
+			case END_LOSE: result = "lost";    break;
+			default:       result = "running";
+		}
+
+		std::ostringstream oststr;
+		oststr << "soak "		<< Options::soakGame << "\n"
+			   << "seed "		<< _seed << "\n"
+			   << "result "		<< result << "\n"
+			   << "days "		<< _daysDone << "\n"
+			   << "battles "	<< _battles << "\n"
+			   << "funds "		<< playSave->getFunds() << "\n"
+			   << "rng "		<< RNG::getSeed() << "\n"
+			   << std::fixed << std::setprecision(3)
+			   << "wall "		<< wall << " ms\n"
+			   << Profiler::report()
+			   << Profiler::reportHistograms()
+			   << _samples.str();
+
+		Log(LOG_INFO) << "GeoSoak:\n" << oststr.str();
+		std::cout << oststr.str();
+		std::cout.flush();
+
+		game->quit(true);
+	}
+}
+
+}
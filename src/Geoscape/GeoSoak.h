@@ -0,0 +1,100 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_GEOSOAK_H
+#define OPENXCOM_GEOSOAK_H
+
+#include <chrono>		// std::chrono
+#include <cstdint>		// uint64_t
+#include <sstream>		// std::ostringstream
+
+
+namespace OpenXcom
+{
+
+class Craft;
+class Game;
+class Ruleset;
+class SavedGame;
+
+
+/**
+ * Runs the Geoscape for a quantity of days without display or sound and
+ * reports the time spent in each time-handler along with daily object-counts.
+ * @note Started by the "-soak FILE" command-line option; "-soak new" starts a
+ * new campaign instead. Popups are dismissed as they appear, and tacticals -
+ * crash-sites, landed UFOs, terror-sites, aLien bases, and base-assaults - are
+ * won without a tactical. With the same save and RNG-seed the outcome is the
+ * same.
+ */
+class GeoSoak
+{
+
+private:
+	static const int DAYS_DEFAULT = 90;
+
+	static bool _active;
+	static int
+		_battles,
+		_days,
+		_daysDone;
+	static uint64_t _seed;
+
+	static std::chrono::steady_clock::time_point _start;
+
+	static std::ostringstream _samples;
+
+	/// Lays out and places the first Base of a new campaign.
+	static void placeFirstBase(
+			Game* const game,
+			SavedGame* const playSave);
+
+
+	public:
+		/// The quantity of one-second ticks of the Geoscape per engine-cycle.
+		static const int BURST = 3600;
+
+		/// Loads or creates the campaign and starts the soak.
+		static bool start(Game* const game);
+		/// Checks if the soak is running.
+		static bool isActive()
+		{ return _active; }
+
+		/// Counts a battle that was resolved without a tactical.
+		static void countBattle()
+		{ ++_battles; }
+		/// Resolves a Craft's arrival at its destination.
+		static void resolveArrival(
+				const Ruleset* const rules,
+				SavedGame* const playSave,
+				Craft* const craft);
+
+		/// Records the object-counts at the end of a day.
+		static void sample(
+				Game* const game,
+				SavedGame* const playSave);
+		/// Reports the outcome and timings and quits the Game.
+		static void finish(
+				Game* const game,
+				SavedGame* const playSave);
+};
+
+}
+
+#endif
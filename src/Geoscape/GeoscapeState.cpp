@@ -37,6 +37,7 @@
 #include "DogfightState.h"
 #include "FundingState.h"
 #include "GeoscapeCraftState.h"
+#include "GeoSoak.h"
 #include "Globe.h"
 #include "GraphsState.h"
 #include "InterceptState.h"
@@ -66,6 +67,7 @@
 #include "../Engine/Game.h"
 #include "../Engine/Language.h"
 //#include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
 #include "../Engine/RNG.h"
 #include "../Engine/Screen.h"
 #include "../Engine/Sound.h"
@@ -90,7 +92,7 @@
 #include "../Ruleset/RuleArmor.h"
 #include "../Ruleset/RuleBaseFacility.h"
 #include "../Ruleset/RuleCountry.h"
-//#include "../Ruleset/RuleCraft.h"
+#include "../Ruleset/RuleCraft.h"
 #include "../Ruleset/RuleGlobe.h"
 #include "../Ruleset/RuleInterface.h"
 #include "../Ruleset/RuleManufacture.h"
@@ -1025,9 +1027,7 @@ void GeoscapeState::handle(Action* action)
 										j != (*i)->getSoldiers()->end();
 										++j)
 								{
-									(*j)->getDiary()->updateAwards(
-																_rules,
-																_playSave->getTacticalStatistics());
+									(*j)->getDiary()->updateAwards(_rules);
 								}
 							}
 
@@ -1036,9 +1036,7 @@ void GeoscapeState::handle(Action* action)
 									i != _playSave->getDeadSoldiers()->end();
 									++i)
 							{
-								(*i)->getDiary()->updateAwards(
-															_rules,
-															_playSave->getTacticalStatistics());
+								(*i)->getDiary()->updateAwards(_rules);
 							}
 							break;
 
@@ -1166,6 +1164,18 @@ void GeoscapeState::think()
 	//Log(LOG_INFO) << "GeoscapeState::think()";
 	State::think();
 
+	if (GeoSoak::isActive() == true) // run flat-out; popups are dismissed as they're raised
+	{
+		for (int
+				i = 0;
+				i != GeoSoak::BURST && GeoSoak::isActive() == true;
+				++i)
+		{
+			timeTrigger(_playSave->getTime()->advance());
+		}
+		return;
+	}
+
 	_trDfStart->think(this, nullptr);
 	_trDfZinn ->think(this, nullptr);
 	_trDfZout ->think(this, nullptr);
@@ -1327,15 +1337,7 @@ void GeoscapeState::timeAdvance() // private.
 				if (trigger != TIME_1SEC)
 				{
 					update = true;
-					switch (trigger)
-					{
-						case TIME_1MONTH: time1Month(); // no breaks ->
-						case TIME_1DAY:   time1Day();
-						case TIME_1HOUR:  time1Hour();
-						case TIME_30MIN:  time30Minutes();
-						case TIME_10MIN:  time10Minutes();
-						case TIME_5SEC:   time5Seconds();
-					}
+					timeTrigger(trigger);
 				}
 			}
 
@@ -1354,6 +1356,26 @@ void GeoscapeState::timeAdvance() // private.
 	}
 }
 
+/**
+ * Calls the time-handlers for a TimeTrigger.
+ * @note A longer interval runs the handlers of all shorter intervals also.
+ * @param trigger - the TimeTrigger that GameTime::advance() returned
+ */
+void GeoscapeState::timeTrigger(TimeTrigger trigger) // private.
+{
+	switch (trigger)
+	{
+		case TIME_1MONTH: time1Month(); // no breaks ->
+		case TIME_1DAY:   time1Day();
+		case TIME_1HOUR:  time1Hour();
+		case TIME_30MIN:  time30Minutes();
+		case TIME_10MIN:  time10Minutes();
+		case TIME_5SEC:   time5Seconds();
+		default:
+			break;
+	}
+}
+
 /**
  * Updates the Geoscape clock.
  * @note Also updates the player's current score.
@@ -1461,9 +1483,16 @@ void GeoscapeState::time5Seconds()
 {
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "GeoscapeState::time5Seconds()";
+	const ProfileScope scope (PZ_GEO_5SEC);
 	if (_playSave->getBases()->empty() == true) // Game Over if there are no more bases.
 	{
 		_playSave->setEnding(END_LOSE);
+		if (GeoSoak::isActive() == true)
+		{
+			GeoSoak::finish(_game, _playSave);
+			return;
+		}
+
 		popupGeo(new DefeatState());
 		if (_playSave->isIronman() == true)
 			_game->pushState(new SaveGameState(
@@ -1549,8 +1578,11 @@ void GeoscapeState::time5Seconds()
 						mission->resetCountdown();
 						(*i)->setTarget();
 
-						if (base->setupBaseDefense() == true)
+						if (base->setupBaseDefense() == true
+							&& GeoSoak::isActive() == false)
+						{
 							popupGeo(new BaseDefenseState(base, *i, this));
+						}
 							// should/could this Return;
 						else
 						{
@@ -1630,8 +1662,7 @@ void GeoscapeState::time5Seconds()
 							if ((*k)->getCraft() == *j)
 							{
 								(*k)->die(_playSave);
-								delete *k;
-								k = (*i)->getSoldiers()->erase(k);
+								k = (*i)->removeSoldier(k, true);
 							}
 							else
 								++k;
@@ -1673,7 +1704,9 @@ void GeoscapeState::time5Seconds()
 
 					if ((*j)->reachedDestination() == true)
 					{
-						if (dynamic_cast<Waypoint*>((*j)->getTarget()) != nullptr)	// patrol at waypoint.
+						if (GeoSoak::isActive() == true) // the soak wins tacticals without a tactical and goes home.
+							GeoSoak::resolveArrival(_rules, _playSave, *j);
+						else if (dynamic_cast<Waypoint*>((*j)->getTarget()) != nullptr)	// patrol at waypoint.
 						{															// NOTE: This will also handle target-UFOs that just vanished.
 							popupGeo(new CraftPatrolState(*j, this));
 							(*j)->setTarget();
@@ -1971,6 +2004,7 @@ struct SetRetaliationStatus
 void GeoscapeState::time10Minutes()
 {
 	//Log(LOG_INFO) << "GeoscapeState::time10Minutes()";
+	const ProfileScope scope (PZ_GEO_10MIN);
 	const int diff (_playSave->getDifficultyInt());
 
 	for (std::vector<Base*>::const_iterator
@@ -2064,6 +2098,26 @@ void GeoscapeState::time10Minutes()
 
 	_ufosDetected = 0;
 
+	std::vector<const Craft*> radarCraft; // gather the airborne Craft with radar once instead of per UFO.
+	for (std::vector<Base*>::const_iterator
+			i  = _playSave->getBases()->begin();
+			i != _playSave->getBases()->end();
+			++i)
+	{
+		for (std::vector<Craft*>::const_iterator
+				j  = (*i)->getCrafts()->begin();
+				j != (*i)->getCrafts()->end();
+				++j)
+		{
+			if ((*j)->getCraftStatus() == CS_OUT
+				&& (*j)->hasLeftGround() == true
+				&& (*j)->getRules()->getRangeRadar() != 0)
+			{
+				radarCraft.push_back(*j);
+			}
+		}
+	}
+
 	for (std::vector<Ufo*>::const_iterator // handle UFO detection
 			i  = _playSave->getUfos()->begin();
 			i != _playSave->getUfos()->end();
@@ -2105,21 +2159,19 @@ void GeoscapeState::time10Minutes()
 						case DT_DETECTED: // standard detected only
 							contact = true;
 					}
+				}
 
-					if (contact == false)
+				if (contact == false) // NOTE: Craft-radar uses no RNG so it can be checked after all Bases have rolled.
+				{
+					for (std::vector<const Craft*>::const_iterator
+							j  = radarCraft.begin();
+							j != radarCraft.end();
+							++j)
 					{
-						for (std::vector<Craft*>::const_iterator
-								k  = (*j)->getCrafts()->begin();
-								k != (*j)->getCrafts()->end();
-								++k)
+						if ((*j)->detect(*i) == true)
 						{
-							if ((*k)->getCraftStatus() == CS_OUT
-								&& (*k)->hasLeftGround() == true
-								&& (*k)->detect(*i) == true)
-							{
-								contact = true;
-								break;
-							}
+							contact = true;
+							break;
 						}
 					}
 				}
@@ -2249,6 +2301,7 @@ struct ExpireCrashedUfo
 void GeoscapeState::time30Minutes()
 {
 	//Log(LOG_INFO) << "GeoscapeState::time30Minutes()";
+	const ProfileScope scope (PZ_GEO_30MIN);
 	std::for_each( // decrease mission countdowns
 			_playSave->getAlienMissions().begin(),
 			_playSave->getAlienMissions().end(),
@@ -2459,6 +2512,7 @@ bool GeoscapeState::processTerrorSite(TerrorSite* const terrorSite) const // pri
 void GeoscapeState::time1Hour()
 {
 	//Log(LOG_INFO) << "GeoscapeState::time1Hour()";
+	const ProfileScope scope (PZ_GEO_1HOUR);
 	if (_playSave->getUfos()->empty() == false)
 		scoreUfos(true);
 
@@ -2667,6 +2721,7 @@ void GenerateSupportMission::operator ()(const AlienBase* const aBase) const
 void GeoscapeState::time1Day()
 {
 	//Log(LOG_INFO) << "GeoscapeState::time1Day()";
+	const ProfileScope scope (PZ_GEO_1DAY);
 
 	// Create vectors of pending-events integrated for all Bases so that slightly
 	// different dialog-layouts can be shown for the last event of each type.
@@ -2731,8 +2786,7 @@ void GeoscapeState::time1Day()
 							// throw cow's dung at you. (But don't mention "const" or they'll throw
 							// twice as fast.) i miss you, Alan Turing ....
 
-							delete *j;
-							j = (*i)->getSoldiers()->erase(j);
+							j = (*i)->removeSoldier(j, true);
 
 							dead = true;
 						}
@@ -3063,6 +3117,9 @@ void GeoscapeState::time1Day()
 		_playSave->getTime()->clearEndNear();
 		popupGeo(new MonthNearEndState());
 	}
+
+	if (GeoSoak::isActive() == true)
+		GeoSoak::sample(_game, _playSave);
 	//Log(LOG_INFO) << "GeoscapeState::time1Day() EXIT";
 }
 
@@ -3133,6 +3190,7 @@ void GeoscapeState::time1Month()
 {
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "GeoscapeState::time1Month()";
+	const ProfileScope scope (PZ_GEO_1MONTH);
 
 	resetTimer();
 
@@ -3181,13 +3239,19 @@ bool GeoscapeState::is5Sec() const
 
 /**
  * Adds a new popup-window to the popup-queue and pauses the Timer.
- * @note Doing it this way this prevents popups from overlapping.
+ * @note Doing it this way this prevents popups from overlapping. The
+ * geoscape-soak dismisses the popup instead.
  * @param state - pointer to popup state
  */
 void GeoscapeState::popupGeo(State* const state)
 {
-	_pause = true;
-	_popups.push_back(state);
+	if (GeoSoak::isActive() == true)
+		delete state;
+	else
+	{
+		_pause = true;
+		_popups.push_back(state);
+	}
 }
 
 /**
@@ -3803,6 +3867,7 @@ std::list<DogfightState*>& GeoscapeState::getDogfights()
 
 /**
  * Starts base-defense tactical.
+ * @note The geoscape-soak repels the assault without a tactical.
  * @param base	- pointer to Base to defend
  * @param ufo	- pointer to the attacking Ufo
  */
@@ -3812,6 +3877,12 @@ void GeoscapeState::baseDefenseTactical(
 {
 	ufo->setUfoStatus(Ufo::DESTROYED);
 
+	if (GeoSoak::isActive() == true)
+	{
+		GeoSoak::countBattle();
+		return;
+	}
+
 	if (base->getAvailableSoldiers() != 0)
 	{
 		SavedBattleGame* const battleSave (new SavedBattleGame(
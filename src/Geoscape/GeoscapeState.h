@@ -24,6 +24,7 @@
 
 #include "../Engine/State.h"
 
+#include "../Savegame/GameTime.h"
 #include "../Savegame/SavedGame.h"
 
 namespace OpenXcom
@@ -170,6 +171,8 @@ private:
 
 	/// Advances time on the Geoscape.
 	void timeAdvance();
+	/// Calls the time-handlers for a TimeTrigger.
+	void timeTrigger(TimeTrigger trigger);
 	/// Displays current time/date/funds.
 	void updateTimeDisplay();
 	/// Converts the date to a month string.
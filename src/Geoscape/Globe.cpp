@@ -29,6 +29,7 @@
 #include "../Engine/Game.h"
 #include "../Engine/Language.h"
 #include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
 #include "../Engine/RNG.h"
 //#include "../Engine/Screen.h"
 #include "../Engine/ShaderMove.h"
@@ -1272,6 +1273,8 @@ void Globe::rotate()
  */
 void Globe::draw()
 {
+	const ProfileScope scope (PZ_GLOBE);
+
 	if (_redraw == true) cachePolygons();
 
 	Surface::draw();
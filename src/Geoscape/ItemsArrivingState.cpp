@@ -155,8 +155,7 @@ ItemsArrivingState::ItemsArrivingState(GeoscapeState* const geoState)
 									Text::intWide((*j)->getQuantity()).c_str(),
 									(*i)->getLabel().c_str());
 
-				delete *j;
-				j = (*i)->getTransfers()->erase(j);
+				j = (*i)->removeTransfer(j);
 			}
 			else
 				++j;
@@ -600,9 +600,7 @@ void MonthlyReportState::awards() // private.
 			//Log(LOG_INFO) << "end MONTH report: " << Language::wstrToFs((*j)->getLabel());
 			(*j)->getDiary()->addMonthlyService();
 
-			if ((*j)->getDiary()->updateAwards(
-											_game->getRuleset(),
-											_playSave->getTacticalStatistics()) == true)
+			if ((*j)->getDiary()->updateAwards(_game->getRuleset()) == true)
 			{
 				_soldiersFeted.push_back(*j);
 			}
@@ -110,7 +110,8 @@ void FpsCounter::setColor(Uint8 color)
 void FpsCounter::handle(Action* action)
 {
 	if (action->getDetails()->type == SDL_KEYDOWN
-		&& action->getDetails()->key.keysym.sym == Options::keyFps)
+		&& action->getDetails()->key.keysym.sym == Options::keyFps
+		&& (SDL_GetModState() & KMOD_CTRL) == 0) // ctrl+keyFps is the ProfilerOverlay's
 	{
 #ifdef _WIN32
 		MessageBeep(MB_OK);
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ProfilerOverlay.h"
+
+#include <iomanip>		// std::setprecision
+#include <sstream>		// std::ostringstream
+
+#include "Text.h"
+
+#include "../Engine/Action.h"
+#include "../Engine/CrossPlatform.h"
+#include "../Engine/Language.h"
+#include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
+#include "../Engine/Timer.h"
+
+
+namespace OpenXcom
+{
+
+/**
+ * Creates the ProfilerOverlay with a specified size.
+ * @param width		- width in pixels
+ * @param height	- height in pixels
+ * @param x			- x-position in pixels (default 0)
+ * @param y			- y-position in pixels (default 0)
+ */
+ProfilerOverlay::ProfilerOverlay(
+		int width,
+		int height,
+		int x,
+		int y)
+	:
+		Surface(
+			width, height,
+			x,y),
+		_hasFont(false)
+{
+	if ((_visible = Options::profilerOverlay) == true)
+		Profiler::enable();
+
+	_timer = new Timer(500u);
+	_timer->onTimer(static_cast<SurfaceHandler>(&ProfilerOverlay::update));
+	_timer->start();
+
+	_text = new Text(width, height);
+}
+
+/**
+ * Deletes this ProfilerOverlay.
+ */
+ProfilerOverlay::~ProfilerOverlay()
+{
+	delete _text;
+	delete _timer;
+}
+
+/**
+ * Replaces a specified quantity of colors in this ProfilerOverlay's palette.
+ * @param colors		- pointer to the set of colors
+ * @param firstcolor	- offset of the first color to replace (default 0)
+ * @param ncolors		- amount of colors to replace (default 256)
+ */
+void ProfilerOverlay::setPalette(
+		SDL_Color* const colors,
+		int firstcolor,
+		int ncolors)
+{
+	Surface::setPalette(colors, firstcolor, ncolors);
+	_text->setPalette(colors, firstcolor, ncolors);
+}
+
+/**
+ * Sets the text-color of this ProfilerOverlay.
+ * @param color - the color
+ */
+void ProfilerOverlay::setColor(Uint8 color)
+{
+	_text->setColor(color);
+}
+
+/**
+ * Initializes the Font of this ProfilerOverlay.
+ * @param big	- pointer to large-size Font
+ * @param small	- pointer to small-size Font
+ * @param lang	- pointer to current Language
+ */
+void ProfilerOverlay::initText(
+		Font* const big,
+		Font* const small,
+		const Language* const lang)
+{
+	_text->initText(big, small, lang);
+	_hasFont = true;
+}
+
+/**
+ * Shows/hides this ProfilerOverlay or exports the trace.
+ * @param action - pointer to an Action
+ */
+void ProfilerOverlay::handle(Action* action)
+{
+	if (action->getDetails()->type == SDL_KEYDOWN
+		&& action->getDetails()->key.keysym.sym == Options::keyFps
+		&& (SDL_GetModState() & KMOD_CTRL) != 0)
+	{
+		if ((SDL_GetModState() & KMOD_SHIFT) != 0)
+		{
+			if (Profiler::isEnabled() == true)
+				Profiler::exportTrace(Options::getUserFolder() + "trace_" + CrossPlatform::timeString() + ".json");
+		}
+		else
+		{
+			Options::profilerOverlay =
+			_visible = !_visible;
+
+			if (_visible == true)
+				Profiler::reset();
+			Profiler::enable(_visible);
+		}
+	}
+}
+
+/**
+ * Calls update on schedule.
+ */
+void ProfilerOverlay::think()
+{
+	_timer->think(nullptr, this);
+}
+
+/**
+ * Updates the timings.
+ * @note Lists the zones that took any time over the last frames in
+ * milliseconds per frame.
+ */
+void ProfilerOverlay::update()
+{
+	if (_visible == true && _hasFont == true)
+	{
+		std::ostringstream oststr;
+		oststr << std::fixed << std::setprecision(2);
+
+		double ms;
+		for (size_t
+				i = 0u;
+				i != PZ_ZONES;
+				++i)
+		{
+			const ProfileZone zone (static_cast<ProfileZone>(i));
+			if ((ms = Profiler::getRollingMs(zone)) >= 0.005)
+				oststr << Profiler::getLabel(zone) << " " << ms << "\n";
+		}
+
+		_text->setText(Language::fsToWstr(oststr.str()));
+		_redraw = true;
+	}
+}
+
+/**
+ * Draws this ProfilerOverlay.
+ */
+void ProfilerOverlay::draw()
+{
+	Surface::draw();
+	if (_hasFont == true)
+		_text->blit(this);
+}
+
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef OPENXCOM_PROFILEROVERLAY_H
+#define OPENXCOM_PROFILEROVERLAY_H
+
+#include "../Engine/Surface.h"
+
+
+namespace OpenXcom
+{
+
+class Action;
+class Text;
+class Timer;
+
+
+/**
+ * Shows the rolling per-frame time of each ProfileZone.
+ * @note Toggled by ctrl+'Options::keyFps'; ctrl+shift+'Options::keyFps' exports
+ * the Profiler's trace to the user-folder. The Profiler runs only while this
+ * is visible.
+ */
+class ProfilerOverlay final
+	:
+		public Surface
+{
+
+private:
+	bool _hasFont;
+
+	Text* _text;
+	Timer* _timer;
+
+
+	public:
+		/// Creates a ProfilerOverlay.
+		ProfilerOverlay(
+				int width,
+				int height,
+				int x = 0,
+				int y = 0);
+		/// Cleans up the ProfilerOverlay.
+		~ProfilerOverlay();
+
+		/// Sets the ProfilerOverlay's palette.
+		void setPalette(
+				SDL_Color* const colors,
+				int firstcolor = 0,
+				int ncolors = 256) override;
+		/// Sets the ProfilerOverlay's color.
+		void setColor(Uint8 color) override;
+		/// Initializes the ProfilerOverlay's Font.
+		void initText(
+				Font* const big,
+				Font* const small,
+				const Language* const lang) override;
+
+		/// Handles keyboard-events.
+		void handle(Action* action);
+
+		/// Calls update on schedule.
+		void think() override;
+		/// Updates the timings.
+		void update();
+
+		/// Draws the ProfilerOverlay.
+		void draw() override;
+};
+
+}
+
+#endif
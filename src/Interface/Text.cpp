@@ -500,7 +500,7 @@ void Text::processText() // private.
 			}
 			else if ((*wst)[i] != Font::TOKEN_FLIP_COLORS) // \x01 marks a change of color [handled by draw() below_]
 			{
-				if (font->getChar((*wst)[i]) == nullptr)
+				if (font->hasChar((*wst)[i]) == false)
 					(*wst)[i] = L'.';
 
 				const int charWidth (static_cast<int>(font->getCharSize((*wst)[i]).w)); // keep track of the width of the last line and word
@@ -119,25 +119,24 @@ TextList::TextList(
  */
 TextList::~TextList()
 {
-	for (std::vector<std::vector<Text*>>::const_iterator
-			i  = _texts.begin();
-			i != _texts.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
+	{
 		for (std::vector<Text*>::const_iterator
-				j  = i->begin();
-				j != i->end();
+				j  = i->texts.begin();
+				j != i->texts.end();
 				++j)
 			delete *j;
 
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowLeft.begin();
-			i != _arrowLeft.end();
-			++i)
-		delete *i;
+		delete i->arrowLeft;
+		delete i->arrowRight;
+	}
 
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowRight.begin();
-			i != _arrowRight.end();
+	for (std::vector<Text*>::const_iterator
+			i  = _gauges.begin();
+			i != _gauges.end();
 			++i)
 		delete *i;
 
@@ -205,17 +204,17 @@ void TextList::unpress(State* const state)
 {
 	InteractiveSurface::unpress(state);
 
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowLeft.begin();
-			i != _arrowLeft.end();
-			++i)
-		(*i)->unpress(state);
-
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowRight.begin();
-			i != _arrowRight.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->unpress(state);
+	{
+		if (i->arrowLeft != nullptr)
+		{
+			i->arrowLeft->unpress(state);
+			i->arrowRight->unpress(state);
+		}
+	}
 }
 
 /**
@@ -231,11 +230,12 @@ void TextList::setCellColor(
 		Uint8 color,
 		bool contrast)
 {
-	_texts[row][col]->setColor(color);
-
-	if (_texts[row][col]->getHighContrast() != contrast)
-		_texts[row][col]->setHighContrast(contrast);
+	ListCell& cell (_texts[row].cells[col]);
+	cell.color  =
+	cell.color2 = color;
+	cell.contrast = contrast;
 
+	++_texts[row].rev;
 	_redraw = true;
 }
 
@@ -250,16 +250,17 @@ void TextList::setRowColor(
 		Uint8 color,
 		bool contrast)
 {
-	for (std::vector<Text*>::const_iterator
-			i  = _texts[row].begin();
-			i != _texts[row].end();
+	for (std::vector<ListCell>::iterator
+			i  = _texts[row].cells.begin();
+			i != _texts[row].cells.end();
 			++i)
 	{
-		(*i)->setColor(color);
-
-		if ((*i)->getHighContrast() != contrast)
-			(*i)->setHighContrast(contrast);
+		i->color  =
+		i->color2 = color;
+		i->contrast = contrast;
 	}
+
+	++_texts[row].rev;
 	_redraw = true;
 }
 
@@ -273,7 +274,7 @@ std::wstring TextList::getCellText(
 		size_t row,
 		size_t col) const
 {
-	return _texts[row][col]->getText();
+	return _texts[row].cells[col].text;
 }
 
 /**
@@ -287,7 +288,9 @@ void TextList::setCellText(
 		size_t col,
 		const std::wstring& text)
 {
-	_texts[row][col]->setText(text);
+	_texts[row].cells[col].text = text;
+
+	++_texts[row].rev;
 	_redraw = true;
 }
 
@@ -298,7 +301,7 @@ void TextList::setCellText(
  */
 int TextList::getColumnX(size_t col) const
 {
-	return _x + _texts[0u][col]->getX();
+	return _x + _texts[0u].cells[col].x;
 }
 
 /**
@@ -308,7 +311,28 @@ int TextList::getColumnX(size_t col) const
  */
 int TextList::getRowY(size_t row) const
 {
-	return _y + _texts[row][0u]->getY();
+	return _y + getRowOffset(row);
+}
+
+/**
+ * Gets the y-offset of a row relative to the TextList's Surface for the
+ * current scroll-depth.
+ * @note Wrapped rows that start above the Surface get a negative offset so
+ * that the correct line appears at the top.
+ * @param row - row number
+ * @return, y-offset in pixels
+ */
+int TextList::getRowOffset(size_t row) const // private.
+{
+	int y (_texts[row].y - _texts[_rows[_scroll]].y);
+	for (size_t
+			r = _scroll;
+			r != 0u && _rows[r] == _rows[r - 1u];
+			--r)
+	{
+		y -= _font->getHeight() + _font->getSpacing();
+	}
+	return y;
 }
 
 /**
@@ -359,8 +383,10 @@ size_t TextList::getVisibleRows() const
 }
 
 /**
- * Adds a row of Text to this TextList automatically creating the required
- * objects lined up where they need to be.
+ * Adds a row of Text to this TextList automatically lining up its cells where
+ * they need to be.
+ * @note Only the row's data is stored; the cells are measured here but Texts
+ * are bound to the row only while it's visible.
  * @param cols	- quantity of columns
  * @param ...	- text for each cell in the new row
  */
@@ -375,105 +401,138 @@ void TextList::addRow(
 	if (cols != 0) ncols = static_cast<size_t>(cols);
 	else           ncols = 1u;
 
-	std::vector<Text*> txtRow;
 	int
 		rowOffset_x (0), // x/y-values are relative to the TextList's Surface
 		rowOffset_y,
-		qtyRows     (1),
-		rowHeight   (0);
+		qtyRows     (1);
 
 	if (_texts.empty() == false)
-		rowOffset_y = _texts.back().front()->getY()
-					+ _texts.back().front()->getHeight()
+		rowOffset_y = _texts.back().y
+					+ _texts.back().height
 					+ _font->getSpacing();
 	else
 		rowOffset_y = 0;
 
+	_texts.push_back(ListRow());
+	ListRow& row (_texts.back());
+	row.y      = rowOffset_y;
+	row.height = 0;
+	row.rev    = 0u;
+	row.big    = (_font == _big);
+	row.indent = _wrapIndent;
+	row.cells.resize(ncols);
+
 	for (size_t
 			i = 0u;
 			i != ncols;
 			++i)
 	{
-		Text* const pText (new Text(
-								static_cast<int>(_cols[i]),
-								_font->getHeight(),
-								rowOffset_x + _margin,
-								rowOffset_y));
-
-		pText->setPalette(this->getPalette());
-		pText->initText(_big, _small, _lang);
-		pText->setColor(_color);
-		pText->setSecondaryColor(_color2);
+		ListCell& cell (row.cells[i]);
+		cell.x        = rowOffset_x + _margin;
+		cell.color    = _color;
+		cell.color2   = _color2;
+		cell.contrast = _contrast;
+		cell.wrap     = false;
+		cell.align    = _align[static_cast<int>(i)];
 
-		if (_align[static_cast<int>(i)] != ALIGN_LEFT)
-			pText->setAlign(_align[static_cast<int>(i)]);
+		if (cols != 0)
+			cell.text = va_arg(args, wchar_t*);
 
-		pText->setHighContrast(_contrast);
+		Text* const gauge (getGauge(i));
 
-		if (_font == _big) pText->setBig();
-		else               pText->setSmall();
+		if (row.big == true) gauge->setBig();
+		else                 gauge->setSmall();
 
-		if (cols != 0)
-			pText->setText(va_arg(args, wchar_t*));
-//		else
-//		{
-//			wchar_t d[1];
-//			std::mbstowcs(d, "", 1);
-//			txt->setText(d);
-//		}
+		gauge->setWordWrap(false);
+		gauge->setText(cell.text);
 
 		// Grab this before enabling word-wrap so it can be used to calculate the total row-height below.
-		const int vertPad (_font->getHeight() - pText->getTextHeight());
+		const int vertPad (_font->getHeight() - gauge->getTextHeight());
 
-		if (_wrap == true && pText->getTextWidth() > pText->getWidth())
+		if (_wrap == true && gauge->getTextWidth() > gauge->getWidth())
 		{
-//			txt->setHeight(_font->getHeight() * 2 + _font->getSpacing());
-			pText->setWordWrap(true, _wrapIndent);
+			cell.wrap = true;
+			gauge->setWordWrap(true, _wrapIndent);
 			qtyRows = std::max(qtyRows,
-							   pText->getQtyLines());
+							   gauge->getQtyLines());
 		}
 
-		rowHeight = std::max(rowHeight,
-							 pText->getTextHeight() + vertPad);
+		row.height = std::max(row.height,
+							  gauge->getTextHeight() + vertPad);
 
 		if (_dot == true
 			&& cols != 0 && i < static_cast<size_t>(cols) - 1u)
 		{
-			std::wstring wst (pText->getText());
-
-			size_t width (static_cast<size_t>(pText->getTextWidth()));
+			const size_t dotWidth (static_cast<size_t>(_font->getCharSize(L'.').w)); // includes the Font's spacing
+			size_t width (static_cast<size_t>(gauge->getTextWidth()));
 			while (width < _cols[i])
 			{
-				width += static_cast<size_t>(static_cast<int>(_font->getChar('.')->getCrop()->w) + _font->getSpacing());
-				wst += '.';
+				width += dotWidth;
+				cell.text += L'.';
 			}
-			pText->setText(wst);
+			gauge->setText(cell.text);
 		}
 
-		txtRow.push_back(pText);
-
 		if (_condensed == true)
-			rowOffset_x += pText->getTextWidth();
+			rowOffset_x += gauge->getTextWidth();
 		else
 			rowOffset_x += static_cast<int>(_cols[i]);
 	}
 
-	for (size_t // ensure all elements in this row are the same height
-			i = 0u;
-			i != static_cast<size_t>(cols);
-			++i)
-		txtRow[i]->setHeight(rowHeight);
-
-	_texts.push_back(txtRow);
 	for (int
 			i = 0;
 			i != qtyRows;
 			++i)
 		_rows.push_back(_texts.size() - 1u);
 
+	_redraw = true;
 
-	if (_arrow_x != -1)	// place arrow-buttons
-	{					// Position defined wrt main window - *not* the TextList's Surface.
+	va_end(args);
+	updateArrows();
+}
+
+/**
+ * Gets the Text that measures the cells of a specified column.
+ * @note The gauge is never drawn; it only runs the Text's layout over a cell
+ * at the column's width.
+ * @param col - column number
+ * @return, pointer to the gauge
+ */
+Text* TextList::getGauge(size_t col) // private.
+{
+	while (_gauges.size() <= col)
+	{
+		Text* const gauge (new Text(
+								static_cast<int>(_cols[_gauges.size()]),
+								_font->getHeight()));
+		gauge->initText(_big, _small, _lang);
+		_gauges.push_back(gauge);
+	}
+	return _gauges[col];
+}
+
+/**
+ * Gets a slot for a visible row creating it if it doesn't exist yet.
+ * @note The slots are created as the list first shows that many rows and are
+ * kept for re-use after that.
+ * @param slot - the slot's position from the top of the list
+ * @return, reference to the slot
+ */
+TextList::ListSlot& TextList::getSlot(size_t slot) // private.
+{
+	while (_slots.size() <= slot)
+	{
+		ListSlot blank;
+		blank.row        = std::numeric_limits<size_t>::max();
+		blank.rev        = 0u;
+		blank.arrowLeft  =
+		blank.arrowRight = nullptr;
+		_slots.push_back(blank);
+	}
+
+	ListSlot& ret (_slots[slot]);
+	if (_arrow_x != -1 && ret.arrowLeft == nullptr)	// create arrow-buttons
+	{												// Position defined wrt main window - *not* the TextList's Surface.
 		ArrowShape
 			shape1,
 			shape2;
@@ -491,37 +550,88 @@ void TextList::addRow(
 				shape2 = ARROW_SMALL_RIGHT;
 		}
 
-		ArrowButton* const a1 (new ArrowButton(
-											shape1,
-											11,8,
-											_x + _arrow_x,
-											_y));
-		a1->setListButton();
-		a1->setPalette(this->getPalette());
-		a1->setColor(_up->getColor());
-		a1->onMouseClick(_leftClick, 0u);
-		a1->onMousePress(_leftPress);
-		a1->onMouseRelease(_leftRelease);
-		_arrowLeft.push_back(a1);
-
-		ArrowButton* const a2 (new ArrowButton(
-											shape2,
-											11,8,
-											_x + _arrow_x + 12,
-											_y));
-		a2->setListButton();
-		a2->setPalette(this->getPalette());
-		a2->setColor(_up->getColor());
-		a2->onMouseClick(_rightClick, 0u);
-		a2->onMousePress(_rightPress);
-		a2->onMouseRelease(_rightRelease);
-		_arrowRight.push_back(a2);
+		ret.arrowLeft = new ArrowButton(
+									shape1,
+									11,8,
+									_x + _arrow_x,
+									_y);
+		ret.arrowLeft->setListButton();
+		ret.arrowLeft->setPalette(this->getPalette());
+		ret.arrowLeft->setColor(_up->getColor());
+		ret.arrowLeft->onMouseClick(_leftClick, 0u);
+		ret.arrowLeft->onMousePress(_leftPress);
+		ret.arrowLeft->onMouseRelease(_leftRelease);
+
+		ret.arrowRight = new ArrowButton(
+									shape2,
+									11,8,
+									_x + _arrow_x + 12,
+									_y);
+		ret.arrowRight->setListButton();
+		ret.arrowRight->setPalette(this->getPalette());
+		ret.arrowRight->setColor(_up->getColor());
+		ret.arrowRight->onMouseClick(_rightClick, 0u);
+		ret.arrowRight->onMousePress(_rightPress);
+		ret.arrowRight->onMouseRelease(_rightRelease);
 	}
+	return ret;
+}
 
-	_redraw = true;
+/**
+ * Binds the Texts of a slot to a row.
+ * @note The Texts are re-laid only if the slot showed a different row or the
+ * row has changed since.
+ * @param slot		- reference to a ListSlot
+ * @param row		- row number
+ * @param addPixel	- true to add a pixel under the row
+ */
+void TextList::bindRow( // private.
+		ListSlot& slot,
+		size_t row,
+		bool addPixel)
+{
+	const ListRow& data (_texts[row]);
+	if (slot.row != row || slot.rev != data.rev)
+	{
+		slot.row = row;
+		slot.rev = data.rev;
 
-	va_end(args);
-	updateArrows();
+		for (size_t
+				i = 0u;
+				i != data.cells.size();
+				++i)
+		{
+			if (i == slot.texts.size())
+			{
+				Text* const pText (new Text(
+										static_cast<int>(_cols[i]),
+										data.height));
+				pText->setPalette(this->getPalette());
+				pText->initText(_big, _small, _lang);
+				slot.texts.push_back(pText);
+			}
+
+			Text* const pText (slot.texts[i]);
+			const ListCell& cell (data.cells[i]);
+
+			if (pText->getHeight() != data.height)
+				pText->setHeight(data.height);
+
+			if (data.big == true) pText->setBig();
+			else                  pText->setSmall();
+
+			pText->setX(cell.x);
+			pText->setWordWrap(cell.wrap, data.indent);
+			pText->setAlign(cell.align);
+			pText->setColor(cell.color);
+			pText->setSecondaryColor(cell.color2);
+			pText->setHighContrast(cell.contrast);
+			pText->setText(cell.text);
+
+			if (addPixel == true)
+				pText->addTextHeight();
+		}
+	}
 }
 
 /**
@@ -561,27 +671,23 @@ void TextList::setPalette(
 {
 	Surface::setPalette(colors, firstcolor, ncolors);
 
-	for (std::vector<std::vector<Text*>>::const_iterator
-			i  = _texts.begin();
-			i != _texts.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
+	{
 		for (std::vector<Text*>::const_iterator
-				j  = i->begin();
-				j != i->end();
+				j  = i->texts.begin();
+				j != i->texts.end();
 				++j)
 			(*j)->setPalette(colors, firstcolor, ncolors);
 
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowLeft.begin();
-			i != _arrowLeft.end();
-			++i)
-		(*i)->setPalette(colors, firstcolor, ncolors);
-
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowRight.begin();
-			i != _arrowRight.end();
-			++i)
-		(*i)->setPalette(colors, firstcolor, ncolors);
+		if (i->arrowLeft != nullptr)
+		{
+			i->arrowLeft->setPalette(colors, firstcolor, ncolors);
+			i->arrowRight->setPalette(colors, firstcolor, ncolors);
+		}
+	}
 
 	if (_selector != nullptr)
 		_selector->setPalette(colors, firstcolor, ncolors);
@@ -644,15 +750,21 @@ void TextList::setColor(Uint8 color)
 	_down->setColor(color);
 	_scrollbar->setColor(color);
 
-	for (std::vector<std::vector<Text*>>::const_iterator
+	for (std::vector<ListRow>::iterator
 			i  = _texts.begin();
 			i != _texts.end();
 			++i)
-		for (std::vector<Text*>::const_iterator
-				j  = i->begin();
-				j != i->end();
+	{
+		for (std::vector<ListCell>::iterator
+				j  = i->cells.begin();
+				j != i->cells.end();
 				++j)
-			(*j)->setColor(color);
+		{
+			j->color  =
+			j->color2 = color;
+		}
+		++i->rev;
+	}
 }
 
 /**
@@ -710,15 +822,19 @@ void TextList::setHighContrast(bool contrast)
 {
 	_contrast = contrast;
 
-	for (std::vector<std::vector<Text*>>::const_iterator
+	for (std::vector<ListRow>::iterator
 			i  = _texts.begin();
 			i != _texts.end();
 			++i)
-		for (std::vector<Text*>::const_iterator
-				j  = i->begin();
-				j != i->end();
+	{
+		for (std::vector<ListCell>::iterator
+				j  = i->cells.begin();
+				j != i->cells.end();
 				++j)
-			(*j)->setHighContrast(contrast);
+			j->contrast = contrast;
+
+		++i->rev;
+	}
 
 	_scrollbar->setHighContrast(contrast);
 }
@@ -925,11 +1041,14 @@ void TextList::setArrow(
 void TextList::onLeftArrowPress(ActionHandler handler)
 {
 	_leftPress = handler;
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowLeft.begin();
-			i != _arrowLeft.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->onMousePress(handler);
+	{
+		if (i->arrowLeft != nullptr)
+			i->arrowLeft->onMousePress(handler);
+	}
 }
 
 /**
@@ -939,11 +1058,14 @@ void TextList::onLeftArrowPress(ActionHandler handler)
 void TextList::onLeftArrowRelease(ActionHandler handler)
 {
 	_leftRelease = handler;
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowLeft.begin();
-			i != _arrowLeft.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->onMouseRelease(handler);
+	{
+		if (i->arrowLeft != nullptr)
+			i->arrowLeft->onMouseRelease(handler);
+	}
 }
 
 /**
@@ -953,11 +1075,14 @@ void TextList::onLeftArrowRelease(ActionHandler handler)
 void TextList::onLeftArrowClick(ActionHandler handler)
 {
 	_leftClick = handler;
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowLeft.begin();
-			i != _arrowLeft.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->onMouseClick(handler, 0u);
+	{
+		if (i->arrowLeft != nullptr)
+			i->arrowLeft->onMouseClick(handler, 0u);
+	}
 }
 
 /**
@@ -967,11 +1092,14 @@ void TextList::onLeftArrowClick(ActionHandler handler)
 void TextList::onRightArrowPress(ActionHandler handler)
 {
 	_rightPress = handler;
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowRight.begin();
-			i != _arrowRight.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->onMousePress(handler);
+	{
+		if (i->arrowRight != nullptr)
+			i->arrowRight->onMousePress(handler);
+	}
 }
 
 /**
@@ -981,11 +1109,14 @@ void TextList::onRightArrowPress(ActionHandler handler)
 void TextList::onRightArrowRelease(ActionHandler handler)
 {
 	_rightRelease = handler;
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowRight.begin();
-			i != _arrowRight.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->onMouseRelease(handler);
+	{
+		if (i->arrowRight != nullptr)
+			i->arrowRight->onMouseRelease(handler);
+	}
 }
 
 /**
@@ -995,11 +1126,14 @@ void TextList::onRightArrowRelease(ActionHandler handler)
 void TextList::onRightArrowClick(ActionHandler handler)
 {
 	_rightClick = handler;
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowRight.begin();
-			i != _arrowRight.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->onMouseClick(handler, 0u);
+	{
+		if (i->arrowRight != nullptr)
+			i->arrowRight->onMouseClick(handler, 0u);
+	}
 }
 
 /**
@@ -1009,19 +1143,11 @@ void TextList::clearList()
 {
 	scrollUp(true);
 
-	for (std::vector<std::vector<Text*>>::iterator
-			i  = _texts.begin();
-			i != _texts.end();
+	for (std::vector<ListSlot>::iterator // keep the slots' Texts for re-use
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-	{
-		for (std::vector<Text*>::const_iterator
-				j  = i->begin();
-				j != i->end();
-				++j)
-			delete *j;
-
-		i->clear();
-	}
+		i->row = std::numeric_limits<size_t>::max();
 
 	_texts.clear();
 	_rows.clear();
@@ -1161,23 +1287,16 @@ void TextList::updateArrows() // private.
 
 /**
  * Draws the TextList and all the Text contained within.
+ * @note Only the visible rows are bound to Texts and drawn.
  */
 void TextList::draw()
 {
 	Surface::draw();
 
-	int y (0);
-	bool addPixel (false);
-
 	if (_rows.empty() == false)
 	{
-		for (size_t				// for wrapped items offset the draw-height above the visible Surface
-				r = _scroll;	// so that the correct row appears at the top
-				r != 0u && _rows[r] == _rows[r - 1u];
-				--r)
-		{
-			y -= _font->getHeight() + _font->getSpacing();
-		}
+		int y (getRowOffset(_rows[_scroll]));
+		bool addPixel (false);
 
 		for (size_t
 				i = _rows[_scroll];
@@ -1187,22 +1306,19 @@ void TextList::draw()
 			if (i == _texts.size() - 1u || i == _rows[_scroll] + _visibleRows - 1u)
 				addPixel = true; // add px_Y under last row
 
-			for (std::vector<Text*>::const_iterator
-					j  = _texts[i].begin();
-					j != _texts[i].end();
+			ListSlot& slot (getSlot(i - _rows[_scroll]));
+			bindRow(slot, i, addPixel);
+
+			for (size_t
+					j = 0u;
+					j != _texts[i].cells.size();
 					++j)
 			{
-				if (addPixel == true)
-					(*j)->addTextHeight();
-
-				(*j)->setY(y);
-				(*j)->blit(this);
+				slot.texts[j]->setY(y);
+				slot.texts[j]->blit(this);
 			}
 
-			if (_texts[i].empty() == false)
-				y += _texts[i].front()->getHeight() + _font->getSpacing();
-			else
-				y += _font->getHeight() + _font->getSpacing();
+			y += _texts[i].height + _font->getSpacing();
 		}
 	}
 }
@@ -1221,34 +1337,25 @@ void TextList::blit(const Surface* const srf)
 
 		if (_arrow_x != -1 && _rows.empty() == false)
 		{
-			int y (_y);
-			for (size_t
-					r = _scroll;
-					r != 0u && _rows[r] == _rows[r - 1u];
-					--r)
-			{
-				y -= _font->getHeight() + _font->getSpacing();
-			}
-
-			int maxY (_y + getHeight());
+			int
+				y    (_y + getRowOffset(_rows[_scroll])),
+				maxY (_y + getHeight());
 			for (size_t
 					i = _rows[_scroll];
 					i != _texts.size() && i != _rows[_scroll] + _visibleRows && y < maxY;
 					++i)
 			{
-				_arrowLeft[i]->setY(y);
-				_arrowRight[i]->setY(y);
+				const ListSlot& slot (getSlot(i - _rows[_scroll]));
+				slot.arrowLeft->setY(y);
+				slot.arrowRight->setY(y);
 
 				if (y >= _y) // only blit arrows that belong to Texts that have their first row on-screen
 				{
-					_arrowLeft[i]->blit(srf);
-					_arrowRight[i]->blit(srf);
+					slot.arrowLeft->blit(srf);
+					slot.arrowRight->blit(srf);
 				}
 
-				if (_texts[i].empty() == false)
-					y += _texts[i].front()->getHeight() + _font->getSpacing();
-				else
-					y += _font->getHeight() + _font->getSpacing();
+				y += _texts[i].height + _font->getSpacing();
 			}
 		}
 
@@ -1298,8 +1405,9 @@ void TextList::handle(Action* action, State* state)
 					i != r_end;
 					++i)
 			{
-				_arrowLeft[i]->handle(action, state);
-				_arrowRight[i]->handle(action, state);
+				const ListSlot& slot (getSlot(i - _rows[_scroll]));
+				slot.arrowLeft->handle(action, state);
+				slot.arrowRight->handle(action, state);
 			}
 		}
 	}
@@ -1316,17 +1424,17 @@ void TextList::think()
 	_down->think();
 	_scrollbar->think();
 
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowLeft.begin();
-			i != _arrowLeft.end();
-			++i)
-		(*i)->think();
-
-	for (std::vector<ArrowButton*>::const_iterator
-			i  = _arrowRight.begin();
-			i != _arrowRight.end();
+	for (std::vector<ListSlot>::const_iterator
+			i  = _slots.begin();
+			i != _slots.end();
 			++i)
-		(*i)->think();
+	{
+		if (i->arrowLeft != nullptr)
+		{
+			i->arrowLeft->think();
+			i->arrowRight->think();
+		}
+	}
 }
 
 /**
@@ -1412,15 +1520,14 @@ void TextList::mouseOver(Action* action, State* state)
 		// wait ... are you telling me all this crap runs on every mouse-slice
 		if (   _selRow < _texts.size()
 			&& _selRow < _scroll + _visibleRows
-			&& _texts[_selRow][0u]->getText().empty() == false)	// kL_add. Don't highlight rows w/out text in first column.
+			&& _texts[_selRow].cells.front().text.empty() == false)	// kL_add. Don't highlight rows w/out text in first column.
 		{														// This is currently only a special case in Battlescape/CeremonyState(cTor)
 																// due to the quirky way it adds titleRows, then lists soldierNames & Awards
 																// and finally fills the titleRow w/ the relevant awardName; the last titleRow
 																// is added, but there are no soldiers nor awards for it.
 			//Log(LOG_INFO) << ". text at [" << _selRow << "] = " << Language::wstrToFs(_texts[_selRow][0]->getText());
-			const Text* const selText (_texts[_rows[_selRow]].front());
-			int y (_y + selText->getY());
-			height = selText->getHeight() + _font->getSpacing(); // actual current line height
+			int y (getRowY(_rows[_selRow]));
+			height = _texts[_rows[_selRow]].height + _font->getSpacing(); // actual current line height
 
 			if (y < _y || y + height > _y + getHeight())
 				height >>= 1u;
@@ -47,6 +47,9 @@ class ScrollBar;
  * A TextList is a list of Text's split into rows & columns.
  * @note Contains a set of Text's that are automatically lined up by rows and
  * columns like a big table making it easy to manage them together.
+ * @note The list keeps only the data of its rows. Text's and arrow-buttons
+ * exist for the visible rows only and are re-bound to other rows as the list
+ * scrolls.
  */
 class TextList final
 	:
@@ -54,6 +57,44 @@ class TextList final
 {
 
 private:
+	/// A cell of a row: its text and the attributes that it was added with.
+	struct ListCell
+	{
+		std::wstring text;
+		int x;
+		Uint8
+			color,
+			color2;
+		bool
+			contrast,
+			wrap;
+		TextHAlign align;
+	};
+
+	/// A row of cells and its layout.
+	struct ListRow
+	{
+		int
+			y,
+			height;
+		unsigned rev; // bumped whenever a cell changes so that its Texts get re-bound
+		bool
+			big,
+			indent;
+		std::vector<ListCell> cells;
+	};
+
+	/// The Texts and arrow-buttons that show a visible row.
+	struct ListSlot
+	{
+		size_t row;		// the row that the Texts are bound to
+		unsigned rev;	// the revision of the row when it was bound
+		std::vector<Text*> texts;
+		ArrowButton
+			* arrowLeft,
+			* arrowRight;
+	};
+
 	bool
 		_condensed,
 		_contrast,
@@ -103,10 +144,9 @@ private:
 	std::vector<size_t>
 		_cols,
 		_rows;
-	std::vector<std::vector<Text*>> _texts;
-	std::vector<ArrowButton*>
-		_arrowLeft,
-		_arrowRight;
+	std::vector<ListRow> _texts;
+	std::vector<ListSlot> _slots;
+	std::vector<Text*> _gauges; // measures the cells as they're added - one per column
 
 	/// Resizes the selector.
 	void resizeSelector(
@@ -121,6 +161,18 @@ private:
 	/// Updates the arrow-buttons based on the visible rows.
 	void updateArrows();
 
+	/// Gets the Text that measures cells of a column.
+	Text* getGauge(size_t col);
+	/// Gets a slot for a visible row.
+	ListSlot& getSlot(size_t slot);
+	/// Binds a slot's Texts to a row.
+	void bindRow(
+			ListSlot& slot,
+			size_t row,
+			bool addPixel);
+	/// Gets the y-offset of a row for the current scroll.
+	int getRowOffset(size_t row) const;
+
 
 	public:
 		/// Creates a TextList with the specified size and position.
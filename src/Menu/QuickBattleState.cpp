@@ -427,11 +427,10 @@ void QuickBattleState::resetSoldiers()
 	for (std::vector<Soldier*>::const_iterator
 			i  = _base->getSoldiers()->begin();
 			i != _base->getSoldiers()->end();
-			++i)
+			)
 	{
-		delete *i;
+		i = _base->removeSoldier(i, true);
 	}
-	_base->getSoldiers()->clear();
 
 	const UnitStats statCaps (_rules->getSoldier("STR_SOLDIER")->getStatCaps());
 	UnitStats* stats;
@@ -447,7 +446,7 @@ void QuickBattleState::resetSoldiers()
 		Soldier* const sol (_rules->genSoldier(
 											_playSave,
 											_rules->getSoldiersList().at(RNG::pick(_rules->getSoldiersList().size()))));
-		_base->getSoldiers()->push_back(sol);
+		_base->addSoldier(sol);
 
 		hasRookieStats = true;
 
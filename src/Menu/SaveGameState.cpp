@@ -69,6 +69,7 @@ SaveGameState::SaveGameState(
 		_origin(origin),
 		_file(file),
 		_type(SAVE_DEFAULT),
+		_saving(false),
 		_wait(0)
 {
 	build(palette);
@@ -88,6 +89,7 @@ SaveGameState::SaveGameState(
 	:
 		_origin(origin),
 		_type(type),
+		_saving(false),
 		_wait(0)
 {
 	switch (_type)
@@ -133,6 +135,13 @@ SaveGameState::SaveGameState(
  */
 SaveGameState::~SaveGameState()
 {
+	if (_saving == true) // game is being quit mid-save
+	{
+		const std::string error (SavedGame::finishSave());
+		if (error.empty() == false)
+			Log(LOG_ERROR) << error;
+	}
+
 #ifdef _WIN32
 	MessageBeep(MB_ICONASTERISK);
 #endif
@@ -174,6 +183,8 @@ void SaveGameState::build(SDL_Color* const palette) // private.
 
 /**
  * Saves the current game.
+ * @note The game-data is copied on this thread and written by a worker; the
+ * status-text animates until the write has finished.
  */
 void SaveGameState::think()
 {
@@ -181,104 +192,112 @@ void SaveGameState::think()
 
 	if (_wait < WAIT_TICKS) // persist the text to Ensure that player sees it
 		++_wait;
-	else
+	else if (_saving == false)
 	{
-		_game->popState(); // this.
-		_game->getCursor()->setVisible();
-
 		switch (_type)
 		{
-			case SAVE_DEFAULT:		// ordinary save from ListSaveState
-				_game->popState();	// close the ListSave screen.
-
-				if (_game->getSavedGame()->isIronman() == false) // And the Pause screen too. what - why should an Ironballs game get passed in here as type SAVE_DEFAULT.
-					_game->popState();
-				break;
-
 			case SAVE_QUICK: // give these a default label ->
 			case SAVE_AUTO_GEOSCAPE:
 			case SAVE_AUTO_BATTLESCAPE:
 				_game->getSavedGame()->setLabel(Language::fsToWstr(_file));
 		}
 
-
 		try // Save the game
 		{
-			const std::string backup (_file + SavedGame::SAVE_BakDot);
-			_game->getSavedGame()->save(backup);
-
-			if (CrossPlatform::moveFile(
-									Options::getUserFolder() + backup,
-									Options::getUserFolder() + _file) == false)
-			{
-				throw Exception("SaveGameState::think() has backed up the file as " + backup);
-			}
-
-			if (_type == SAVE_IRONMAN_QUIT)
-			{
-				// This uses baseX/Y options for Geoscape & Basescape:
-//				Options::baseXResolution = Options::baseXGeoscape; // kL
-//				Options::baseYResolution = Options::baseYGeoscape; // kL
-				// This sets Geoscape and Basescape to default (320x200) IG and the config.
-/*kL			Screen::updateScale(
-								Options::geoscapeScale,
-								Options::geoscapeScale,
-								Options::baseXGeoscape,
-								Options::baseYGeoscape,
-								true); */
-//				_game->getScreen()->resetDisplay(false);
-
-				_game->setState(new MainMenuState());
-				_game->setSavedGame();
-			}
+			_game->getSavedGame()->saveAsync(_file);
+			_saving = true;
 		}
 		catch (Exception& e)
 		{
-			// TODO: Show the ListGamesState elements again ....
-			Log(LOG_ERROR) << e.what();
-			std::wostringstream error;
-			error << tr("STR_SAVE_UNSUCCESSFUL") << L'\x02' << Language::fsToWstr(e.what());
-
-			const RuleInterface* const uiRule (_game->getRuleset()->getInterface("errorMessages"));
-			if (_origin != OPT_BATTLESCAPE)
-				_game->pushState(new ErrorMessageState(
-													error.str(),
-													_palette,
-													uiRule->getElement("geoscapeColor")->color,
-													"BACK01.SCR",
-													uiRule->getElement("geoscapePalette")->color));
-			else
-				_game->pushState(new ErrorMessageState(
-													error.str(),
-													_palette,
-													uiRule->getElement("battlescapeColor")->color,
-													"Diehard",
-													uiRule->getElement("battlescapePalette")->color));
+			close();
+			error(e.what());
 		}
 		catch (YAML::Exception& e)
 		{
-			// TODO: Show the ListGamesState elements again ....
-			Log(LOG_ERROR) << e.what();
-			std::wostringstream error;
-			error << tr("STR_SAVE_UNSUCCESSFUL") << L'\x02' << Language::fsToWstr(e.what());
-
-			const RuleInterface* const uiRule (_game->getRuleset()->getInterface("errorMessages"));
-			if (_origin != OPT_BATTLESCAPE)
-				_game->pushState(new ErrorMessageState(
-													error.str(),
-													_palette,
-													uiRule->getElement("geoscapeColor")->color,
-													"BACK01.SCR",
-													uiRule->getElement("geoscapePalette")->color));
-			else
-				_game->pushState(new ErrorMessageState(
-													error.str(),
-													_palette,
-													uiRule->getElement("battlescapeColor")->color,
-													"Diehard",
-													uiRule->getElement("battlescapePalette")->color));
+			close();
+			error(e.what());
 		}
 	}
+	else if (SavedGame::isSaving() == true)
+	{
+		if (++_wait % DOTS_TICKS == 0) // progress
+		{
+			std::wstring status (tr("STR_SAVING_GAME"));
+			status.append(static_cast<size_t>(_wait / DOTS_TICKS % 4), L'.');
+			_txtStatus->setText(status);
+		}
+	}
+	else
+	{
+		_saving = false;
+		close();
+
+		const std::string msg (SavedGame::finishSave());
+		if (msg.empty() == false)
+			error(msg);
+		else if (_type == SAVE_IRONMAN_QUIT)
+		{
+			// This uses baseX/Y options for Geoscape & Basescape:
+//			Options::baseXResolution = Options::baseXGeoscape; // kL
+//			Options::baseYResolution = Options::baseYGeoscape; // kL
+			// This sets Geoscape and Basescape to default (320x200) IG and the config.
+/*kL		Screen::updateScale(
+							Options::geoscapeScale,
+							Options::geoscapeScale,
+							Options::baseXGeoscape,
+							Options::baseYGeoscape,
+							true); */
+//			_game->getScreen()->resetDisplay(false);
+
+			_game->setState(new MainMenuState());
+			_game->setSavedGame();
+		}
+	}
+}
+
+/**
+ * Pops this state and any others that need closing after the save.
+ */
+void SaveGameState::close() // private.
+{
+	_game->popState(); // this.
+	_game->getCursor()->setVisible();
+
+	if (_type == SAVE_DEFAULT)	// ordinary save from ListSaveState
+	{
+		_game->popState();		// close the ListSave screen.
+
+		if (_game->getSavedGame()->isIronman() == false) // And the Pause screen too. what - why should an Ironballs game get passed in here as type SAVE_DEFAULT.
+			_game->popState();
+	}
+}
+
+/**
+ * Shows an error if the save failed.
+ * @param msg - reference to the error-message
+ */
+void SaveGameState::error(const std::string& msg) // private.
+{
+	// TODO: Show the ListGamesState elements again ....
+	Log(LOG_ERROR) << msg;
+	std::wostringstream error;
+	error << tr("STR_SAVE_UNSUCCESSFUL") << L'\x02' << Language::fsToWstr(msg);
+
+	const RuleInterface* const uiRule (_game->getRuleset()->getInterface("errorMessages"));
+	if (_origin != OPT_BATTLESCAPE)
+		_game->pushState(new ErrorMessageState(
+											error.str(),
+											_palette,
+											uiRule->getElement("geoscapeColor")->color,
+											"BACK01.SCR",
+											uiRule->getElement("geoscapePalette")->color));
+	else
+		_game->pushState(new ErrorMessageState(
+											error.str(),
+											_palette,
+											uiRule->getElement("battlescapeColor")->color,
+											"Diehard",
+											uiRule->getElement("battlescapePalette")->color));
 }
 
 }
@@ -46,8 +46,11 @@ class SaveGameState
 {
 
 private:
-	static const int WAIT_TICKS = 3;
+	static const int
+		WAIT_TICKS = 3,
+		DOTS_TICKS = 8;
 
+	bool _saving;
 	int _wait;
 	std::string _file;
 
@@ -58,6 +61,10 @@ private:
 
 	/// Creates the interface.
 	void build(SDL_Color* const palette);
+	/// Pops this state and any others that need closing after the save.
+	void close();
+	/// Shows an error if the save failed.
+	void error(const std::string& msg);
 
 
 	public:
@@ -28,6 +28,8 @@
 
 #include "../version.h"
 
+#include "../Battlescape/BattleBench.h"
+
 #include "../Engine/Action.h"
 #include "../Engine/CrossPlatform.h"
 #include "../Engine/Exception.h"
@@ -42,12 +44,15 @@
 //#include "../Engine/Surface.h"
 #include "../Engine/Timer.h"
 
+#include "../Geoscape/GeoSoak.h"
+
 #include "../Interface/FpsCounter.h"
 #include "../Interface/Cursor.h"
 #include "../Interface/Text.h"
 
 #include "../Resource/XcomResourcePack.h"
 
+#include "../Ruleset/MapFileCache.h"
 #include "../Ruleset/RuleInterface.h"
 #include "../Ruleset/Ruleset.h"
 
@@ -177,6 +182,8 @@ void StartState::init()
 	Music::stop();
 
 	_game->setResourcePack();
+	MapFileCache::clear(); // the mods - and so the terrain-files - can differ from those that filled the cache.
+
 //	if (Options::mute == false && Options::reload == true) // NOTE: No reloading possible unless Options screens get re-instated.
 //	{
 //		Mix_CloseAudio();
@@ -273,7 +280,18 @@ void StartState::think()
 			CrossPlatform::flashWindow();
 
 			Log(LOG_INFO) << "0xC_kL started!";
-			if (Options::reload == false && Options::playIntro == true)
+			if (Options::benchBattle.empty() == false
+				|| Options::benchGenerate == true)
+			{
+				if (BattleBench::start(_game) == false)
+					_game->quit(true);
+			}
+			else if (Options::soakGame.empty() == false)
+			{
+				if (GeoSoak::start(_game) == false)
+					_game->quit(true);
+			}
+			else if (Options::reload == false && Options::playIntro == true)
 			{
 				Log(LOG_INFO) << "Playing intro video ...";
 				const bool letterbox (Options::keepAspectRatio);
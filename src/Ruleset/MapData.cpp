@@ -109,6 +109,28 @@ void MapData::setSprite(
 	_sprites[aniCycle] = id;
 }
 
+/**
+ * Checks if this tilepart needs to be animated.
+ * @note A part is animated if its frames show different sprites or if it's a
+ * ufo-door or psychedelic.
+ * @return, true if animated
+ */
+bool MapData::isAnimated() const
+{
+	if (_slideDoor == true || _psychedelic != 0)
+		return true;
+
+	for (size_t
+			i = 1u;
+			i != 8u;
+			++i)
+	{
+		if (_sprites[i] != _sprites[0u])
+			return true;
+	}
+	return false;
+}
+
 /**
  * Gets if this tilepart is either a normal door or a ufo-door.
  * @return, true if door
@@ -176,6 +176,8 @@ private:
 		void setSprite(
 				size_t aniCycle,
 				int id);
+		/// Checks if this tilepart needs to be animated.
+		bool isAnimated() const;
 
 		/// Gets if this tilepart is either a normal door or a ufo-door.
 		bool isDoor() const;
@@ -19,11 +19,13 @@
 
 #include "MapDataSet.h"
 
+#include <cstring>		// std::memcpy
 #include <fstream>
 
 //#include <SDL/SDL_endian.h>
 
 #include "MapData.h"
+#include "MapFileCache.h"
 
 #include "../Engine/CrossPlatform.h"
 #include "../Engine/Exception.h"
@@ -176,22 +178,31 @@ void MapDataSet::loadData()
 		MCD mcd;
 
 		// Load all terrain-part-data from the MCD-file '_type'.
-		std::string file ("TERRAIN/" + _type + ".MCD");
-		std::ifstream ifstr (
-						CrossPlatform::getDataFile(file).c_str(),
-						std::ios::in | std::ios::binary);
-		if (ifstr.fail() == true)
+		const std::string file ("TERRAIN/" + _type + ".MCD");
+		const std::vector<char>* const bytes (MapFileCache::getTerrain(_type));
+		if (bytes == nullptr)
 		{
 			throw Exception("MapDataSet::loadData() " + file + " not found");
 		}
 
+		if (bytes->size() % sizeof(MCD) != 0u)
+		{
+			throw Exception("MapDataSet::loadData() Invalid MCD file");
+		}
+
 
 		MapData* record;	// data for a tilepart
 		int id (0);			// <- used only for BLANKS tileset.
-		while (ifstr.read(
-						reinterpret_cast<char*>(&mcd),
-						sizeof(MCD)))
+		for (size_t
+				j  = 0u;
+				j != bytes->size();
+				j += sizeof(MCD))
 		{
+			std::memcpy(
+					&mcd,
+					&(*bytes)[j],
+					sizeof(MCD));
+
 			record = new MapData(this);
 			_records.push_back(record);
 
@@ -266,13 +277,6 @@ void MapDataSet::loadData()
 		}
 
 
-		if (ifstr.eof() == false)
-		{
-			throw Exception("MapDataSet::loadData() Invalid MCD file");
-		}
-
-		ifstr.close();
-
 		// process the MapDataSet to put 'block' values on floortiles (as they don't exist in UFO::Orig)
 		for (std::vector<MapData*>::const_iterator
 				i  = _records.begin();
@@ -0,0 +1,307 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapFileCache.h"
+
+#include <fstream>		// std::ifstream
+#include <iterator>		// std::istreambuf_iterator
+
+#include "../Engine/CrossPlatform.h"
+#include "../Engine/Exception.h"
+#include "../Engine/WorkerPool.h"
+
+#include "../Savegame/Tile.h"
+
+
+namespace OpenXcom
+{
+
+std::map<std::string, MapFile> MapFileCache::_maps;							// static/private.
+std::map<std::string, std::vector<RouteRecord>> MapFileCache::_routes;		// static/private.
+std::map<std::string, std::vector<char>> MapFileCache::_terrains;			// static/private.
+
+
+/**
+ * Gets the contents of the MAP file of a MapBlock.
+ * @note The file is read the first time only.
+ * @param type - reference to the type of the MapBlock
+ * @return, pointer to the MapFile or nullptr if the file was not found
+ */
+const MapFile* MapFileCache::getMap(const std::string& type) // static.
+{
+	std::map<std::string, MapFile>::const_iterator i (_maps.find(type));
+	if (i == _maps.end())
+	{
+		const std::string file ("MAPS/" + type + ".MAP");
+		MapFile mapFile;
+		const ReadResult result (readMap(CrossPlatform::getDataFile(file), &mapFile));
+		if (result == RR_MISSING)
+			return nullptr;
+
+		if (result == RR_INVALID)
+		{
+			throw Exception("MapFileCache::getMap() Invalid MAP file: " + file);
+		}
+
+		i = _maps.insert(std::make_pair(type, mapFile)).first;
+	}
+	return &i->second;
+}
+
+/**
+ * Gets the node-records of the RMP file of a MapBlock.
+ * @note The file is read the first time only.
+ * @param type - reference to the type of the MapBlock
+ * @return, pointer to a vector of RouteRecords or nullptr if the file was not found
+ */
+const std::vector<RouteRecord>* MapFileCache::getRoutes(const std::string& type) // static.
+{
+	std::map<std::string, std::vector<RouteRecord>>::const_iterator i (_routes.find(type));
+	if (i == _routes.end())
+	{
+		const std::string file ("ROUTES/" + type + ".RMP");
+		std::vector<RouteRecord> routes;
+		const ReadResult result (readRoutes(CrossPlatform::getDataFile(file), &routes));
+		if (result == RR_MISSING)
+			return nullptr;
+
+		if (result == RR_INVALID)
+		{
+			throw Exception("MapFileCache::getRoutes() Invalid RMP file: " + file);
+		}
+
+		i = _routes.insert(std::make_pair(type, routes)).first;
+	}
+	return &i->second;
+}
+
+/**
+ * Gets the bytes of the MCD file of a MapDataSet.
+ * @note The file is read the first time only. The records are not parsed here
+ * since MapDataSet builds a fresh set of MapData for every battle that can then
+ * be patched by MCDPatch.
+ * @param type - reference to the type of the MapDataSet
+ * @return, pointer to a vector of bytes or nullptr if the file was not found
+ */
+const std::vector<char>* MapFileCache::getTerrain(const std::string& type) // static.
+{
+	std::map<std::string, std::vector<char>>::const_iterator i (_terrains.find(type));
+	if (i == _terrains.end())
+	{
+		std::vector<char> bytes;
+		if (readBytes(CrossPlatform::getDataFile("TERRAIN/" + type + ".MCD"), &bytes) != RR_OK)
+			return nullptr;
+
+		i = _terrains.insert(std::make_pair(type, bytes)).first;
+	}
+	return &i->second;
+}
+
+/**
+ * Reads the MAP and RMP files of several MapBlocks on the WorkerPool.
+ * @note Files that are already cached are skipped. Files that are missing or
+ * invalid are left out so that getMap() and getRoutes() report them as usual.
+ * The paths are resolved on the calling thread since resolving a path can
+ * change the current data-folder.
+ * @param types - reference to a vector of MapBlock-types
+ */
+void MapFileCache::prefetch(const std::vector<std::string>& types) // static.
+{
+	std::vector<Fetch> fetches;
+	for (std::vector<std::string>::const_iterator
+			i  = types.begin();
+			i != types.end();
+			++i)
+	{
+		if (_maps.find(*i) == _maps.end() || _routes.find(*i) == _routes.end())
+		{
+			fetches.push_back(Fetch());
+			Fetch& fetch (fetches.back());
+			fetch.type = *i;
+			fetch.pathMap    = CrossPlatform::getDataFile("MAPS/"   + *i + ".MAP");
+			fetch.pathRoutes = CrossPlatform::getDataFile("ROUTES/" + *i + ".RMP");
+		}
+	}
+
+	WorkerPool::run(
+				&MapFileCache::fetch,
+				&fetches,
+				fetches.size());
+
+	for (std::vector<Fetch>::const_iterator
+			i  = fetches.begin();
+			i != fetches.end();
+			++i)
+	{
+		if (i->resultMap == RR_OK)
+			_maps.insert(std::make_pair(i->type, i->mapFile));
+
+		if (i->resultRoutes == RR_OK)
+			_routes.insert(std::make_pair(i->type, i->routes));
+	}
+}
+
+/**
+ * Reads the files of a Fetch.
+ * @note Runs on a worker-thread.
+ * @param data	- pointer to the vector of Fetches
+ * @param index	- index of the Fetch
+ */
+void MapFileCache::fetch( // static/private.
+		void* data,
+		size_t index)
+{
+	Fetch& fetch ((*static_cast<std::vector<Fetch>*>(data))[index]);
+	fetch.resultMap    = readMap(   fetch.pathMap,    &fetch.mapFile);
+	fetch.resultRoutes = readRoutes(fetch.pathRoutes, &fetch.routes);
+}
+
+/**
+ * Drops all cached files.
+ * @note Pointers that were handed out become invalid.
+ */
+void MapFileCache::clear() // static.
+{
+	_maps.clear();
+	_routes.clear();
+	_terrains.clear();
+}
+
+/**
+ * Reads a MAP file.
+ * @note A trailing partial record is ignored.
+ * @sa http://www.ufopaedia.org/index.php?title=MAPS
+ * @note Safe to call on a worker-thread.
+ * @param path		- reference to the full path of the file
+ * @param mapFile	- pointer to a MapFile to fill
+ * @return, ReadResult
+ */
+MapFileCache::ReadResult MapFileCache::readMap( // static/private.
+		const std::string& path,
+		MapFile* const mapFile)
+{
+	std::ifstream ifstr (
+					path.c_str(),
+					std::ios::in | std::ios::binary);
+	if (ifstr.fail() == true)
+		return RR_MISSING;
+
+	char xyz[3u];
+	ifstr.read(
+			reinterpret_cast<char*>(&xyz),
+			sizeof(xyz));
+	mapFile->size_x = static_cast<int>(xyz[1u]); // note X-Y switch!
+	mapFile->size_y = static_cast<int>(xyz[0u]); // note X-Y switch!
+	mapFile->size_z = static_cast<int>(xyz[2u]);
+
+	mapFile->parts.clear();
+
+	unsigned char parts[Tile::TILE_PARTS];
+	while (ifstr.read(
+					reinterpret_cast<char*>(&parts),
+					sizeof(parts)))
+	{
+		mapFile->parts.insert(
+							mapFile->parts.end(),
+							parts,
+							parts + Tile::TILE_PARTS);
+	}
+
+	if (ifstr.eof() == false)
+		return RR_INVALID;
+
+	return RR_OK;
+}
+
+/**
+ * Reads an RMP file.
+ * @note A trailing partial record is ignored.
+ * @sa http://www.ufopaedia.org/index.php?title=ROUTES
+ * @note Safe to call on a worker-thread.
+ * @param path		- reference to the full path of the file
+ * @param routes	- pointer to a vector of RouteRecords to fill
+ * @return, ReadResult
+ */
+MapFileCache::ReadResult MapFileCache::readRoutes( // static/private.
+		const std::string& path,
+		std::vector<RouteRecord>* const routes)
+{
+	std::ifstream ifstr (
+					path.c_str(),
+					std::ios::in | std::ios::binary);
+	if (ifstr.fail() == true)
+		return RR_MISSING;
+
+	routes->clear();
+
+	RouteRecord record;
+	char dataArray[24u]; // NOTE: These are signed values. I want unsigned values.
+	while (ifstr.read(
+					reinterpret_cast<char*>(&dataArray),
+					sizeof(dataArray)))
+	{
+		record.pos_x    = static_cast<int>(static_cast<unsigned char>(dataArray[1u])); // NOTE: Here is where x-y values get reversed
+		record.pos_y    = static_cast<int>(static_cast<unsigned char>(dataArray[0u])); // vis-a-vis x/y values in the .RMP files vs. IG loaded values.
+		record.pos_z    = static_cast<int>(static_cast<unsigned char>(dataArray[2u]));
+		// NOTE: 'dataArray[3u]' is not used.
+		record.unitType = static_cast<int>(static_cast<unsigned char>(dataArray[19u]));
+		record.rank     = static_cast<int>(static_cast<unsigned char>(dataArray[20u]));
+		record.patrol   = static_cast<int>(static_cast<unsigned char>(dataArray[21u]));
+		record.attack   = static_cast<int>(static_cast<unsigned char>(dataArray[22u]));
+		record.spawn    = static_cast<int>(static_cast<unsigned char>(dataArray[23u]));
+
+		for (size_t
+				j  = 0u;
+				j != Node::NODE_LINKS;
+				++j)
+		{
+			record.links[j] = static_cast<int>(static_cast<unsigned char>(dataArray[j * 3u + 4u]));	// <- 4[5,6],7[8,9],10[11,12],13[14,15],16[17,18]
+		}																							// -> [distance & unitType of linked nodes are not used]
+		routes->push_back(record);
+	}
+
+	if (ifstr.eof() == false)
+		return RR_INVALID;
+
+	return RR_OK;
+}
+
+/**
+ * Reads a file as is.
+ * @param path	- reference to the full path of the file
+ * @param bytes	- pointer to a vector of bytes to fill
+ * @return, ReadResult
+ */
+MapFileCache::ReadResult MapFileCache::readBytes( // static/private.
+		const std::string& path,
+		std::vector<char>* const bytes)
+{
+	std::ifstream ifstr (
+					path.c_str(),
+					std::ios::in | std::ios::binary);
+	if (ifstr.fail() == true)
+		return RR_MISSING;
+
+	bytes->assign(
+				std::istreambuf_iterator<char>(ifstr),
+				std::istreambuf_iterator<char>());
+	return RR_OK;
+}
+
+}
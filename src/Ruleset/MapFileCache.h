@@ -0,0 +1,149 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_MAPFILECACHE_H
+#define OPENXCOM_MAPFILECACHE_H
+
+#include <map>			// std::map
+#include <string>		// std::string
+#include <vector>		// std::vector
+
+#include "../Savegame/Node.h"
+
+
+namespace OpenXcom
+{
+
+/**
+ * The contents of a MAP file.
+ * @note The sizes are in x/y/z order - the file itself stores y/x/z.
+ */
+struct MapFile
+{
+	int
+		size_x,
+		size_y,
+		size_z;
+	std::vector<unsigned char> parts; // Tile::TILE_PARTS part-ids per tile in file-order
+};
+
+/**
+ * A node-record of an RMP file.
+ * @note The values are the unsigned bytes of the file. The position is in x/y/z
+ * order with z as in the file - ie. not inverted.
+ */
+struct RouteRecord
+{
+	int
+		pos_x,
+		pos_y,
+		pos_z,
+		unitType,
+		rank,
+		patrol,
+		attack,
+		spawn,
+		links[Node::NODE_LINKS];
+};
+
+
+/**
+ * Keeps the MAP, RMP and MCD files of the terrains in memory once they have
+ * been read.
+ * @note BattlescapeGenerator gets its MapBlocks and routes from here and
+ * MapDataSet::loadData() gets its MCD records from here - both while generating
+ * a battle and in SavedBattleGame::loadMapResources() - so that back-to-back
+ * battles don't re-read the same files. The cached files are never altered;
+ * they are dropped by clear() only, which StartState does whenever the rulesets
+ * and resources are (re)loaded and SavedBattleGame does at the end of each
+ * battle if 'Options::battleFileCache' is false.
+ * @note Main-thread only - prefetch() reads on the WorkerPool but fills the
+ * cache on the calling thread.
+ */
+class MapFileCache
+{
+
+private:
+	/**
+	 * The outcome of reading a file.
+	 */
+	enum ReadResult
+	{
+		RR_OK,		// 0
+		RR_MISSING,	// 1
+		RR_INVALID	// 2
+	};
+
+	/**
+	 * The MAP and RMP files of a MapBlock as read by a worker-thread.
+	 */
+	struct Fetch
+	{
+		std::string
+			type,
+			pathMap,
+			pathRoutes;
+		ReadResult
+			resultMap,
+			resultRoutes;
+		MapFile mapFile;
+		std::vector<RouteRecord> routes;
+	};
+
+	static std::map<std::string, MapFile> _maps;
+	static std::map<std::string, std::vector<RouteRecord>> _routes;
+	static std::map<std::string, std::vector<char>> _terrains;
+
+	/// Reads a MAP file.
+	static ReadResult readMap(
+			const std::string& path,
+			MapFile* const mapFile);
+	/// Reads an RMP file.
+	static ReadResult readRoutes(
+			const std::string& path,
+			std::vector<RouteRecord>* const routes);
+	/// Reads a file as is.
+	static ReadResult readBytes(
+			const std::string& path,
+			std::vector<char>* const bytes);
+
+	/// Reads the files of a Fetch.
+	static void fetch(
+			void* data,
+			size_t index);
+
+
+	public:
+		/// Gets the contents of the MAP file of a MapBlock.
+		static const MapFile* getMap(const std::string& type);
+		/// Gets the node-records of the RMP file of a MapBlock.
+		static const std::vector<RouteRecord>* getRoutes(const std::string& type);
+		/// Gets the bytes of the MCD file of a MapDataSet.
+		static const std::vector<char>* getTerrain(const std::string& type);
+
+		/// Reads the MAP and RMP files of several MapBlocks on the WorkerPool.
+		static void prefetch(const std::vector<std::string>& types);
+
+		/// Drops all cached files.
+		static void clear();
+};
+
+}
+
+#endif
@@ -1126,12 +1126,15 @@ T* Ruleset::loadRule( // protected.
 /**
  * Generates a SavedGame with starting data.
  * @param play - pointer to the current Game (used to obviate const of '_game')
+ * @param seed - RNG-seed for the new game (default 0 random)
  * @return, pointer to the SavedGame
  */
-SavedGame* Ruleset::createSave(Game* const play) const
+SavedGame* Ruleset::createSave(
+		Game* const play,
+		uint64_t seed) const
 {
 	//Log(LOG_INFO) << "Ruleset::createSave()";
-	RNG::setSeed();
+	RNG::setSeed(seed);
 
 	SavedGame* const playSave (new SavedGame(this));
 	play->setSavedGame(playSave);
@@ -1257,7 +1260,7 @@ SavedGame* Ruleset::createSave(Game* const play) const
 				++i)
 		{
 			sol = genSoldier(playSave, startTypes[i]);
-			base->getSoldiers()->push_back(sol);
+			base->addSoldier(sol);
 
 			sol->getDiary()->awardOriginalEight(); // grant each Soldier the special Original Eight award.
 		}
@@ -21,6 +21,7 @@
 #define OPENXCOM_RULESET_H
 
 #include <cmath>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -230,7 +231,9 @@ private:
 		void load(const std::string& src);
 
 		/// Generates a starting SavedGame.
-		SavedGame* createSave(Game* const game) const;
+		SavedGame* createSave(
+				Game* const game,
+				uint64_t seed = 0uLL) const;
 
 		/// Gets the pool list for Soldier names.
 //		const std::vector<SoldierNamePool*>& getPools() const;
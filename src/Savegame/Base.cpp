@@ -86,7 +86,11 @@ Base::Base(
 		_recallSoldier(0),
 		_recallTransfer(0),
 		_placed(false),
-		_isQuickDefense(false)
+		_isQuickDefense(false),
+		_transitCrafts(0),
+		_transitEngineers(0),
+		_transitScientists(0),
+		_transitSoldiers(0)
 {
 	_items = new ItemContainer();
 }
@@ -227,7 +231,7 @@ void Base::loadBase(
 					}
 				}
 			}
-			_soldiers.push_back(sol);
+			addSoldier(sol);
 		}
 		else Log(LOG_ERROR) << "Base::loadBase() Failed to load soldier " << type;
 	}
@@ -256,7 +260,7 @@ void Base::loadBase(
 		const int hours ((*i)["hours"].as<int>());
 		Transfer* const transfer (new Transfer(hours));
 		if (transfer->load(*i, this, _rules) == true)
-			_transfers.push_back(transfer);
+			addTransfer(transfer);
 	}
 
 	//Log(LOG_INFO) << ". load research projects";
@@ -430,6 +434,8 @@ std::vector<BaseFacility*>* Base::getFacilities()
 
 /**
  * Gets the list of Soldiers in this Base.
+ * @note Soldiers shall be added and removed by addSoldier() and removeSoldier()
+ * so that the worn-armor tally stays current; reordering the list is okay.
  * @return, pointer to a vector of pointers to soldiers at this base
  */
 std::vector<Soldier*>* Base::getSoldiers()
@@ -448,6 +454,8 @@ std::vector<Craft*>* Base::getCrafts()
 
 /**
  * Gets the list of Transfers destined to this Base.
+ * @note Transfers shall be added and removed by addTransfer() and
+ * removeTransfer() so that the transit-tallies stay current.
  * @return, pointer to a vector of pointers to transfers to this base
  */
 std::vector<Transfer*>* Base::getTransfers()
@@ -455,6 +463,184 @@ std::vector<Transfer*>* Base::getTransfers()
 	return &_transfers;
 }
 
+/**
+ * Adds a Soldier to this Base.
+ * @param sol	- pointer to a Soldier
+ * @param first	- true to insert the Soldier at the top of the list (default false)
+ */
+void Base::addSoldier(
+		Soldier* const sol,
+		bool first)
+{
+	if (first == true)
+		_soldiers.insert(_soldiers.begin(), sol);
+	else
+		_soldiers.push_back(sol);
+
+	tallyArmor(sol->getArmor(), +1);
+}
+
+/**
+ * Removes a Soldier from this Base.
+ * @param i			- iterator to the Soldier
+ * @param dispose	- true to delete the Soldier as well (default false)
+ * @return, iterator to the Soldier that followed @a i
+ */
+std::vector<Soldier*>::const_iterator Base::removeSoldier(
+		std::vector<Soldier*>::const_iterator i,
+		bool dispose)
+{
+	tallyArmor((*i)->getArmor(), -1);
+
+	if (dispose == true)
+		delete *i;
+
+	return _soldiers.erase(i);
+}
+
+/**
+ * Changes the armor of a Soldier at this Base.
+ * @param sol		- pointer to a Soldier
+ * @param arRule	- pointer to RuleArmor
+ */
+void Base::equipArmor(
+		Soldier* const sol,
+		const RuleArmor* const arRule)
+{
+	tallyArmor(sol->getArmor(), -1);
+	sol->setArmor(arRule);
+	tallyArmor(arRule, +1);
+}
+
+/**
+ * Adds a Transfer to this Base.
+ * @param transfer - pointer to a Transfer
+ */
+void Base::addTransfer(Transfer* const transfer)
+{
+	_transfers.push_back(transfer);
+	tallyTransfer(transfer, +1);
+}
+
+/**
+ * Removes and deletes a Transfer from this Base.
+ * @param i - iterator to the Transfer
+ * @return, iterator to the Transfer that followed @a i
+ */
+std::vector<Transfer*>::const_iterator Base::removeTransfer(std::vector<Transfer*>::const_iterator i)
+{
+	tallyTransfer(*i, -1);
+	delete *i;
+
+	return _transfers.erase(i);
+}
+
+/**
+ * Tallies a Transfer into or out of the transit-tallies.
+ * @param transfer	- pointer to a Transfer
+ * @param dir		- +1 to add or -1 to remove
+ */
+void Base::tallyTransfer( // private.
+		const Transfer* const transfer,
+		int dir)
+{
+	switch (transfer->getTransferType())
+	{
+		case PST_SOLDIER:
+			_transitSoldiers += dir;
+			break;
+
+		case PST_SCIENTIST:
+			_transitScientists += dir * transfer->getQuantity();
+			break;
+
+		case PST_ENGINEER:
+			_transitEngineers += dir * transfer->getQuantity();
+			break;
+
+		case PST_CRAFT:
+			_transitCrafts += dir;
+			break;
+
+		case PST_ITEM:
+		{
+			const RuleItem* const itRule (_rules->getItemRule(transfer->getTransferItems()));
+			if ((_transitItems[itRule] += dir * transfer->getQuantity()) == 0)
+				_transitItems.erase(itRule);
+		}
+	}
+}
+
+/**
+ * Tallies an armor into or out of the worn-armor tally.
+ * @note Basic armors don't take up storage-space.
+ * @param arRule	- pointer to RuleArmor
+ * @param dir		- +1 to add or -1 to remove
+ */
+void Base::tallyArmor( // private.
+		const RuleArmor* const arRule,
+		int dir)
+{
+	if (arRule->isBasic() == false)
+	{
+		const RuleItem* const itRule (_rules->getItemRule(arRule->getStoreItem()));
+		if ((_wornArmors[itRule] += dir) == 0)
+			_wornArmors.erase(itRule);
+	}
+}
+
+/**
+ * Checks the tallies against a full recount of Soldiers and Transfers.
+ * @note A mismatch means that a Soldier or Transfer was added or removed
+ * directly on the vectors instead of through the hooks.
+ */
+void Base::verifyTallies() const // private.
+{
+	int
+		crafts		(0),
+		engineers	(0),
+		scientists	(0),
+		soldiers	(0);
+	std::map<const RuleItem*, int>
+		items,
+		armors;
+
+	for (std::vector<Transfer*>::const_iterator
+			i  = _transfers.begin();
+			i != _transfers.end();
+			++i)
+	{
+		switch ((*i)->getTransferType())
+		{
+			case PST_SOLDIER:	++soldiers;							break;
+			case PST_SCIENTIST:	scientists += (*i)->getQuantity();	break;
+			case PST_ENGINEER:	engineers  += (*i)->getQuantity();	break;
+			case PST_CRAFT:		++crafts;							break;
+			case PST_ITEM:
+				items[_rules->getItemRule((*i)->getTransferItems())] += (*i)->getQuantity();
+		}
+	}
+
+	for (std::vector<Soldier*>::const_iterator
+			i  = _soldiers.begin();
+			i != _soldiers.end();
+			++i)
+	{
+		if ((*i)->getArmor()->isBasic() == false)
+			++armors[_rules->getItemRule((*i)->getArmor()->getStoreItem())];
+	}
+
+	if (   crafts     != _transitCrafts
+		|| engineers  != _transitEngineers
+		|| scientists != _transitScientists
+		|| soldiers   != _transitSoldiers
+		|| items      != _transitItems
+		|| armors     != _wornArmors)
+	{
+		Log(LOG_WARNING) << "Base::verifyTallies() " << Language::wstrToUtf8(_label) << " stale tally";
+	}
+}
+
 /**
  * Gets the list of items in this Base.
  * @return, pointer to the ItemContainer for this base
@@ -545,16 +731,7 @@ int Base::getHealthySoldiers() const
  */
 int Base::getTotalSoldiers() const
 {
-	int total (static_cast<int>(_soldiers.size()));
-	for (std::vector<Transfer*>::const_iterator
-			i  = _transfers.begin();
-			i != _transfers.end();
-			++i)
-	{
-		if ((*i)->getTransferType() == PST_SOLDIER)
-			++total;
-	}
-	return total;
+	return static_cast<int>(_soldiers.size()) + _transitSoldiers;
 }
 
 /**
@@ -563,25 +740,7 @@ int Base::getTotalSoldiers() const
  */
 int Base::getTotalScientists() const
 {
-	int total (_scientists);
-	for (std::vector<Transfer*>::const_iterator
-			i  = _transfers.begin();
-			i != _transfers.end();
-			++i)
-	{
-		if ((*i)->getTransferType() == PST_SCIENTIST)
-			total += (*i)->getQuantity();
-	}
-
-	for (std::vector<ResearchProject*>::const_iterator
-			i  = _projectsResearch.begin();
-			i != _projectsResearch.end();
-			++i)
-	{
-		total += (*i)->getAssignedScientists();
-	}
-
-	return total;
+	return _scientists + _transitScientists + getAllocatedScientists();
 }
 
 /**
@@ -607,25 +766,7 @@ int Base::getAllocatedScientists() const
  */
 int Base::getTotalEngineers() const
 {
-	int total (_engineers);
-	for (std::vector<Transfer*>::const_iterator
-			i  = _transfers.begin();
-			i != _transfers.end();
-			++i)
-	{
-		if ((*i)->getTransferType() == PST_ENGINEER)
-			total += (*i)->getQuantity();
-	}
-
-	for (std::vector<ManufactureProject*>::const_iterator
-			i  = _projectsManufacture.begin();
-			i != _projectsManufacture.end();
-			++i)
-	{
-		total += (*i)->getAssignedEngineers();
-	}
-
-	return total;
+	return _engineers + _transitEngineers + getAllocatedEngineers();
 }
 
 /**
@@ -651,6 +792,9 @@ int Base::getAllocatedEngineers() const
  */
 int Base::getUsedQuarters() const
 {
+#ifdef _DEBUG
+	verifyTallies();
+#endif
 	return getTotalSoldiers() + getTotalScientists() + getTotalEngineers();
 }
 
@@ -689,6 +833,9 @@ int Base::getFreeQuarters() const
  */
 double Base::getUsedStores() const
 {
+#ifdef _DEBUG
+	verifyTallies();
+#endif
 	double total (_items->getTotalSize(_rules)); // items
 
 	const RuleItem* itRule;
@@ -715,25 +862,20 @@ double Base::getUsedStores() const
 		}
 	}
 
-	for (std::vector<Transfer*>::const_iterator // transfers
-			i  = _transfers.begin();
-			i != _transfers.end();
+	for (std::map<const RuleItem*, int>::const_iterator // transfers
+			i  = _transitItems.begin();
+			i != _transitItems.end();
 			++i)
 	{
-		if ((*i)->getTransferType() == PST_ITEM)
-		{
-			total += _rules->getItemRule((*i)->getTransferItems())->getStoreSize()
-				   * static_cast<double>((*i)->getQuantity());
-		}
+		total += i->first->getStoreSize() * static_cast<double>(i->second);
 	}
 
-	for (std::vector<Soldier*>::const_iterator // soldier armor
-			i  = _soldiers.begin();
-			i != _soldiers.end();
+	for (std::map<const RuleItem*, int>::const_iterator // soldier armor
+			i  = _wornArmors.begin();
+			i != _wornArmors.end();
 			++i)
 	{
-		if ((*i)->getArmor()->isBasic() == false)
-			total += _rules->getItemRule((*i)->getArmor()->getStoreItem())->getStoreSize();
+		total += i->first->getStoreSize() * static_cast<double>(i->second);
 	}
 
 	return total;
@@ -989,26 +1131,18 @@ bool Base::hasPsiLabs() const
  */
 int Base::getUsedContainment() const
 {
-	int total (0);
-	for (std::map<std::string, int>::const_iterator
-			i  = _items->getContents()->begin();
-			i != _items->getContents()->end();
-			++i)
-	{
-		if (_rules->getItemRule(i->first)->isLiveAlien() == true)
-			total += i->second;
-	}
+#ifdef _DEBUG
+	verifyTallies();
+#endif
+	int total (_items->getTotalLiveAliens(_rules));
 
-	for (std::vector<Transfer*>::const_iterator
-			i  = _transfers.begin();
-			i != _transfers.end();
+	for (std::map<const RuleItem*, int>::const_iterator
+			i  = _transitItems.begin();
+			i != _transitItems.end();
 			++i)
 	{
-		if ((*i)->getTransferType() == PST_ITEM
-			&& _rules->getItemRule((*i)->getTransferItems())->isLiveAlien() == true)
-		{
-			total += (*i)->getQuantity();
-		}
+		if (i->first->isLiveAlien() == true)
+			total += i->second;
 	}
 
 	return (total += getInterrogatedAliens());
@@ -1090,6 +1224,9 @@ int Base::getInterrogatedAliens() const
  */
 int Base::getUsedHangars() const
 {
+#ifdef _DEBUG
+	verifyTallies();
+#endif
 	int
 		total (0),
 		subTotal;
@@ -1118,18 +1255,7 @@ int Base::getUsedHangars() const
 		}
 	}
 
-	total += static_cast<int>(_crafts.size());
-
-	for (std::vector<Transfer*>::const_iterator
-			i  = _transfers.begin();
-			i != _transfers.end();
-			++i)
-	{
-		if ((*i)->getTransferType() == PST_CRAFT)
-			total += (*i)->getQuantity();
-	}
-
-	return total;
+	return total + static_cast<int>(_crafts.size()) + _transitCrafts;
 }
 
 /**
@@ -1882,8 +2008,12 @@ GeoscapeState::DetectType Base::detect(const Ufo* const ufo) const
 {
 	GeoscapeState::DetectType detecttype (GeoscapeState::DT_UNDETECTED);
 
+	const double rangeBest (static_cast<double>(_rules->getRadarRangeBest()));
+	if (isBeyond(ufo, rangeBest) == true)
+		return detecttype;
+
 	const double dist (getDistance(ufo) * radius_earth);
-	if (dist <= static_cast<double>(_rules->getRadarRangeBest()))
+	if (dist <= rangeBest)
 	{
 		int pct (0);
 
@@ -2372,7 +2502,8 @@ std::vector<BaseFacility*>::const_iterator Base::destroyFacility(std::vector<Bas
 				}
 			}
 
-			const std::map<std::string, int>* const craftContents ((*pFac)->getCraft()->getCraftItems()->getContents());
+			const ItemContainer* const craftItems ((*pFac)->getCraft()->getCraftItems());
+			const std::map<std::string, int>* const craftContents (craftItems->getContents());
 			for (std::map<std::string, int>::const_iterator
 					i  = craftContents->begin();
 					i != craftContents->end();
@@ -2423,6 +2554,7 @@ std::vector<BaseFacility*>::const_iterator Base::destroyFacility(std::vector<Bas
 				{
 					if ((*rit)->getTransferType() == PST_CRAFT)
 					{
+						tallyTransfer(*rit, -1);
 						delete (*rit)->getCraft();
 						delete *rit;
 						_transfers.erase((++rit).base());
@@ -2578,6 +2710,7 @@ std::vector<BaseFacility*>::const_iterator Base::destroyFacility(std::vector<Bas
 				case PST_SOLDIER:
 				{
 					--del;
+					tallyTransfer(*rit, -1);
 					delete (*rit)->getSoldier();
 					delete *rit;
 					const std::vector<Transfer*>::const_iterator i (_transfers.erase((++rit).base()));
@@ -2589,6 +2722,7 @@ std::vector<BaseFacility*>::const_iterator Base::destroyFacility(std::vector<Bas
 				case PST_ENGINEER:
 				{
 					del -= (*rit)->getQuantity();
+					tallyTransfer(*rit, -1);
 					delete *rit;
 					const std::vector<Transfer*>::const_iterator i (_transfers.erase((++rit).base()));
 					rit = std::vector<Transfer*>::const_reverse_iterator(i);
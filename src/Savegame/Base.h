@@ -57,6 +57,8 @@ class ItemContainer;
 class Language;
 class ManufactureProject;
 class ResearchProject;
+class RuleArmor;
+class RuleItem;
 class Ruleset;
 class SavedGame;
 class Soldier;
@@ -83,7 +85,12 @@ private:
 		_cashSpent,
 		_defenseReduction,
 		_engineers,
-		_scientists;
+		_scientists,
+
+		_transitCrafts,		// the transit-tallies are kept by addTransfer() and removeTransfer()
+		_transitEngineers,
+		_transitScientists,
+		_transitSoldiers;
 	size_t
 		_recallPurchase,
 		_recallSell,
@@ -105,6 +112,21 @@ private:
 	std::vector<Soldier*> _soldiers;
 	std::vector<Transfer*> _transfers;
 
+	std::map<const RuleItem*, int>
+		_transitItems,	// items in Transfers
+		_wornArmors;	// store-items of the armors worn by Soldiers
+
+	/// Tallies a Transfer into or out of the transit-tallies.
+	void tallyTransfer(
+			const Transfer* const transfer,
+			int dir);
+	/// Tallies an armor into or out of the worn-armor tally.
+	void tallyArmor(
+			const RuleArmor* const arRule,
+			int dir);
+	/// Checks the tallies against a full recount.
+	void verifyTallies() const;
+
 	/// Research Help ala XcomUtil.
 	void researchHelp(const std::string& aLien);
 
@@ -154,6 +176,23 @@ private:
 		/// Gets the Base's transfers.
 		std::vector<Transfer*>* getTransfers();
 
+		/// Adds a Soldier to the Base.
+		void addSoldier(
+				Soldier* const sol,
+				bool first = false);
+		/// Removes a Soldier from the Base.
+		std::vector<Soldier*>::const_iterator removeSoldier(
+				std::vector<Soldier*>::const_iterator i,
+				bool dispose = false);
+		/// Changes the armor of a Soldier at the Base.
+		void equipArmor(
+				Soldier* const sol,
+				const RuleArmor* const arRule);
+		/// Adds a Transfer to the Base.
+		void addTransfer(Transfer* const transfer);
+		/// Removes and deletes a Transfer from the Base.
+		std::vector<Transfer*>::const_iterator removeTransfer(std::vector<Transfer*>::const_iterator i);
+
 		/// Gets the Base's items.
 		ItemContainer* getStorageItems();
 
@@ -23,6 +23,7 @@
 #include "Tile.h"
 
 //#include "../Engine/Logger.h"
+#include "../Engine/ObjectPool.h"
 
 #include "../Ruleset/RuleInventory.h"
 #include "../Ruleset/RuleItem.h"
@@ -33,6 +34,8 @@
 namespace OpenXcom
 {
 
+ObjectPool BattleItem::_pool (sizeof(BattleItem), 256u); // static/private.
+
 /**
  * Initializes an item of the specified type.
  * @param itRule	- pointer to RuleItem
@@ -98,6 +101,28 @@ BattleItem::BattleItem(
 BattleItem::~BattleItem()
 {}
 
+/**
+ * Gets memory for a BattleItem from its ObjectPool.
+ * @param size - size of the object
+ * @return, pointer to the memory
+ */
+void* BattleItem::operator new(size_t size) // static.
+{
+	return _pool.allocate(size);
+}
+
+/**
+ * Returns the memory of a BattleItem to its ObjectPool.
+ * @param block	- pointer to the memory
+ * @param size	- size of the object
+ */
+void BattleItem::operator delete( // static.
+		void* block,
+		size_t size)
+{
+	_pool.release(block, size);
+}
+
 /**
  * Loads the item from a YAML file.
  * @param node - YAML node
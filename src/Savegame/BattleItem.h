@@ -27,6 +27,7 @@ namespace OpenXcom
 {
 
 class BattleUnit;
+class ObjectPool;
 class RuleInventory;
 class RuleItem;
 class SavedBattleGame;
@@ -40,6 +41,8 @@ class BattleItem
 {
 
 private:
+	static ObjectPool _pool;
+
 	bool _property;
 	int
 		_fuse,
@@ -70,6 +73,13 @@ private:
 		/// Cleans up the BattleItem.
 		~BattleItem();
 
+		/// Gets memory for a BattleItem from its ObjectPool.
+		static void* operator new(size_t size);
+		/// Returns the memory of a BattleItem to its ObjectPool.
+		static void operator delete(
+				void* block,
+				size_t size);
+
 		/// Loads the BattleItem from YAML.
 		void load(const YAML::Node& node);
 		/// Loads a deleted BattleItem from YAML.
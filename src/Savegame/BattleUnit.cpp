@@ -40,6 +40,7 @@
 #include "../Engine/Language.h"
 //#include "../Engine/Logger.h"
 //#include "../Engine/Options.h"
+#include "../Engine/ObjectPool.h"
 #include "../Engine/RNG.h"
 #include "../Engine/Sound.h"
 #include "../Engine/Surface.h"
@@ -56,6 +57,8 @@
 namespace OpenXcom
 {
 
+ObjectPool BattleUnit::_pool (sizeof(BattleUnit), 64u); // static/private.
+
 //bool BattleUnit::_debug = false; // static.
 
 
@@ -458,6 +461,28 @@ BattleUnit::~BattleUnit()
 		delete _unitAiState;
 }
 
+/**
+ * Gets memory for a BattleUnit from its ObjectPool.
+ * @param size - size of the object
+ * @return, pointer to the memory
+ */
+void* BattleUnit::operator new(size_t size) // static.
+{
+	return _pool.allocate(size);
+}
+
+/**
+ * Returns the memory of a BattleUnit to its ObjectPool.
+ * @param block	- pointer to the memory
+ * @param size	- size of the object
+ */
+void BattleUnit::operator delete( // static.
+		void* block,
+		size_t size)
+{
+	_pool.release(block, size);
+}
+
 /**
  * Loads this BattleUnit from a YAML file.
  * @param node - reference a YAML node
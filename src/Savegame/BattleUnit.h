@@ -47,6 +47,7 @@ class BattlescapeGame;
 class CivilianBAIState;
 class Language;
 class Node;
+class ObjectPool;
 class RuleArmor;
 class RuleInventory;
 class RuleUnit;
@@ -132,6 +133,8 @@ class BattleUnit
 		static const size_t PARTS_BODY = 6u;
 
 private:
+	static ObjectPool _pool;
+
 	static const size_t PARTS_ARMOR = 5u;
 	static const int DOSE_LETHAL = 3;
 //	static const int SPEC_WEAPON_MAX = 3;
@@ -305,6 +308,13 @@ private:
 		/// Cleans up the BattleUnit.
 		~BattleUnit();
 
+		/// Gets memory for a BattleUnit from its ObjectPool.
+		static void* operator new(size_t size);
+		/// Returns the memory of a BattleUnit to its ObjectPool.
+		static void operator delete(
+				void* block,
+				size_t size);
+
 		/// Loads the BattleUnit from YAML.
 		void load(const YAML::Node& node);
 		/// Loads the vector of units-spotted this turn during SavedBattleGame load.
@@ -1225,9 +1225,10 @@ void Craft::refuel()
  */
 bool Craft::detect(const Target* const target) const
 {
-	const int range (_crRule->getRangeRadar());
-	return range != 0
-		&& getDistance(target) * radius_earth <= static_cast<double>(range);
+	const double range (static_cast<double>(_crRule->getRangeRadar()));
+	return range != 0.
+		&& isBeyond(target, range) == false
+		&& getDistance(target) * radius_earth <= range;
 }
 
 /**
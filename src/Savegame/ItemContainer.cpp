@@ -19,7 +19,7 @@
 
 #include "ItemContainer.h"
 
-//#include "../Engine/Logger.h"
+#include "../Engine/Logger.h"
 
 #include "../Ruleset/RuleItem.h"
 #include "../Ruleset/Ruleset.h"
@@ -32,6 +32,10 @@ namespace OpenXcom
  * Initializes an ItemContainer with no contents.
  */
 ItemContainer::ItemContainer()
+	:
+		_tallied(false),
+		_totalSize(0.),
+		_totalLiveAliens(0)
 {}
 
 /**
@@ -47,6 +51,7 @@ ItemContainer::~ItemContainer()
 void ItemContainer::load(const YAML::Node& node)
 {
 	_contents = node.as<std::map<std::string, int>>(_contents);
+	_tallied = false;
 }
 
 /**
@@ -93,6 +98,8 @@ void ItemContainer::addItem(
 {
 	if (qty > 0 && type.empty() == false) // likely redundant in a well-wrought ruleset.
 	{
+		_tallied = false;
+
 		if (_contents.find(type) != _contents.end())
 			_contents[type] += qty;
 		else
@@ -114,6 +121,8 @@ void ItemContainer::removeItem(
 	if (qty > 0 && type.empty() == false // likely redundant in a well-wrought ruleset.
 		&& _contents.find(type) != _contents.end())
 	{
+		_tallied = false;
+
 		if (qty < _contents[type])
 			_contents[type] -= qty;
 		else
@@ -190,28 +199,92 @@ bool ItemContainer::isEmpty()
 }
 
 /**
- * Gets the total size (in storage-units) of the items in the container.
+ * Tallies the total size and the quantity of live aliens of the contents.
+ * @note The tallies are kept until the contents change; recounting them
+ * instead of adjusting them keeps the sum free of floating-point drift.
  * @param rules - pointer to Ruleset
- * @return, total item size
  */
-double ItemContainer::getTotalSize(const Ruleset* const rules) const
+void ItemContainer::tally(const Ruleset* const rules) const // private.
 {
-	double total (0.);
+	_totalSize = 0.;
+	_totalLiveAliens = 0;
+
+	const RuleItem* itRule;
 	for (std::map<std::string, int>::const_iterator
 			i = _contents.begin();
 			i != _contents.end();
 			++i)
 	{
-		total += rules->getItemRule(i->first)->getStoreSize() * static_cast<double>(i->second);
+		itRule = rules->getItemRule(i->first);
+		_totalSize += itRule->getStoreSize() * static_cast<double>(i->second);
+
+		if (itRule->isLiveAlien() == true)
+			_totalLiveAliens += i->second;
 	}
-	return total;
+	_tallied = true;
+}
+
+/**
+ * Gets the total size (in storage-units) of the items in the container.
+ * @note In debug-builds the cached tally is checked against a recount.
+ * @param rules - pointer to Ruleset
+ * @return, total item size
+ */
+double ItemContainer::getTotalSize(const Ruleset* const rules) const
+{
+	if (_tallied == false)
+		tally(rules);
+#ifdef _DEBUG
+	else
+	{
+		const double total (_totalSize);
+		tally(rules);
+		if (total != _totalSize)
+			Log(LOG_WARNING) << "ItemContainer::getTotalSize() stale tally " << total << " recount " << _totalSize;
+	}
+#endif
+	return _totalSize;
+}
+
+/**
+ * Gets the total quantity of live aliens in the container.
+ * @param rules - pointer to Ruleset
+ * @return, quantity of live aliens
+ */
+int ItemContainer::getTotalLiveAliens(const Ruleset* const rules) const
+{
+	if (_tallied == false)
+		tally(rules);
+#ifdef _DEBUG
+	else
+	{
+		const int total (_totalLiveAliens);
+		tally(rules);
+		if (total != _totalLiveAliens)
+			Log(LOG_WARNING) << "ItemContainer::getTotalLiveAliens() stale tally " << total << " recount " << _totalLiveAliens;
+	}
+#endif
+	return _totalLiveAliens;
 }
 
 /**
  * Returns all the items currently contained within.
+ * @note The caller may change the contents through the pointer so the tallies
+ * are invalidated.
  * @return, pointer to the map of contents
  */
 std::map<std::string, int>* ItemContainer::getContents()
+{
+	_tallied = false;
+	return &_contents;
+}
+
+/**
+ * Returns all the items currently contained within read-only.
+ * @note Unlike the mutable getContents() this leaves the tallies intact.
+ * @return, pointer to the const map of contents
+ */
+const std::map<std::string, int>* ItemContainer::getContents() const
 {
 	return &_contents;
 }
@@ -43,6 +43,13 @@ class ItemContainer
 private:
 	std::map<std::string, int> _contents;
 
+	mutable bool _tallied;			// true if the tallies below match the contents
+	mutable double _totalSize;
+	mutable int _totalLiveAliens;
+
+	/// Tallies the size and live-aliens of the contents.
+	void tally(const Ruleset* const rules) const;
+
 
 	public:
 		/// Creates an empty item container.
@@ -78,10 +85,14 @@ private:
 		bool isEmpty();
 
 		/// Gets the total size of items in the container.
-		double getTotalSize(const Ruleset* const rule) const;
+		double getTotalSize(const Ruleset* const rules) const;
+		/// Gets the total quantity of live aliens in the container.
+		int getTotalLiveAliens(const Ruleset* const rules) const;
 
 		/// Gets all the items in the container.
 		std::map<std::string, int>* getContents();
+		/// Gets all the items in the container read-only.
+		const std::map<std::string, int>* getContents() const;
 };
 
 }
@@ -296,12 +296,26 @@ void MovingTarget::calculateSpeed() // protected/virtual.
 		//Log(LOG_INFO) << ". . lonPoint= "	<< _lonPoint;
 		//Log(LOG_INFO) << ". . latPoint= "	<< _latPoint;
 
+		double
+			latSin,
+			latCos,
+			latSinPoint,
+			latCosPoint;
+		getLatitudeTrig(latSin, latCos);
+		if (_latPoint == _target->getLatitude()) // not a meet-point
+			_target->getLatitudeTrig(latSinPoint, latCosPoint);
+		else
+		{
+			latSinPoint = std::sin(_latPoint);
+			latCosPoint = std::cos(_latPoint);
+		}
+
 		const double
 			dLon (std::sin(_lonPoint - _lon)
-				* std::cos(_latPoint)),
-			dLat (std::cos(_lat)
-				* std::sin(_latPoint) - std::sin(_lat)
-				* std::cos(_latPoint)
+				* latCosPoint),
+			dLat (latCos
+				* latSinPoint - latSin
+				* latCosPoint
 				* std::cos(_lonPoint - _lon)),
 			dist (std::sqrt((dLon * dLon) + (dLat * dLat)));
 
@@ -343,23 +357,23 @@ void MovingTarget::calculateMeetPoint() // private.
 	if (ufo != nullptr && ufo->getTarget() != nullptr
 		&& AreSame(ufo->_speedRads, 0.) == false)
 	{
+		double
+			sin_latUfo,
+			cos_latUfo,
+			sin_latUfoTarget,
+			cos_latUfoTarget;
+		ufo->getLatitudeTrig(sin_latUfo, cos_latUfo);
+		ufo->getTarget()->getLatitudeTrig(sin_latUfoTarget, cos_latUfoTarget);
+
 		const double
 			lonUfo           (ufo->getLongitude()),
 			sin_lonUfo       (std::sin(lonUfo)),
 			cos_lonUfo       (std::cos(lonUfo)),
 
-			latUfo           (ufo->getLatitude()),
-			sin_latUfo       (std::sin(latUfo)),
-			cos_latUfo       (std::cos(latUfo)),
-
 			lonUfoTarget     (ufo->getTarget()->getLongitude()),
 			sin_lonUfoTarget (std::sin(lonUfoTarget)),
 			cos_lonUfoTarget (std::cos(lonUfoTarget)),
 
-			latUfoTarget     (ufo->getTarget()->getLatitude()),
-			sin_latUfoTarget (std::sin(latUfoTarget)),
-			cos_latUfoTarget (std::cos(latUfoTarget)),
-
 			sin_lon          (std::sin(lonUfoTarget - lonUfo));
 
 		double
@@ -376,39 +390,50 @@ void MovingTarget::calculateMeetPoint() // private.
 		ny *= nk;
 		nz *= nk;
 
+		double
+			latSin,	// this MovingTarget doesn't move during the iteration so
+			latCos;	// the trig of its own latitude is taken only once
+		getLatitudeTrig(latSin, latCos);
+
 		double
 			path (0.),
-			dist;
+			dist,
+			sin_lonPoint,
+			cos_lonPoint;
 		double
 			old_path,
 			new_path (std::acos(
-								std::cos(_lat)
+								latCos
 							  * std::cos(_latPoint)
 							  * std::cos(_lonPoint - _lon)
-							  + std::sin(_lat)
+							  + latSin
 							  * std::sin(_latPoint)));
 		const double speedRatio (_speedRads / ufo->_speedRads);
 
 		do
 		{
 			old_path = new_path;
-			_latPoint += nx * std::sin(_lonPoint)
-					   - ny * std::cos(_lonPoint);
+
+			sin_lonPoint = std::sin(_lonPoint);
+			cos_lonPoint = std::cos(_lonPoint);
+
+			_latPoint += nx * sin_lonPoint
+					   - ny * cos_lonPoint;
 
 			if (std::fabs(_latPoint) < M_PI_2)
 				_lonPoint += nz
-							  - (nx * std::cos(_lonPoint)
-							  +  ny * std::sin(_lonPoint))
+							  - (nx * cos_lonPoint
+							  +  ny * sin_lonPoint)
 							  * std::tan(_latPoint);
 			else
 				_lonPoint += M_PI;
 
 			path += _speedRads;
 			dist = std::acos(
-							std::cos(_lat)
+							latCos
 						  * std::cos(_latPoint)
 						  * std::cos(_lonPoint - _lon)
-						  + std::sin(_lat)
+						  + latSin
 						  * std::sin(_latPoint));
 			new_path = dist - path * speedRatio;
 		}
@@ -19,10 +19,14 @@
 
 #include "Node.h"
 
+#include "../Engine/ObjectPool.h"
+
 
 namespace OpenXcom
 {
 
+ObjectPool Node::_pool (sizeof(Node), 256u); // static/private.
+
 // The following table presents the order in which aLien ranks choose nodes of
 // alternate ranks to spawn on ('_priority' here, "Spawn" in mapView) or path to
 // ('_patrol' here, "Flags" or "Importance" in mapView).
@@ -128,6 +132,28 @@ Node::Node(
 Node::~Node()
 {}
 
+/**
+ * Gets memory for a Node from its ObjectPool.
+ * @param size - size of the object
+ * @return, pointer to the memory
+ */
+void* Node::operator new(size_t size) // static.
+{
+	return _pool.allocate(size);
+}
+
+/**
+ * Returns the memory of a Node to its ObjectPool.
+ * @param block	- pointer to the memory
+ * @param size	- size of the object
+ */
+void Node::operator delete( // static.
+		void* block,
+		size_t size)
+{
+	_pool.release(block, size);
+}
+
 /**
  * Loads this Node from a YAML file.
  * @param node - reference a YAML node
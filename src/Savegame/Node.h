@@ -28,6 +28,8 @@
 namespace OpenXcom
 {
 
+class ObjectPool;
+
 enum NodeRank
 {
 	NR_SCOUT,		// 0
@@ -50,6 +52,8 @@ class Node
 {
 
 private:
+	static ObjectPool _pool;
+
 	bool _allocated;
 	int
 		_id,				// unique identifier
@@ -97,6 +101,13 @@ private:
 		/// Cleans up the Node.
 		~Node();
 
+		/// Gets memory for a Node from its ObjectPool.
+		static void* operator new(size_t size);
+		/// Returns the memory of a Node to its ObjectPool.
+		static void operator delete(
+				void* block,
+				size_t size);
+
 		/// Loads the Node from YAML.
 		void load(const YAML::Node& node);
 		/// Saves the Node to YAML.
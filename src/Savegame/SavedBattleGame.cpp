@@ -22,12 +22,14 @@
 //#include <vector>
 #include <cassert>
 #include <cstring>
+#include <new>
 
 #include "BattleItem.h"
 #include "Node.h"
 #include "SavedGame.h"
 #include "SerializationHelper.h"
 #include "Tile.h"
+#include "UnitTable.h"
 
 #include "../Battlescape/AlienBAIState.h"
 #include "../Battlescape/CivilianBAIState.h"
@@ -42,6 +44,7 @@
 #include "../Engine/Game.h"
 #include "../Engine/Language.h"
 #include "../Engine/Logger.h"
+#include "../Engine/ObjectPool.h"
 //#include "../Engine/Options.h"
 #include "../Engine/RNG.h"
 
@@ -50,6 +53,7 @@
 #include "../Resource/XcomResourcePack.h"
 
 #include "../Ruleset/MapDataSet.h"
+#include "../Ruleset/MapFileCache.h"
 #include "../Ruleset/MCDPatch.h"
 #include "../Ruleset/OperationPool.h"
 #include "../Ruleset/RuleArmor.h"
@@ -86,6 +90,7 @@ SavedBattleGame::SavedBattleGame(
 		_turn(1),
 		_debugTac(false),
 		_aborted(false),
+		_aniTilesBuilt(false),
 		_itemId(0),
 		_objectiveType(TILE),
 		_objectivesRequired(0),
@@ -99,6 +104,8 @@ SavedBattleGame::SavedBattleGame(
 		_tacType(TCT_DEFAULT),
 		_controlDestroyed(false),
 		_tiles(nullptr),
+		_tileBlock(nullptr),
+		_unitTable(new UnitTable(&_units)),
 		_pacified(false),
 		_rfTriggerOffset(0,0,-1),
 		_dropTu(0),
@@ -217,16 +224,7 @@ SavedBattleGame::~SavedBattleGame()
 {
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "Delete SavedBattleGame";
-	if (_tiles != nullptr)
-	{
-		for (size_t
-				i = 0u;
-				i != _qtyTilesTotal;
-				++i)
-			delete _tiles[i];
-
-		delete[] _tiles;
-	}
+	deleteTiles();
 
 	for (std::vector<MapDataSet*>::const_iterator
 			i  = _battleDataSets.begin();
@@ -234,6 +232,9 @@ SavedBattleGame::~SavedBattleGame()
 			++i)
 		(*i)->unloadData();
 
+	if (Options::battleFileCache == false)
+		MapFileCache::clear();
+
 	for (std::vector<Node*>::const_iterator
 			i  = _nodes.begin();
 			i != _nodes.end();
@@ -272,6 +273,9 @@ SavedBattleGame::~SavedBattleGame()
 
 	delete _pf;
 	delete _te;
+	delete _unitTable;
+
+	ObjectPool::trimAll(); // hand the memory of the battle's units, items, nodes etc. back in one go
 }
 
 /**
@@ -884,6 +888,57 @@ Tile** SavedBattleGame::getTiles() const
 	return _tiles;
 }
 
+/**
+ * Gets the list of Tiles that have animated parts.
+ * @note The list is built on first access after the map is initialized. Map
+ * removes Tiles that no longer animate; destroyed and changed parts get added
+ * by addAnimatedTile().
+ * @return, reference to a vector of pointers to Tiles
+ */
+std::vector<Tile*>& SavedBattleGame::getAnimatedTiles()
+{
+	if (_aniTilesBuilt == false)
+	{
+		_aniTilesBuilt = true;
+
+		for (size_t
+				i = 0u;
+				i != _qtyTilesTotal;
+				++i)
+		{
+			addAnimatedTile(_tiles[i]);
+		}
+	}
+	return _aniTiles;
+}
+
+/**
+ * Adds a Tile to the list of animated Tiles if it has animated parts.
+ * @param tile - pointer to a Tile
+ */
+void SavedBattleGame::addAnimatedTile(Tile* const tile)
+{
+	if (tile->isAniListed() == false
+		&& tile->isAnimated() == true)
+	{
+		tile->setAniListed();
+		_aniTiles.push_back(tile);
+	}
+}
+
+/**
+ * Flags a Tile as dangerous to the AI until the start of next turn.
+ * @param tile - pointer to a Tile
+ */
+void SavedBattleGame::addDangerTile(Tile* const tile)
+{
+	if (tile->getDangerous() == false)
+	{
+		tile->setDangerous();
+		_dangerTiles.push_back(tile);
+	}
+}
+
 /**
  * Deletes the old and initializes a new array of Tiles after clearing MCD types
  * and deleting any/all old Nodes.
@@ -905,6 +960,12 @@ void SavedBattleGame::initMap(
 {
 	_battleDataSets.clear(); // clear MCD types.
 
+	_aniTiles.clear();
+	_aniTilesBuilt = false;
+
+	_dangerTiles.clear();
+	_volatileTiles.clear();
+
 	for (std::vector<Node*>::const_iterator // delete Nodes ->
 			i  = _nodes.begin();
 			i != _nodes.end();
@@ -914,16 +975,7 @@ void SavedBattleGame::initMap(
 	}
 	_nodes.clear();
 
-	if (_tiles != nullptr) // delete Tiles ->
-	{
-		for (size_t
-				i = 0u;
-				i != _qtyTilesTotal;
-				++i)
-			delete _tiles[i];
-
-		delete[] _tiles;
-	}
+	deleteTiles();
 
 	_qtyTilesTotal = static_cast<size_t>( // create Tiles ->
 					 (_mapsize_x = mapsize_x)
@@ -931,6 +983,7 @@ void SavedBattleGame::initMap(
 				   * (_mapsize_z = mapsize_z));
 
 	_tiles = new Tile*[_qtyTilesTotal];
+	_tileBlock = static_cast<Tile*>(::operator new(sizeof(Tile) * _qtyTilesTotal));
 
 	Position pos;
 	for (size_t
@@ -944,7 +997,32 @@ void SavedBattleGame::initMap(
 				&pos.y,
 				&pos.z);
 
-		_tiles[i] = new Tile(pos);
+		_tiles[i] = new (_tileBlock + i) Tile(pos, &_volatileTiles);
+	}
+}
+
+/**
+ * Destroys the Tiles.
+ * @note The Tiles are built in a single block by initMap() so they are freed
+ * together instead of one by one.
+ */
+void SavedBattleGame::deleteTiles() // private.
+{
+	if (_tiles != nullptr)
+	{
+		for (size_t
+				i = 0u;
+				i != _qtyTilesTotal;
+				++i)
+		{
+			_tiles[i]->~Tile();
+		}
+
+		::operator delete(_tileBlock);
+		delete[] _tiles;
+
+		_tileBlock = nullptr;
+		_tiles = nullptr;
 	}
 }
 
@@ -1297,7 +1375,7 @@ bool SavedBattleGame::factionEndTurn()
 //		_playSave->save(file + SavedGame::SAVE_ExtDot);
 
 		_playSave->setLabel(SavedGame::SAVELABEL_TacTurnEnd);	// this Save is done auto at the end of Player's turn
-		_playSave->save(SavedGame::SAVE_TacTurnEnd);			// vid BattlescapeGame::endTurn() for start of Player turn
+		_playSave->saveAsync(SavedGame::SAVE_TacTurnEnd);			// vid BattlescapeGame::endTurn() for start of Player turn
 	}															// vid InventoryState::btnOkClick() for start of tactical
 
 
@@ -1586,6 +1664,15 @@ std::vector<BattleUnit*>* SavedBattleGame::getUnits()
 	return &_units;
 }
 
+/**
+ * Gets the list of BattleUnits.
+ * @return, pointer to a const vector of pointers to the BattleUnits
+ */
+const std::vector<BattleUnit*>* SavedBattleGame::getUnits() const
+{
+	return &_units;
+}
+
 /**
  * Gets the list of shuffled BattleUnits.
  * @return, pointer to a vector of pointers to the BattleUnits
@@ -1622,6 +1709,15 @@ TileEngine* SavedBattleGame::getTileEngine() const
 	return _te;
 }
 
+/**
+ * Gets the packed table of the units.
+ * @return, pointer to the UnitTable
+ */
+UnitTable* SavedBattleGame::getUnitTable() const
+{
+	return _unitTable;
+}
+
 /**
  * Gets the list of MCDs for the battlefield.
  * @return, pointer to a vector of pointers to MapDataSets
@@ -2125,30 +2221,45 @@ bool SavedBattleGame::isNodeType(
 
 /**
  * Carries out full-turn preparations such as fire and smoke spreading.
- * @note Also explodes any explosive Tiles that get destroyed by fire.
+ * @note Also explodes any explosive Tiles that get destroyed by fire. Only the
+ * Tiles that are listed as burning or smoking are processed; they are taken in
+ * tile-array order so that RNG-consumption is the same as a sweep of the map.
+ * Tiles that catch fire or smoke during the spread are not processed until
+ * next turn.
  */
 void SavedBattleGame::tileVolatiles() // private.
 {
+	std::sort(
+			_volatileTiles.begin(),
+			_volatileTiles.end(),
+			IsPrecedingTile());
+
 	std::vector<Tile*>
 		tilesFired,
 		tilesSmoked;
 
-	Tile* tile;
-	for (size_t
-			i = 0u;
-			i != _qtyTilesTotal;
+	for (std::vector<Tile*>::const_iterator
+			i  = _volatileTiles.begin();
+			i != _volatileTiles.end();
 			++i)
 	{
-		tile = getTiles()[i];
-		if (tile->getFire() != 0)
-			tilesFired.push_back(tile);
+		if ((*i)->getFire() != 0)
+			tilesFired.push_back(*i);
 
-		if (tile->getSmoke() != 0)
-			tilesSmoked.push_back(tile);
+		if ((*i)->getSmoke() != 0)
+			tilesSmoked.push_back(*i);
+	}
 
-		tile->setDangerous(false); // reset.
+	for (std::vector<Tile*>::const_iterator
+			i  = _dangerTiles.begin();
+			i != _dangerTiles.end();
+			++i)
+	{
+		(*i)->setDangerous(false); // reset.
 	}
+	_dangerTiles.clear();
 
+	Tile* tile;
 	int var;
 	for (std::vector<Tile*>::const_iterator // TODO: Spread fires upward similar to smoke below_
 			i  = tilesFired.begin();
@@ -2228,6 +2339,16 @@ void SavedBattleGame::tileVolatiles() // private.
 			}
 		}
 	}
+	std::vector<Tile*>::iterator j (_volatileTiles.begin()); // remove Tiles that have cleared
+	for (std::vector<Tile*>::const_iterator
+			i  = _volatileTiles.begin();
+			i != _volatileTiles.end();
+			++i)
+	{
+		if ((*i)->delistVolatile() == false)
+			*j++ = *i;
+	}
+	_volatileTiles.erase(j, _volatileTiles.end());
 }
 
 /**
@@ -69,6 +69,7 @@ class SavedGame;
 class State;
 class Tile;
 class TileEngine;
+class UnitTable;
 
 
 /**
@@ -83,6 +84,7 @@ private:
 
 	bool
 		_aborted,
+		_aniTilesBuilt,
 		_cheatAI,
 		_controlDestroyed,
 		_debugTac,
@@ -120,8 +122,10 @@ private:
 	SavedGame* _playSave;
 	Tile
 		* _equiptTile,
+		* _tileBlock, // the Tiles are built in one block of memory
 		** _tiles;
 	TileEngine* _te;
+	UnitTable* _unitTable;
 
 	std::string
 		_alienRace,
@@ -144,6 +148,10 @@ private:
 		_shuffleUnits;
 	std::vector<MapDataSet*> _battleDataSets;
 	std::vector<Node*> _nodes;
+	std::vector<Tile*>
+		_aniTiles,
+		_dangerTiles,
+		_volatileTiles;
 	std::vector<Position>
 		_storageSpace,
 		_tileSearch;
@@ -169,6 +177,8 @@ private:
 
 	/// Carries out full-turn preparations for Tiles.
 	void tileVolatiles();
+	/// Destroys the Tiles.
+	void deleteTiles();
 
 
 	public:
@@ -193,6 +203,12 @@ private:
 
 		/// Gets a pointer to the tiles.
 		Tile** getTiles() const;
+		/// Gets the list of Tiles that have animated parts.
+		std::vector<Tile*>& getAnimatedTiles();
+		/// Adds a Tile to the list of animated Tiles if it has animated parts.
+		void addAnimatedTile(Tile* const tile);
+		/// Flags a Tile as dangerous to the AI until the start of next turn.
+		void addDangerTile(Tile* const tile);
 
 		/// Sets the dimensions of the map and initializes Tiles.
 		void initMap(
@@ -304,6 +320,8 @@ private:
 		std::vector<Node*>* getNodes();
 		/// Gets a pointer to the list of units.
 		std::vector<BattleUnit*>* getUnits();
+		/// Gets a pointer to the list of units.
+		const std::vector<BattleUnit*>* getUnits() const;
 		/// Gets a pointer to the list of shuffled units.
 		std::vector<BattleUnit*>* getShuffleUnits();
 		/// Gets a pointer to the list of items.
@@ -313,6 +331,8 @@ private:
 		Pathfinding* getPathfinding() const;
 		/// Gets a pointer to the tileengine.
 		TileEngine* getTileEngine() const;
+		/// Gets the packed table of the units.
+		UnitTable* getUnitTable() const;
 
 		/// Gets the battle's MCD sets.
 		std::vector<MapDataSet*>* getBattleDataSets();
@@ -78,7 +78,13 @@ const std::string // static. ->
 	SavedGame::SAVE_BakDot     = ".try",			// for backup during a regular save
 	SavedGame::SAVE_TacMission = "tac_MISSION.sav",
 	SavedGame::SAVE_TacTurnBeg = "tac_BEG.sav",
-	SavedGame::SAVE_TacTurnEnd = "tac_END.sav";
+	SavedGame::SAVE_TacTurnEnd = "tac_END.sav",
+	SavedGame::SAVE_Index      = "saves.idx";		// cached brief-info of the saves-list
+
+const size_t SavedGame::SAVE_BRIEF_MAX = 16384u; // static. max bytes to scan for the brief-info section
+
+SDL_Thread* SavedGame::_saveThread = nullptr;	// static/private.
+SaveSnapshot* SavedGame::_saveSnap = nullptr;	// static/private.
 
 const std::wstring // static. ->
 	SavedGame::SAVELABEL_Ironballs        = L"_ironballs_", // default save-label if user doesn't supply a label
@@ -254,6 +260,9 @@ SavedGame::~SavedGame()
 
 /**
  * Gets all the info of the saves found in the user folder.
+ * @note The brief-info of each save is cached in an index-file keyed by
+ * filename, modified-date, and size so that only new or changed saves need to
+ * be read - and then only their brief-info section.
  * @param lang		- pointer to the loaded Language
  * @param autoquick	- true to include autosaves and quicksaves
  * @return, a vector of SaveInfo structs (SavedGame.h)
@@ -262,43 +271,72 @@ std::vector<SaveInfo> SavedGame::getList( // static.
 		const Language* const lang,
 		bool autoquick)
 {
-	std::vector<std::string> saves;
-	std::vector<SaveInfo> info;
+	const std::string error (finishSave());
+	if (error.empty() == false)
+		Log(LOG_ERROR) << error;
 
-	if (autoquick == true)
+	const std::string pfeIndex (Options::getUserFolder() + SAVE_Index);
+
+	YAML::Node index;
+	if (CrossPlatform::fileExists(pfeIndex) == true)
 	{
-		saves = CrossPlatform::getFolderContents(Options::getUserFolder(), SAVE_Ext_AQ);
-		for (std::vector<std::string>::const_iterator
-				i  = saves.begin();
-				i != saves.end();
-				++i)
+		try
 		{
-			try
-			{
-				info.push_back(getSaveInfo(*i, lang));
-			}
-			catch (Exception& e)
-			{
-				Log(LOG_ERROR) << e.what();
-				continue;
-			}
-			catch (YAML::Exception& e)
-			{
-				Log(LOG_ERROR) << e.what();
-				continue;
-			}
+			index = YAML::LoadFile(pfeIndex)["saves"];
+		}
+		catch (YAML::Exception& e)
+		{
+			Log(LOG_WARNING) << "SavedGame::getList() Rebuilding " << SAVE_Index << " - " << e.what();
 		}
 	}
 
-	saves = CrossPlatform::getFolderContents(Options::getUserFolder(), SAVE_Ext);
+	std::vector<std::string> saves;
+	if (autoquick == true)
+		saves = CrossPlatform::getFolderContents(Options::getUserFolder(), SAVE_Ext_AQ);
+
+	const std::vector<std::string> savesSav (CrossPlatform::getFolderContents(Options::getUserFolder(), SAVE_Ext));
+	saves.insert(
+			saves.end(),
+			savesSav.begin(),
+			savesSav.end());
+
+	std::vector<SaveInfo> info;
+
+	YAML::Node indexOut;
+	bool rewrite (false);
+
 	for (std::vector<std::string>::const_iterator
 			i  = saves.begin();
 			i != saves.end();
 			++i)
 	{
+		const std::string pfe (Options::getUserFolder() + *i);
+		const int64_t  date (static_cast<int64_t>(CrossPlatform::getDateModified(pfe)));
+		const uint64_t size (static_cast<uint64_t>(CrossPlatform::getFileSize(pfe)));
+
 		try
 		{
-			info.push_back(getSaveInfo(*i, lang));
+			YAML::Node brief;
+
+			const YAML::Node& indexConst (index); // do not add zombie-entries to the index
+			if (indexConst.IsMap() == true
+				&& indexConst[*i]
+				&& indexConst[*i]["date"].as<int64_t>(-1) == date
+				&& indexConst[*i]["size"].as<uint64_t>(0u) == size)
+			{
+				brief = indexConst[*i]["brief"];
+			}
+			else
+			{
+				brief = loadBrief(pfe);
+				rewrite = true;
+			}
+
+			info.push_back(getSaveInfo(*i, lang, brief));
+
+			indexOut[*i]["date"]  = date;
+			indexOut[*i]["size"]  = size;
+			indexOut[*i]["brief"] = brief;
 		}
 		catch (Exception& e)
 		{
@@ -312,21 +350,100 @@ std::vector<SaveInfo> SavedGame::getList( // static.
 		}
 	}
 
+	if (index.IsMap() == true) // keep entries that weren't listed (eg. autoquick) if their files still exist
+	{
+		for (YAML::const_iterator
+				i  = index.begin();
+				i != index.end();
+				++i)
+		{
+			const std::string file (i->first.as<std::string>());
+			const YAML::Node& indexOutConst (indexOut);
+			if (!indexOutConst[file])
+			{
+				if (CrossPlatform::fileExists(Options::getUserFolder() + file) == true)
+					indexOut[file] = i->second;
+				else
+					rewrite = true;
+			}
+		}
+	}
+
+	if (rewrite == true)
+	{
+		std::ofstream ofstr (pfeIndex.c_str());
+		if (ofstr.fail() == false)
+		{
+			YAML::Emitter out;
+			YAML::Node node;
+			node["saves"] = indexOut;
+			out << node;
+			ofstr << out.c_str();
+			ofstr.close();
+		}
+		else
+			Log(LOG_WARNING) << "SavedGame::getList() Failed to write " << SAVE_Index;
+	}
+
 	return info;
 }
 
+/**
+ * Reads only the brief-info section at the front of a save-file.
+ * @note The brief-info is the first YAML-document in a save; reading stops at
+ * the document-marker of the full game-data so the rest of the file is never
+ * parsed. Falls back to a full load if the marker isn't found within
+ * SAVE_BRIEF_MAX bytes.
+ * @param pfe - reference to path+file+extension
+ * @return, the brief-info YAML-node
+ */
+YAML::Node SavedGame::loadBrief(const std::string& pfe) // private/static.
+{
+	std::ifstream ifstr (pfe.c_str(), std::ios::in | std::ios::binary);
+	if (ifstr.fail() == true)
+	{
+		throw Exception("SavedGame::loadBrief() Failed to open " + pfe);
+	}
+
+	std::string
+		brief,
+		line;
+
+	while (brief.size() < SAVE_BRIEF_MAX
+		&& std::getline(ifstr, line))
+	{
+		if (line.compare(0u, 3u, "---") == 0)
+		{
+			if (brief.empty() == false)
+				return YAML::Load(brief);
+
+			continue; // leading document-marker
+		}
+
+		brief += line;
+		brief += '\n';
+	}
+
+	if (ifstr.eof() == true)
+		return YAML::Load(brief);
+
+	ifstr.close();
+	return YAML::LoadFile(pfe);
+}
+
 /**
  * Gets the info of a specified save-file.
- * @param file - reference a save by file w/ extension
- * @param lang - pointer to the loaded Language
+ * @param file	- reference a save by file w/ extension
+ * @param lang	- pointer to the loaded Language
+ * @param doc	- reference to the brief-info YAML-node of the save
  * @return, the SaveInfo (SavedGame.h)
  */
 SaveInfo SavedGame::getSaveInfo( // private/static.
 		const std::string& file,
-		const Language* const lang)
+		const Language* const lang,
+		const YAML::Node& doc)
 {
 	const std::string pfe (Options::getUserFolder() + file);
-	const YAML::Node doc (YAML::LoadFile(pfe));
 
 	SaveInfo info;
 
@@ -412,6 +529,10 @@ void SavedGame::load(
 		Ruleset* const rules) // <- used only to obviate const if loading a battleSave.
 {
 	//Log(LOG_INFO) << "SavedGame::load()";
+	const std::string error (finishSave()); // in case the file is still being written
+	if (error.empty() == false)
+		Log(LOG_ERROR) << error;
+
 	std::string type (Options::getUserFolder() + file);
 	const std::vector<YAML::Node> nodes (YAML::LoadAllFromFile(type));
 	if (nodes.empty() == true)
@@ -659,6 +780,37 @@ void SavedGame::load(
 		_tacticalStats.push_back(tacticalStats);
 	}
 
+	for (std::vector<Base*>::const_iterator // build the diaries' running totals of their tacticals
+			i  = _bases.begin();
+			i != _bases.end();
+			++i)
+	{
+		for (std::vector<Soldier*>::const_iterator
+				j  = (*i)->getSoldiers()->begin();
+				j != (*i)->getSoldiers()->end();
+				++j)
+		{
+			(*j)->getDiary()->tallyTacticals(_tacticalStats);
+		}
+
+		for (std::vector<Transfer*>::const_iterator
+				j  = (*i)->getTransfers()->begin();
+				j != (*i)->getTransfers()->end();
+				++j)
+		{
+			if ((*j)->getSoldier() != nullptr)
+				(*j)->getSoldier()->getDiary()->tallyTacticals(_tacticalStats);
+		}
+	}
+
+	for (std::vector<SoldierDead*>::const_iterator
+			i  = _deadSoldiers.begin();
+			i != _deadSoldiers.end();
+			++i)
+	{
+		(*i)->getDiary()->tallyTacticals(_tacticalStats);
+	}
+
 	if (const YAML::Node& battle = doc["battle"])
 	{
 		Log(LOG_INFO) << "SavedGame: loading tactical";
@@ -675,20 +827,135 @@ void SavedGame::load(
 
 /**
  * Saves a SavedGame's contents to a YAML file.
+ * @note The file is written to a temporary and then renamed so that a crash
+ * mid-write never corrupts an existing save.
  * @param file - reference to a YAML file
  */
 void SavedGame::save(const std::string& file) const
 {
-	const std::string st (Options::getUserFolder() + file);
-	std::ofstream ofstr (st.c_str());
-	if (ofstr.fail() == true)
+	const std::string error (finishSave());
+	if (error.empty() == false)
+		Log(LOG_ERROR) << error;
+
+	SaveSnapshot snap (file);
+	snapshot(&snap);
+	writeSnapshot(&snap);
+
+	if (snap.error.empty() == false)
 	{
-		throw Exception("SavedGame::save() Failed to save " + file);
+		throw Exception(snap.error);
 	}
+}
 
-	YAML::Emitter out;
+/**
+ * Saves a SavedGame's contents to a YAML file on a worker-thread.
+ * @note The game-data is copied on the calling thread so play can continue
+ * while the copy is serialized and written. Any save still being written is
+ * finished first. Call finishSave() to get the result.
+ * @param file - reference to a YAML file
+ */
+void SavedGame::saveAsync(const std::string& file) const
+{
+	const std::string error (finishSave());
+	if (error.empty() == false)
+		Log(LOG_ERROR) << error;
 
-	YAML::Node brief; // the brief-info used for the saves list
+	_saveSnap = new SaveSnapshot(file);
+	snapshot(_saveSnap);
+
+	if ((_saveThread = SDL_CreateThread(		// write the save in a separate thread
+									writeSnapshot,
+									static_cast<void*>(_saveSnap))) == nullptr)
+	{
+		writeSnapshot(static_cast<void*>(_saveSnap));	// if thread can't create just write as usual
+	}
+}
+
+/**
+ * Checks if a save is being written by the worker-thread.
+ * @return, true if a save is in progress
+ */
+bool SavedGame::isSaving() // static.
+{
+	return _saveSnap != nullptr
+		&& _saveSnap->done.load(std::memory_order_acquire) == false;
+}
+
+/**
+ * Waits for the worker-thread to finish writing a save.
+ * @return, the error of the last asynchronous save if any
+ */
+std::string SavedGame::finishSave() // static.
+{
+	if (_saveThread != nullptr)
+	{
+		SDL_WaitThread(_saveThread, nullptr);
+		_saveThread = nullptr;
+	}
+
+	std::string error;
+	if (_saveSnap != nullptr)
+	{
+		error = _saveSnap->error;
+		delete _saveSnap;
+		_saveSnap = nullptr;
+	}
+	return error;
+}
+
+/**
+ * Writes a SaveSnapshot to disk.
+ * @note The YAML is emitted to a temporary file that is flushed to disk and
+ * then renamed over the destination.
+ * @param ptrSnap - pointer to a SaveSnapshot
+ * @return, thread status (0 = ok)
+ */
+int SavedGame::writeSnapshot(void* ptrSnap) // private/static.
+{
+	SaveSnapshot* const snap (static_cast<SaveSnapshot*>(ptrSnap));
+
+	const std::string
+		pfe    (Options::getUserFolder() + snap->file),
+		pfeTry (pfe + SAVE_BakDot);
+
+	try
+	{
+		YAML::Emitter out;
+		out << snap->brief;
+		out << YAML::BeginDoc;
+		out << snap->node;
+
+		std::FILE* const file (std::fopen(pfeTry.c_str(), "wb"));
+		if (file == nullptr)
+			snap->error = "SavedGame::save() Failed to save " + snap->file;
+		else
+		{
+			const bool written (std::fwrite(out.c_str(), 1u, out.size(), file) == out.size()
+							 && CrossPlatform::flushFile(file) == true);
+			std::fclose(file);
+
+			if (written == false)
+				snap->error = "SavedGame::save() Failed to write " + snap->file;
+			else if (CrossPlatform::moveFile(pfeTry, pfe) == false)
+				snap->error = "SavedGame::save() has backed up the file as " + snap->file + SAVE_BakDot;
+		}
+	}
+	catch (YAML::Exception& e)
+	{
+		snap->error = e.what();
+	}
+
+	snap->done.store(true, std::memory_order_release);
+	return 0;
+}
+
+/**
+ * Copies a SavedGame's contents to a SaveSnapshot.
+ * @param snap - pointer to a SaveSnapshot
+ */
+void SavedGame::snapshot(SaveSnapshot* const snap) const // private.
+{
+	YAML::Node& brief (snap->brief); // the brief-info used for the saves list
 
 	brief["label"]   = Language::wstrToUtf8(_label);
 	brief["edition"] = OPENXCOM_VERSION_GIT;
@@ -720,10 +987,7 @@ void SavedGame::save(const std::string& file) const
 	if (_ironman == true)
 		brief["ironman"] = _ironman;
 
-	out << brief;
-	out << YAML::BeginDoc;
-
-	YAML::Node node; // saves the full game-data to the save
+	YAML::Node& node (snap->node); // saves the full game-data to the save
 
 	node["rng"]        = RNG::getSeed();
 	node["difficulty"] = static_cast<int>(_difficulty);
@@ -819,10 +1083,6 @@ void SavedGame::save(const std::string& file) const
 
 	if (_battleSave != nullptr)
 		node["battle"] = _battleSave->save();
-
-	out << node;
-	ofstr << out.c_str();
-	ofstr.close();
 }
 
 /**
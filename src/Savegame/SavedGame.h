@@ -26,6 +26,8 @@
 //#include <time.h>
 //#include <stdint.h>
 
+#include <atomic>		// std::atomic
+
 #include "ResearchGeneral.h"
 #include "Soldier.h"
 
@@ -134,6 +136,28 @@ struct SaveInfo
 	std::vector<std::string> rulesets;
 };
 
+/**
+ * Container for a copy of the game-data that is written to disk by a
+ * worker-thread.
+ */
+struct SaveSnapshot
+{
+	std::atomic<bool> done;	// set true by the worker when the write has finished
+	std::string
+		file,
+		error;			// empty if the write succeeded
+	YAML::Node
+		brief,
+		node;
+
+	/// Builds this struct.
+	explicit SaveSnapshot(const std::string& fileSave)
+		:
+			done (false),
+			file (fileSave)
+	{}
+};
+
 /**
  * Container for soldier-promotion-info.
  */
@@ -228,11 +252,22 @@ private:
 	std::vector<Ufo*>                _ufos;
 	std::vector<Waypoint*>           _waypoints;
 
+	static SDL_Thread* _saveThread;
+	static SaveSnapshot* _saveSnap;
+
 
 	/// Gets the info of a specified save-file.
 	static SaveInfo getSaveInfo(
 			const std::string& file,
-			const Language* const lang);
+			const Language* const lang,
+			const YAML::Node& doc);
+	/// Reads only the brief-info section at the front of a save-file.
+	static YAML::Node loadBrief(const std::string& pfe);
+
+	/// Copies the game-data to a SaveSnapshot.
+	void snapshot(SaveSnapshot* const snap) const;
+	/// Writes a SaveSnapshot to disk.
+	static int writeSnapshot(void* ptrSnap);
 
 	/// Gets the ResearchGeneral corresponding to a specified research-rule.
 //	ResearchGeneral* getResearchGeneral(const RuleResearch* const resRule) const;
@@ -263,7 +298,9 @@ private:
 			SAVE_BakDot,
 			SAVE_TacMission,
 			SAVE_TacTurnBeg,
-			SAVE_TacTurnEnd;
+			SAVE_TacTurnEnd,
+			SAVE_Index;
+		static const size_t SAVE_BRIEF_MAX;
 		static const std::wstring
 			SAVELABEL_Ironballs,
 			SAVELABEL_TacMission,
@@ -286,6 +323,12 @@ private:
 				Ruleset* const rules);
 		/// Saves the SavedGame to YAML.
 		void save(const std::string& file) const;
+		/// Saves the SavedGame to YAML on a worker-thread.
+		void saveAsync(const std::string& file) const;
+		/// Checks if a save is being written by the worker-thread.
+		static bool isSaving();
+		/// Waits for the worker-thread to finish writing a save.
+		static std::string finishSave();
 
 		/// Gets the SavedGame's label.
 		std::wstring getLabel() const;
@@ -19,7 +19,7 @@
 
 #include "SoldierDiary.h"
 
-#include <algorithm>	// find()
+#include <algorithm>	// equal_range(), find(), sort()
 //#include <sstream>	// std::ostringstream
 
 #include "BattleUnitStatistics.h"
@@ -59,7 +59,19 @@ SoldierDiary::SoldierDiary()
 		_mediApplicationsTotal		(0),
 		_revivedUnitTotal			(0),
 		_kia						(0),
-		_mia						(0)
+		_mia						(0),
+		_killTotal					(0),
+		_stunTotal					(0),
+		_pointsTotal				(0),
+		_winTotal					(0),
+		_scoreTotal					(0),
+		_terrorTotal				(0),
+		_nightTotal					(0),
+		_nightTerrorTotal			(0),
+		_baseDefenseTotal			(0),
+		_alienBaseTotal				(0),
+		_importantTotal				(0),
+		_valiantCruxTotal			(0)
 {}
 
 /**
@@ -98,7 +110,27 @@ SoldierDiary::SoldierDiary(const SoldierDiary& copyThat)
 		_mediApplicationsTotal			(copyThat._mediApplicationsTotal),
 		_revivedUnitTotal				(copyThat._revivedUnitTotal),
 		_kia							(copyThat._kia),
-		_mia							(copyThat._mia)
+		_mia							(copyThat._mia),
+		_killTotal						(copyThat._killTotal),
+		_stunTotal						(copyThat._stunTotal),
+		_pointsTotal					(copyThat._pointsTotal),
+		_winTotal						(copyThat._winTotal),
+		_scoreTotal						(copyThat._scoreTotal),
+		_terrorTotal					(copyThat._terrorTotal),
+		_nightTotal						(copyThat._nightTotal),
+		_nightTerrorTotal				(copyThat._nightTerrorTotal),
+		_baseDefenseTotal				(copyThat._baseDefenseTotal),
+		_alienBaseTotal					(copyThat._alienBaseTotal),
+		_importantTotal					(copyThat._importantTotal),
+		_valiantCruxTotal				(copyThat._valiantCruxTotal),
+		_rankTotal						(copyThat._rankTotal),
+		_raceTotal						(copyThat._raceTotal),
+		_weaponTotal					(copyThat._weaponTotal),
+		_hostileTurnTotal				(copyThat._hostileTurnTotal),
+		_regionTotal					(copyThat._regionTotal),
+		_countryTotal					(copyThat._countryTotal),
+		_typeTotal						(copyThat._typeTotal),
+		_ufoTotal						(copyThat._ufoTotal)
 {
 	for (size_t
 			i = 0u;
@@ -207,6 +239,27 @@ SoldierDiary& SoldierDiary::operator =(const SoldierDiary& assignThat)
 		_kia							= assignThat._kia;
 		_mia							= assignThat._mia;
 
+		_killTotal						= assignThat._killTotal;
+		_stunTotal						= assignThat._stunTotal;
+		_pointsTotal					= assignThat._pointsTotal;
+		_winTotal						= assignThat._winTotal;
+		_scoreTotal						= assignThat._scoreTotal;
+		_terrorTotal					= assignThat._terrorTotal;
+		_nightTotal						= assignThat._nightTotal;
+		_nightTerrorTotal				= assignThat._nightTerrorTotal;
+		_baseDefenseTotal				= assignThat._baseDefenseTotal;
+		_alienBaseTotal					= assignThat._alienBaseTotal;
+		_importantTotal					= assignThat._importantTotal;
+		_valiantCruxTotal				= assignThat._valiantCruxTotal;
+		_rankTotal						= assignThat._rankTotal;
+		_raceTotal						= assignThat._raceTotal;
+		_weaponTotal					= assignThat._weaponTotal;
+		_hostileTurnTotal				= assignThat._hostileTurnTotal;
+		_regionTotal					= assignThat._regionTotal;
+		_countryTotal					= assignThat._countryTotal;
+		_typeTotal						= assignThat._typeTotal;
+		_ufoTotal						= assignThat._ufoTotal;
+
 		_tacIdList.clear();
 		for (std::vector<int>::const_iterator
 				i = assignThat._tacIdList.begin();
@@ -223,6 +276,7 @@ SoldierDiary& SoldierDiary::operator =(const SoldierDiary& assignThat)
 		{
 			delete *i;
 		}
+		_solAwards.clear();
 
 		for (std::vector<BattleUnitKill*>::const_iterator
 				i = _killList.begin();
@@ -231,6 +285,7 @@ SoldierDiary& SoldierDiary::operator =(const SoldierDiary& assignThat)
 		{
 			delete *i;
 		}
+		_killList.clear();
 
 		for (size_t
 				i = 0u;
@@ -310,6 +365,7 @@ void SoldierDiary::load(const YAML::Node& node)
 			_killList.push_back(new BattleUnitKill(*i));
 		}
 	}
+	tallyKills();
 
 	_tacIdList						= node["tacIdList"]						.as<std::vector<int>>(_tacIdList);
 	_daysWoundedTotal				= node["daysWoundedTotal"]				.as<int>(_daysWoundedTotal);
@@ -406,6 +462,7 @@ void SoldierDiary::postTactical(
 	{
 		(*i)->setTurn();
 		_killList.push_back(*i); // transfer ownership of BattleUnitKills.
+		addKill(*i);
 	}
 	tacstats->kills.clear();
 
@@ -449,6 +506,139 @@ void SoldierDiary::postTactical(
 		_mia = 1;
 
 	_tacIdList.push_back(tactical->id);
+	addTactical(tactical);
+}
+
+/**
+ * Rebuilds the running totals of the Soldier's tacticals.
+ * @note Called by SavedGame after the TacticalStatistics have loaded; the
+ * totals are kept up to date by postTactical() from then on.
+ * @param tacticals - reference to a vector of pointers to TacticalStatistics
+ */
+void SoldierDiary::tallyTacticals(const std::vector<TacticalStatistics*>& tacticals)
+{
+	_winTotal =
+	_scoreTotal =
+	_terrorTotal =
+	_nightTotal =
+	_nightTerrorTotal =
+	_baseDefenseTotal =
+	_alienBaseTotal =
+	_importantTotal =
+	_valiantCruxTotal = 0;
+
+	_regionTotal.clear();
+	_countryTotal.clear();
+	_typeTotal.clear();
+	_ufoTotal.clear();
+
+	const std::vector<const TacticalStatistics*> soltacs (getDiaryTacticals(tacticals));
+	for (std::vector<const TacticalStatistics*>::const_iterator
+			i = soltacs.begin();
+			i != soltacs.end();
+			++i)
+	{
+		addTactical(*i);
+	}
+}
+
+/**
+ * Adds a tactical to the running totals.
+ * @param tactical - pointer to TacticalStatistics
+ */
+void SoldierDiary::addTactical(const TacticalStatistics* const tactical) // private.
+{
+	++_regionTotal[tactical->region];
+	++_countryTotal[tactical->country];
+	++_typeTotal[tactical->type];
+	++_ufoTotal[tactical->ufo];
+
+	_scoreTotal += tactical->score;
+
+	if (tactical->success == true)
+		++_winTotal;
+
+	if (tactical->valiantCrux == true)
+		++_valiantCruxTotal;
+
+	if (tactical->isBaseDefense() == true)
+		++_baseDefenseTotal;
+
+	if (tactical->isAlienBase() == true)
+		++_alienBaseTotal;
+
+	if (tactical->isUfoMission() == false)
+	{
+		++_importantTotal;
+
+		if (tactical->isBaseDefense() == false
+			&& tactical->isAlienBase() == false)
+		{
+			++_terrorTotal;
+		}
+	}
+
+	if (tactical->shade >= TacticalStatistics::NIGHT_SHADE
+		&& tactical->isBaseDefense() == false
+		&& tactical->isAlienBase() == false)
+	{
+		++_nightTotal;
+
+		if (tactical->isUfoMission() == false)
+			++_nightTerrorTotal;
+	}
+}
+
+/**
+ * Adds a kill to the running totals.
+ * @param kill - pointer to a BattleUnitKill
+ */
+void SoldierDiary::addKill(const BattleUnitKill* const kill) // private.
+{
+	++_rankTotal[kill->_rank];
+	++_raceTotal[kill->_race];
+	++_weaponTotal[kill->_weapon];
+
+	_pointsTotal += kill->_points;
+
+	if (kill->_faction == FACTION_HOSTILE)
+	{
+		switch (kill->_status)
+		{
+			case STATUS_DEAD:
+				++_killTotal;
+				break;
+
+			case STATUS_UNCONSCIOUS:
+				++_stunTotal;
+		}
+	}
+
+	if (kill->hostileTurn() == true)
+		++_hostileTurnTotal[kill->_weapon];
+}
+
+/**
+ * Rebuilds the running totals of the kill-list.
+ */
+void SoldierDiary::tallyKills() // private.
+{
+	_killTotal =
+	_stunTotal =
+	_pointsTotal = 0;
+
+	_rankTotal.clear();
+	_raceTotal.clear();
+	_weaponTotal.clear();
+	_hostileTurnTotal.clear();
+
+	for (std::vector<BattleUnitKill*>::const_iterator
+			i = _killList.begin();
+			i != _killList.end();
+			++i)
+	{
+		addKill(*i);
+	}
 }
 
 /**
@@ -463,13 +653,10 @@ std::vector<SoldierAward*>& SoldierDiary::getSoldierAwards()
 /**
  * Updates the owner's SoldierAwards.
  * @note May God help anyone who has to address this further!!!!
- * @param rules		- pointer to the Ruleset
- * @param tacticals	- reference to a vector of pointers to TacticalStatistics
+ * @param rules - pointer to the Ruleset
  * @return, true if an award is awarded
  */
-bool SoldierDiary::updateAwards(
-		const Ruleset* const rules,
-		const std::vector<TacticalStatistics*>& tacticals)
+bool SoldierDiary::updateAwards(const Ruleset* const rules)
 {
 	//Log(LOG_INFO) << "";
 	//Log(LOG_INFO) << "SoldierDiary::updateAwards()";
@@ -481,7 +668,8 @@ bool SoldierDiary::updateAwards(
 	std::string criteriaType;
 	int val;
 
-	std::map<std::string, int> solTotal;
+	const std::map<std::string, int> totals (tallyTotals(rules)); // the stats don't change while Awards are granted
+	const std::map<std::string, int>* solTotal;
 	int threshold;
 
 	const std::vector<std::vector<std::pair<int, std::vector<std::string>>>>* killCriteria;
@@ -500,6 +688,21 @@ bool SoldierDiary::updateAwards(
 		* weaponRule,
 		* loadRule;
 
+	static const std::string
+		bType_array[BATS] // these entries shall correspond to BattleType enum (RuleItem.h)
+		{
+			"BT_NONE",		"BT_FIREARM",		"BT_AMMO",		"BT_MELEE",
+			"BT_GRENADE",	"BT_PROXYGRENADE",	"BT_MEDIKIT",	"BT_SCANNER",
+			"BT_MINDPROBE",	"BT_PSIAMP",		"BT_FLARE",		"BT_CORPSE",
+			"BT_FUEL",		"BT_END"
+		},
+		dType_array[DATS] // these entries shall correspond to DamageType enum (RuleItem.h)
+		{
+			"DT_NONE",		"DT_AP",			"DT_IN",		"DT_HE",
+			"DT_LASER",		"DT_PLASMA",		"DT_STUN",		"DT_MELEE",
+			"DT_ACID",		"DT_SMOKE",			"DT_END"
+		};
+
 //	int iter (1); // debug.
 	const std::map<std::string, const RuleAward*>& allAwards (rules->getAwardsList()); // loop over all RuleAwards ->
 	for (std::map<std::string, const RuleAward*>::const_iterator
@@ -558,37 +761,10 @@ bool SoldierDiary::updateAwards(
 		val = levels.at(levelRequired["noQual"]); // use the "noQual" entry assigned above just to find out what the highest value is.
 
 		// the following criteria have no qualifiers so only "noQual" will ever be compared
-		if (   (criteriaType == "totalKills"				&& getKillTotal() < val)
-			|| (criteriaType == "totalMissions"				&& static_cast<int>(_tacIdList.size()) < val)
-			|| (criteriaType == "totalWins"					&& getWinTotal(tacticals) < val)
-			|| (criteriaType == "totalScore"				&& getScoreTotal(tacticals) < val)
-			|| (criteriaType == "totalPoints"				&& getPointsTotal() < val)
-			|| (criteriaType == "totalStuns"				&& getStunTotal() < val)
-			|| (criteriaType == "totalBaseDefenseMissions"	&& getBaseDefenseMissionTotal(tacticals) < val)
-			|| (criteriaType == "totalTerrorMissions"		&& getTerrorMissionTotal(tacticals) < val)
-			|| (criteriaType == "totalNightMissions"		&& getNightMissionTotal(tacticals) < val)
-			|| (criteriaType == "totalNightTerrorMissions"	&& getNightTerrorMissionTotal(tacticals) < val)
-			|| (criteriaType == "totalMonthlyService"		&& _monthsService < val)
-			|| (criteriaType == "totalFellUnconscious"		&& _unconsciousTotal < val)
-			|| (criteriaType == "totalShotAt10Times"		&& _shotAtCounter10in1Mission < val)
-			|| (criteriaType == "totalHit5Times"			&& _hitCounter5in1Mission < val)
-			|| (criteriaType == "totalFriendlyFired"		&& (_totalShotByFriendlyCounter < val || _kia == 1 || _mia == 1)) // didn't survive ...... NOTE: This screws up when refreshing Awards.
-			|| (criteriaType == "totalLoneSurvivor"			&& _loneSurvivorTotal < val)
-			|| (criteriaType == "totalIronMan"				&& _ironManTotal < val)
-			|| (criteriaType == "totalImportantMissions"	&& getImportantMissionTotal(tacticals) < val)
-			|| (criteriaType == "totalLongDistanceHits"		&& _longDistanceHitCounterTotal < val)
-			|| (criteriaType == "totalLowAccuracyHits"		&& _lowAccuracyHitCounterTotal < val)
-			|| (criteriaType == "totalReactionFire"			&& getReactionFireKillTotal(rules) < val)
-			|| (criteriaType == "totalTimesWounded"			&& _timesWoundedTotal < val)
-			|| (criteriaType == "totalDaysWounded"			&& _daysWoundedTotal < val)
-			|| (criteriaType == "totalValientCrux"			&& getValiantCruxTotal(tacticals) < val)
-			|| (criteriaType == "totalTrapKills"			&& getTrapKillTotal(rules) < val)
-			|| (criteriaType == "totalAlienBaseAssaults"	&& getAlienBaseAssaultTotal(tacticals) < val)
-			|| (criteriaType == "totalAllAliensKilled"		&& _allAliensKilledTotal < val)
-			|| (criteriaType == "totalMediApplications"		&& _mediApplicationsTotal < val)
-			|| (criteriaType == "totalRevives"				&& _revivedUnitTotal < val)
-			|| (criteriaType == "totalIsDead"				&& _kia < val)
-			|| (criteriaType == "totalIsMissing"			&& _mia < val))
+		const std::map<std::string, int>::const_iterator total (totals.find(criteriaType));
+		if (total != totals.end()
+			&& (total->second < val
+				|| (criteriaType == "totalFriendlyFired" && (_kia == 1 || _mia == 1)))) // didn't survive ...... NOTE: This screws up when refreshing Awards.
 		{
 			//Log(LOG_INFO) << ". . . no Total Award - go to next Award";
 //			iter = 0; // debug.
@@ -606,14 +782,14 @@ bool SoldierDiary::updateAwards(
 		{
 			//Log(LOG_INFO) << ". . . try Award w/ weapon,region,race,rank";
 
-			if		(criteriaType == "totalKillsWeapon") solTotal = getWeaponTotal();
-			else if	(criteriaType == "totalKillsRegion") solTotal = getRegionTotal(tacticals);
-			else if	(criteriaType == "totalKillsByRace") solTotal = getAlienRaceTotal();
-			else if	(criteriaType == "totalKillsByRank") solTotal = getAlienRankTotal();
+			if		(criteriaType == "totalKillsWeapon") solTotal = &_weaponTotal;
+			else if	(criteriaType == "totalKillsRegion") solTotal = &_regionTotal;
+			else if	(criteriaType == "totalKillsByRace") solTotal = &_raceTotal;
+			else									solTotal = &_rankTotal;
 
 			for (std::map<std::string, int>::const_iterator			// loop over 'solTotal' and compare results with requiredLevels.
-					k = solTotal.begin();
-					k != solTotal.end();
+					k = solTotal->begin();
+					k != solTotal->end();
 					++k)
 			{
 				//Log(LOG_INFO) << ". . . . " << (k->first) << " - " << (k->second);
@@ -698,6 +874,23 @@ bool SoldierDiary::updateAwards(
 					//Log(LOG_INFO) << ". . . . . (init) resync FALSE";
 					//Log(LOG_INFO) << ". . . . . (init) iterCur/iterPre -1";
 
+					std::vector<std::pair<size_t, size_t>> detailTypes; // the BattleType and DamageType that each detail names if any
+					for (std::vector<std::string>::const_iterator
+							detail = andCriteria->second.begin();
+							detail != andCriteria->second.end();
+							++detail)
+					{
+						for (bType = 0u; bType != BATS - 1u; ++bType)
+							if (bType_array[bType] == *detail)
+								break;
+
+						for (dType = 0u; dType != DATS - 1u; ++dType)
+							if (dType_array[dType] == *detail)
+								break;
+
+						detailTypes.push_back(std::make_pair(bType, dType));
+					}
+
 					std::vector<int> ids;
 					int
 						id         (-1),
@@ -819,6 +1012,9 @@ bool SoldierDiary::updateAwards(
 							continue;
 						}
 
+						weaponRule	= rules->getItemRule((*killstat)->_weapon);
+						loadRule	= rules->getItemRule((*killstat)->_load);
+
 						found = true;
 						for (std::vector<std::string>::const_iterator // loop over the DETAILs of the andCriteria vector ->
 								detail = andCriteria->second.begin();
@@ -827,31 +1023,8 @@ bool SoldierDiary::updateAwards(
 						{
 							//Log(LOG_INFO) << "";
 							//Log(LOG_INFO) << ". . . . . . . iter DETAIL - " << (*detail);
-							static const std::string
-								bType_array[BATS] // these entries shall correspond to BattleType enum (RuleItem.h)
-								{
-									"BT_NONE",		"BT_FIREARM",		"BT_AMMO",		"BT_MELEE",
-									"BT_GRENADE",	"BT_PROXYGRENADE",	"BT_MEDIKIT",	"BT_SCANNER",
-									"BT_MINDPROBE",	"BT_PSIAMP",		"BT_FLARE",		"BT_CORPSE",
-									"BT_FUEL",		"BT_END"
-								},
-								dType_array[DATS] // these entries shall correspond to DamageType enum (RuleItem.h)
-								{
-									"DT_NONE",		"DT_AP",			"DT_IN",		"DT_HE",
-									"DT_LASER",		"DT_PLASMA",		"DT_STUN",		"DT_MELEE",
-									"DT_ACID",		"DT_SMOKE",			"DT_END"
-								};
-
-							for (bType = 0u; bType != BATS - 1u; ++bType)
-								if (bType_array[bType] == *detail)	//Log(LOG_INFO) << ". . . . . . . . iter bType";
-									break;							//Log(LOG_INFO) << ". . . . . . . . bType= " << (*detail);
-
-							for (dType = 0u; dType != DATS - 1u; ++dType)
-								if (dType_array[dType] == *detail)	//Log(LOG_INFO) << ". . . . . . . . iter dType";
-									break;							//Log(LOG_INFO) << ". . . . . . . . dType= " << (*detail);
-
-							weaponRule	= rules->getItemRule((*killstat)->_weapon);
-							loadRule	= rules->getItemRule((*killstat)->_load);
+							bType = detailTypes[static_cast<size_t>(detail - andCriteria->second.begin())].first;
+							dType = detailTypes[static_cast<size_t>(detail - andCriteria->second.begin())].second;
 
 							if (   (*killstat)->_rank	!= *detail // if every killstat mis-matches the (single) Detail break and try the next andCriteria.
 								&& (*killstat)->_race	!= *detail
@@ -1026,54 +1199,109 @@ bool SoldierDiary::updateAwards(
 							//														&& loadRule->getDamageType() != static_cast<DamageType>(dType)));
 
 /**
- * Gets list of kills by rank.
- * @return, map of alien-ranks to qty killed
+ * Tallies the totals that Awards without qualifiers are granted for.
+ * @note The totals are read from the running totals once per call to
+ * updateAwards() and mapped by award-criteria.
+ * @param rules - pointer to the Ruleset
+ * @return, map of award-criteria to the Soldier's totals
  */
-std::map<std::string, int> SoldierDiary::getAlienRankTotal() const
+std::map<std::string, int> SoldierDiary::tallyTotals(const Ruleset* const rules) const // private.
 {
-	std::map<std::string, int> ret;
-	for(std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
+	std::map<std::string, int> totals;
+
+	totals["totalKills"]				= getKillTotal();
+	totals["totalMissions"]				= static_cast<int>(_tacIdList.size());
+	totals["totalWins"]					= getWinTotal();
+	totals["totalScore"]				= getScoreTotal();
+	totals["totalPoints"]				= getPointsTotal();
+	totals["totalStuns"]				= getStunTotal();
+	totals["totalBaseDefenseMissions"]	= getBaseDefenseMissionTotal();
+	totals["totalTerrorMissions"]		= getTerrorMissionTotal();
+	totals["totalNightMissions"]		= getNightMissionTotal();
+	totals["totalNightTerrorMissions"]	= getNightTerrorMissionTotal();
+	totals["totalMonthlyService"]		= _monthsService;
+	totals["totalFellUnconscious"]		= _unconsciousTotal;
+	totals["totalShotAt10Times"]		= _shotAtCounter10in1Mission;
+	totals["totalHit5Times"]			= _hitCounter5in1Mission;
+	totals["totalFriendlyFired"]		= _totalShotByFriendlyCounter;
+	totals["totalLoneSurvivor"]			= _loneSurvivorTotal;
+	totals["totalIronMan"]				= _ironManTotal;
+	totals["totalImportantMissions"]	= getImportantMissionTotal();
+	totals["totalLongDistanceHits"]		= _longDistanceHitCounterTotal;
+	totals["totalLowAccuracyHits"]		= _lowAccuracyHitCounterTotal;
+	totals["totalReactionFire"]			= getReactionFireKillTotal(rules);
+	totals["totalTimesWounded"]			= _timesWoundedTotal;
+	totals["totalDaysWounded"]			= _daysWoundedTotal;
+	totals["totalValientCrux"]			= getValiantCruxTotal();
+	totals["totalTrapKills"]			= getTrapKillTotal(rules);
+	totals["totalAlienBaseAssaults"]	= getAlienBaseAssaultTotal();
+	totals["totalAllAliensKilled"]		= _allAliensKilledTotal;
+	totals["totalMediApplications"]		= _mediApplicationsTotal;
+	totals["totalRevives"]				= _revivedUnitTotal;
+	totals["totalIsDead"]				= _kia;
+	totals["totalIsMissing"]			= _mia;
+
+	return totals;
+}
+
+/**
+ * Gets the TacticalStatistics of the tacticals that the Soldier took part in.
+ * @note The tactical-IDs are sorted and searched so the cost goes with the
+ * quantity of tacticals instead of tacticals times the Soldier's missions.
+ * @param tacticals - reference to a vector of pointers to TacticalStatistics
+ * @return, vector of pointers to the Soldier's TacticalStatistics
+ */
+std::vector<const TacticalStatistics*> SoldierDiary::getDiaryTacticals(const std::vector<TacticalStatistics*>& tacticals) const // private.
+{
+	std::vector<int> ids (_tacIdList);
+	std::sort(ids.begin(), ids.end());
+
+	std::vector<const TacticalStatistics*> ret;
+	for (std::vector<TacticalStatistics*>::const_iterator
+			i = tacticals.begin();
+			i != tacticals.end();
 			++i)
 	{
-		++ret[(*i)->_rank];
+		const std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator> range (std::equal_range(
+																												ids.begin(),
+																												ids.end(),
+																												(*i)->id));
+		for (std::vector<int>::const_iterator
+				j = range.first;
+				j != range.second;
+				++j)
+		{
+			ret.push_back(*i);
+		}
 	}
 	return ret;
 }
 
+/**
+ * Gets list of kills by rank.
+ * @return, map of alien-ranks to qty killed
+ */
+const std::map<std::string, int>& SoldierDiary::getAlienRankTotal() const
+{
+	return _rankTotal;
+}
+
 /**
  * Gets list of kills by race.
  * @return, map of alien-races to qty killed
  */
-std::map<std::string, int> SoldierDiary::getAlienRaceTotal() const
+const std::map<std::string, int>& SoldierDiary::getAlienRaceTotal() const
 {
-	std::map<std::string, int> ret;
-	for(std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
-			++i)
-	{
-		++ret[(*i)->_race];
-	}
-	return ret;
+	return _raceTotal;
 }
 
 /**
  * Gets list of kills by weapon.
  * @return, map of weapons to qty killed
  */
-std::map<std::string, int> SoldierDiary::getWeaponTotal() const
+const std::map<std::string, int>& SoldierDiary::getWeaponTotal() const
 {
-	std::map<std::string, int> ret;
-	for(std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
-			++i)
-	{
-		++ret[(*i)->_weapon];
-	}
-	return ret;
+	return _weaponTotal;
 }
 
 /**
@@ -1095,127 +1323,47 @@ std::map<std::string, int> SoldierDiary::getLoadTotal() const
 
 /**
  * Gets a list of quantities of tacticals done by Region-type.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, map of regions to tacticals done there
  */
-std::map<std::string, int> SoldierDiary::getRegionTotal(const std::vector<TacticalStatistics*>& tacticals) const
+const std::map<std::string, int>& SoldierDiary::getRegionTotal() const
 {
-	std::map<std::string, int> ret;
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id)
-				++ret[(*i)->region];
-		}
-	}
-	return ret;
+	return _regionTotal;
 }
 
 /**
  * Gets a list of quantities of tacticals done by Country-type.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, map of countries to tacticals done there
  */
-std::map<std::string, int> SoldierDiary::getCountryTotal(const std::vector<TacticalStatistics*>& tacticals) const
+const std::map<std::string, int>& SoldierDiary::getCountryTotal() const
 {
-	std::map<std::string, int> ret;
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id)
-				++ret[(*i)->country];
-		}
-	}
-	return ret;
+	return _countryTotal;
 }
 
 /**
  * Gets a list of quantities of tacticals done by Tactical-type.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, map of mission-types to qty of
  */
-std::map<std::string, int> SoldierDiary::getTypeTotal(const std::vector<TacticalStatistics*>& tacticals) const
+const std::map<std::string, int>& SoldierDiary::getTypeTotal() const
 {
-	std::map<std::string, int> ret;
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id)
-				++ret[(*i)->type];
-		}
-	}
-	return ret;
+	return _typeTotal;
 }
 
 /**
  * Gets a list of quantities of tacticals done by UFO-type.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, map of UFO-types to qty of
  */
-std::map<std::string, int> SoldierDiary::getUfoTotal(const std::vector<TacticalStatistics*>& tacticals) const
+const std::map<std::string, int>& SoldierDiary::getUfoTotal() const
 {
-	std::map<std::string, int> ret;
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id)
-				++ret[(*i)->ufo];
-		}
-	}
-	return ret;
+	return _ufoTotal;
 }
 
 /**
  * Gets the current total-score.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, score of all tacticals engaged
  */
-int SoldierDiary::getScoreTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getScoreTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id)
-				ret += (*i)->score;
-		}
-	}
-	return ret;
+	return _scoreTotal;
 }
 
 /**
@@ -1224,15 +1372,7 @@ int SoldierDiary::getScoreTotal(const std::vector<TacticalStatistics*>& tactical
  */
 int SoldierDiary::getPointsTotal() const
 {
-	int ret (0);
-	for (std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
-			++i)
-	{
-		ret += (*i)->_points;
-	}
-	return ret;
+	return _pointsTotal;
 }
 
 /**
@@ -1241,16 +1381,7 @@ int SoldierDiary::getPointsTotal() const
  */
 int SoldierDiary::getKillTotal() const
 {
-	int ret (0);
-	for (std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
-			++i)
-	{
-		if ((*i)->_status == STATUS_DEAD && (*i)->_faction == FACTION_HOSTILE)
-			++ret;
-	}
-	return ret;
+	return _killTotal;
 }
 
 /**
@@ -1259,16 +1390,7 @@ int SoldierDiary::getKillTotal() const
  */
 int SoldierDiary::getStunTotal() const
 {
-	int ret (0);
-	for (std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
-			++i)
-	{
-		if ((*i)->_status == STATUS_UNCONSCIOUS && (*i)->_faction == FACTION_HOSTILE)
-			++ret;
-	}
-	return ret;
+	return _stunTotal;
 }
 
 /**
@@ -1282,27 +1404,11 @@ size_t SoldierDiary::getMissionTotal() const
 
 /**
  * Gets the current total quantity of successful tacticals.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, qty of successful tacticals
  */
-int SoldierDiary::getWinTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getWinTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id && (*i)->success)
-				++ret;
-		}
-	}
-	return ret;
+	return _winTotal;
 }
 
 /**
@@ -1369,23 +1475,20 @@ int SoldierDiary::getTrapKillTotal(const Ruleset* const rules) const
 	int ret (0);
 
 	const RuleItem* itRule;
-	for (std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
+	for (std::map<std::string, int>::const_iterator
+			i = _hostileTurnTotal.begin();
+			i != _hostileTurnTotal.end();
 			++i)
 	{
-		if ((*i)->hostileTurn() == true)
+		if ((itRule = rules->getItemRule(i->first)) == nullptr)
+			ret += i->second;
+		else
 		{
-			if ((itRule = rules->getItemRule((*i)->_weapon)) == nullptr)
-				++ret;
-			else
+			switch (itRule->getBattleType())
 			{
-				switch (itRule->getBattleType())
-				{
-					case BT_GRENADE:
-					case BT_PROXYGRENADE:
-						++ret;
-				}
+				case BT_GRENADE:
+				case BT_PROXYGRENADE:
+					ret += i->second;
 			}
 		}
 	}
@@ -1397,233 +1500,93 @@ int SoldierDiary::getTrapKillTotal(const Ruleset* const rules) const
  * @param rules - pointer to the Ruleset
  * @return, total reaction-fire kills
  */
- int SoldierDiary::getReactionFireKillTotal(const Ruleset* const rules) const
- {
+int SoldierDiary::getReactionFireKillTotal(const Ruleset* const rules) const
+{
 	int ret (0);
 
 	const RuleItem* itRule;
-	for (std::vector<BattleUnitKill*>::const_iterator
-			i = _killList.begin();
-			i != _killList.end();
+	for (std::map<std::string, int>::const_iterator
+			i = _hostileTurnTotal.begin();
+			i != _hostileTurnTotal.end();
 			++i)
 	{
-		if ((*i)->hostileTurn() == true)
+		if ((itRule = rules->getItemRule(i->first)) != nullptr)
 		{
-			if ((itRule = rules->getItemRule((*i)->_weapon)) != nullptr)
+			switch (itRule->getBattleType())
 			{
-				switch (itRule->getBattleType())
-				{
-					case BT_GRENADE:
-					case BT_PROXYGRENADE:
-						break;
+				case BT_GRENADE:
+				case BT_PROXYGRENADE:
+					break;
 
-					default:
-						++ret;
-				}
+				default:
+					ret += i->second;
 			}
 		}
 	}
 	return ret;
- }
+}
 
 /**
  * Gets the total of terror tacticals.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, total terror missions
  */
-int SoldierDiary::getTerrorMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getTerrorMissionTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id
-				&& (*i)->isBaseDefense() == false
-				&& (*i)->isAlienBase() == false
-				&& (*i)->isUfoMission() == false)
-			{
-				++ret;
-			}
-		}
-	}
-	return ret;
+	return _terrorTotal;
 }
 
 /**
  * Gets the total of night tacticals.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, total night missions
  */
-int SoldierDiary::getNightMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getNightMissionTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id
-				&& (*i)->shade >= TacticalStatistics::NIGHT_SHADE
-				&& (*i)->isBaseDefense() == false
-				&& (*i)->isAlienBase() == false)
-			{
-				++ret;
-			}
-		}
-	}
-	return ret;
+	return _nightTotal;
 }
 
 /**
  * Gets the total of night terror tacticals.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, total night terror missions
  */
-int SoldierDiary::getNightTerrorMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getNightTerrorMissionTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id
-				&& (*i)->shade >= TacticalStatistics::NIGHT_SHADE
-				&& (*i)->isBaseDefense() == false
-				&& (*i)->isAlienBase() == false
-				&& (*i)->isUfoMission() == false)
-			{
-				++ret;
-			}
-		}
-	}
-	return ret;
+	return _nightTerrorTotal;
 }
 
 /**
  * Gets the total of base defense tacticals.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, total base defense tacticals
  */
-int SoldierDiary::getBaseDefenseMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getBaseDefenseMissionTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id
-				&& (*i)->isBaseDefense() == true)
-			{
-				++ret;
-			}
-		}
-	}
-	return ret;
+	return _baseDefenseTotal;
 }
 
 /**
  * Gets the total of alien base assaults.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, total alien base assaults
  */
-int SoldierDiary::getAlienBaseAssaultTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getAlienBaseAssaultTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id
-				&& (*i)->isAlienBase() == true)
-			{
-				++ret;
-			}
-		}
-	}
-	return ret;
+	return _alienBaseTotal;
 }
 
 /**
  * Gets the total of important tacticals.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, total important missions
  */
-int SoldierDiary::getImportantMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getImportantMissionTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id
-				&& (*i)->isUfoMission() == false)
-			{
-				++ret;
-			}
-		}
-	}
-	return ret;
+	return _importantTotal;
 }
 
 /**
  * Gets the Valient Crux total.
- * @param tacticals - reference to a vector of pointers to TacticalStatistics
  * @return, total valiant crutches
  */
-int SoldierDiary::getValiantCruxTotal(const std::vector<TacticalStatistics*>& tacticals) const
+int SoldierDiary::getValiantCruxTotal() const
 {
-	int ret (0);
-	for (std::vector<TacticalStatistics*>::const_iterator
-			i = tacticals.begin();
-			i != tacticals.end();
-			++i)
-	{
-		for (std::vector<int>::const_iterator
-				j = _tacIdList.begin();
-				j != _tacIdList.end();
-				++j)
-		{
-			if (*j == (*i)->id && (*i)->valiantCrux == true)
-				++ret;
-		}
-	}
-	return ret;
+	return _valiantCruxTotal;
 }
 
 /**
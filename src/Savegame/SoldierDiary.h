@@ -118,12 +118,47 @@ private:
 		_mediApplicationsTotal,
 		_revivedUnitTotal,
 		_kia,
-		_mia;
+		_mia,
+
+		_killTotal,			// running totals of the kill-list ->
+		_stunTotal,
+		_pointsTotal,
+		_winTotal,			// running totals of the Soldier's tacticals ->
+		_scoreTotal,
+		_terrorTotal,
+		_nightTotal,
+		_nightTerrorTotal,
+		_baseDefenseTotal,
+		_alienBaseTotal,
+		_importantTotal,
+		_valiantCruxTotal;
+
+	std::map<std::string, int>
+		_rankTotal,
+		_raceTotal,
+		_weaponTotal,
+		_hostileTurnTotal,	// kills on a hostile turn by weapon
+		_regionTotal,
+		_countryTotal,
+		_typeTotal,
+		_ufoTotal;
 
 	std::vector<int> _tacIdList;
 	std::vector<SoldierAward*> _solAwards;
 	std::vector<BattleUnitKill*> _killList;
 
+	/// Adds a kill to the running totals.
+	void addKill(const BattleUnitKill* const kill);
+	/// Adds a tactical to the running totals.
+	void addTactical(const TacticalStatistics* const tactical);
+	/// Rebuilds the running totals of the kill-list.
+	void tallyKills();
+
+	/// Tallies the totals that Awards without qualifiers are granted for.
+	std::map<std::string, int> tallyTotals(const Ruleset* const rules) const;
+	/// Gets the TacticalStatistics of the tacticals that the Soldier took part in.
+	std::vector<const TacticalStatistics*> getDiaryTacticals(const std::vector<TacticalStatistics*>& tacticals) const;
+
 
 	public:
 		/// Creates a SoldierDiary.
@@ -147,35 +182,35 @@ private:
 		void postTactical(
 				BattleUnitStatistics* const tacstats,
 				const TacticalStatistics* const tactical);
+		/// Rebuilds the running totals of the Soldier's tacticals.
+		void tallyTacticals(const std::vector<TacticalStatistics*>& tacticals);
 
 		/// Accesses the SoldierAwards currently in the SoldierDiary.
 		std::vector<SoldierAward*>& getSoldierAwards();
 
 		/// Manages SoldierAwards and returns true if a medal is awarded.
-		bool updateAwards(
-				const Ruleset* const rules,
-				const std::vector<TacticalStatistics*>& tacticals);
+		bool updateAwards(const Ruleset* const rules);
 
 		/// Gets the list of kills, mapped by rank.
-		std::map<std::string, int> getAlienRankTotal() const;
+		const std::map<std::string, int>& getAlienRankTotal() const;
 		/// Gets the list of kills, mapped by race.
-		std::map<std::string, int> getAlienRaceTotal() const;
+		const std::map<std::string, int>& getAlienRaceTotal() const;
 		/// Gets the list of kills, mapped by weapon used.
-		std::map<std::string, int> getWeaponTotal() const;
+		const std::map<std::string, int>& getWeaponTotal() const;
 		/// Gets the list of kills, mapped by weapon load used.
 //		std::map<std::string, int> getLoadTotal() const;
 
 		/// Gets the quantities of missions mapped by Region.
-		std::map<std::string, int> getRegionTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		const std::map<std::string, int>& getRegionTotal() const;
 		/// Gets the quantities of missions mapped by Country.
-		std::map<std::string, int> getCountryTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		const std::map<std::string, int>& getCountryTotal() const;
 		/// Gets the quantities of missions mapped by tactical-type.
-		std::map<std::string, int> getTypeTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		const std::map<std::string, int>& getTypeTotal() const;
 		/// Gets the quantities of missions mapped by UFO-type.
-		std::map<std::string, int> getUfoTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		const std::map<std::string, int>& getUfoTotal() const;
 
 		/// Gets the total score.
-		int getScoreTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getScoreTotal() const;
 		/// Gets the total point-value of aLiens killed or stunned.
 		int getPointsTotal() const;
 		/// Gets the total quantity of kills.
@@ -185,7 +220,7 @@ private:
 		/// Gets the total quantity of missions.
 		size_t getMissionTotal() const;
 		/// Gets the total quantity of wins.
-		int getWinTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getWinTotal() const;
 		/// Gets the total quantity of days wounded.
 		int getDaysWoundedTotal() const;
 		/// Gets whether soldier died or went missing.
@@ -201,19 +236,19 @@ private:
 		/// Gets reaction kill total.
 		int getReactionFireKillTotal(const Ruleset* const rules) const;
 		/// Gets the total of terror missions.
-		int getTerrorMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getTerrorMissionTotal() const;
 		/// Gets the total of night missions.
-		int getNightMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getNightMissionTotal() const;
 		/// Gets the total of night terror missions.
-		int getNightTerrorMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getNightTerrorMissionTotal() const;
 		/// Gets the total of base defense missions.
-		int getBaseDefenseMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getBaseDefenseMissionTotal() const;
 		/// Gets the total of alien base assaults.
-		int getAlienBaseAssaultTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getAlienBaseAssaultTotal() const;
 		/// Gets the total of important missions.
-		int getImportantMissionTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getImportantMissionTotal() const;
 		/// Gets the Valient Crux total.
-		int getValiantCruxTotal(const std::vector<TacticalStatistics*>& tacticals) const;
+		int getValiantCruxTotal() const;
 
 		/// Increments the Soldier's service-time.
 		void addMonthlyService();
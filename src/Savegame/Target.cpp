@@ -19,11 +19,15 @@
 
 #include "Target.h"
 
+#include <limits>	// std::numeric_limits
+
 #include "../fmath.h"
 
 #include "Craft.h"
 #include "SerializationHelper.h"
 
+#include "../Geoscape/GeoscapeState.h" // radius_earth
+
 
 namespace OpenXcom
 {
@@ -48,7 +52,10 @@ Target::Target()
 	:
 		_id(0),
 		_lon(0.),
-		_lat(0.)
+		_lat(0.),
+		_latTrig(std::numeric_limits<double>::quiet_NaN()),
+		_latSin(0.),
+		_latCos(1.)
 {}
 
 /**
@@ -167,6 +174,27 @@ void Target::setLatitude(double lat)
 	}
 }
 
+/**
+ * Gets the sine and cosine of the latitude coordinate of this Target.
+ * @note The values are cached until the latitude changes since the Geoscape
+ * takes the trig of the same coordinates several times per step.
+ * @param latSin - reference to the sine
+ * @param latCos - reference to the cosine
+ */
+void Target::getLatitudeTrig(
+		double& latSin,
+		double& latCos) const
+{
+	if (_lat != _latTrig) // NOTE: Also true while '_latTrig' is NaN.
+	{
+		_latTrig = _lat;
+		_latSin = std::sin(_lat);
+		_latCos = std::cos(_lat);
+	}
+	latSin = _latSin;
+	latCos = _latCos;
+}
+
 /**
  * Gets the list of MovingTargets currently targeting this Target.
  * @return, pointer to a vector of pointers to MovingTargets
@@ -194,12 +222,37 @@ double Target::getDistance(const Target* const target) const
 	}
 	// else the formula below returns NaN
 
+	double
+		latSin,
+		latCos,
+		latSinTarget,
+		latCosTarget;
+	getLatitudeTrig(latSin, latCos);
+	target->getLatitudeTrig(latSinTarget, latCosTarget);
+
 	return std::acos(
-				  std::cos(_lat)
-				* std::cos(latTarget)
+				  latCos
+				* latCosTarget
 				* std::cos(lonTarget - _lon)
-				+ std::sin(_lat)
-				* std::sin(latTarget));
+				+ latSin
+				* latSinTarget);
+}
+
+/**
+ * Checks if another Target is certainly farther than a specified distance.
+ * @note This is a cheap test without trig for pruning range-checks: the
+ * great-circle-distance between two points is never less than the difference
+ * of their latitudes. A margin of 1 nautical mile keeps rounding-errors from
+ * pruning a Target that getDistance() would find to be just inside range.
+ * @param target	- pointer to other target
+ * @param range		- distance in nautical miles
+ * @return, true if the other Target is out of range
+ */
+bool Target::isBeyond(
+		const Target* const target,
+		double range) const
+{
+	return std::fabs(target->getLatitude() - _lat) * radius_earth > range + 1.;
 }
 
 }
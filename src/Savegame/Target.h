@@ -47,6 +47,11 @@ protected:
 
 	std::vector<Target*> _targeters;
 
+	mutable double
+		_latTrig,	// the latitude that '_latSin' and '_latCos' were taken of
+		_latSin,
+		_latCos;
+
 	/// Creates a Target.
 	Target();
 
@@ -77,6 +82,10 @@ protected:
 		double getLatitude() const;
 		/// Sets the Target's latitude.
 		void setLatitude(double lat);
+		/// Gets the sine and cosine of the Target's latitude.
+		void getLatitudeTrig(
+				double& latSin,
+				double& latCos) const;
 
 		/// Gets the Target's label.
 		virtual std::wstring getLabel(
@@ -91,6 +100,10 @@ protected:
 
 		/// Gets a radian-angle to another Target.
 		double getDistance(const Target* const target) const;
+		/// Checks if another Target is certainly farther than a distance.
+		bool isBeyond(
+				const Target* const target,
+				double range) const;
 };
 
 }
@@ -53,20 +53,28 @@ Tile::SerializationKey Tile::serializationKey
 	4 + (2 * 4) + (2 * 4) + 1 + 1 + 1 + 1 // total bytes to save one tile
 };
 
+unsigned Tile::_stamp (0u); // static/private.
+
 
 /**
  * Creates the Tile at a specified Position.
- * @param pos - reference to a position
+ * @param pos		- reference to a position
+ * @param volatiles	- pointer to the battle's list of burning and smoking tiles (default nullptr)
  */
-Tile::Tile(const Position& pos)
+Tile::Tile(
+		const Position& pos,
+		std::vector<Tile*>* const volatiles)
 	:
 		_pos(pos),
+		_volatiles(volatiles),
+		_volatileListed(false),
 		_smoke(0),
 		_fire(0),
 		_explosive(0),
 		_explosiveType(DT_NONE),
 		_unit(nullptr),
 		_aniOffset(0),
+		_aniListed(false),
 		_visible(false),
 		_previewColor(0u),
 		_previewDir(-1),
@@ -129,6 +137,9 @@ void Tile::load(const YAML::Node& node)
 	_smoke     = node["smoke"]    .as<int>(_smoke);
 	_aniOffset = node["aniOffset"].as<int>(_aniOffset);
 
+	if (_fire != 0 || _smoke != 0)
+		listVolatile();
+
 	if (node["discovered"])
 	{
 		for (size_t
@@ -141,10 +152,10 @@ void Tile::load(const YAML::Node& node)
 	}
 
 	if (node["openDoorWest"])
-		_aniCycle[1u] = 7;
+		setSlideCycle(1u, 7);
 
 	if (node["openDoorNorth"])
-		_aniCycle[2u] = 7;
+		setSlideCycle(2u, 7);
 }
 
 /**
@@ -170,6 +181,9 @@ void Tile::loadBinary(
 	_fire      = unserializeInt(&buffer, serKey._fire);
 	_aniOffset = unserializeInt(&buffer, serKey._aniOffset);
 
+	if (_fire != 0 || _smoke != 0)
+		listVolatile();
+
 	const int boolFields (unserializeInt(
 									&buffer,
 									serKey.boolFields));
@@ -178,8 +192,8 @@ void Tile::loadBinary(
 	_revealed[ST_NORTH]    = (boolFields & 0x02) ? true : false;
 	_revealed[ST_CONTENT]  = (boolFields & 0x04) ? true : false;
 
-	_aniCycle[O_WESTWALL]  = (boolFields & 0x08) ? 7 : 0;
-	_aniCycle[O_NORTHWALL] = (boolFields & 0x10) ? 7 : 0;
+	setSlideCycle(O_WESTWALL,  (boolFields & 0x08) ? 7 : 0);
+	setSlideCycle(O_NORTHWALL, (boolFields & 0x10) ? 7 : 0);
 
 //	if (_fire || _smoke) _animationOffset = std::rand() % 4;
 }
@@ -282,6 +296,8 @@ void Tile::setMapData(
 	_parts[partType]		= part;
 	_partIds[partType]		= partId;
 	_partSetIds[partType]	= partSetId;
+
+	++_stamp;
 }
 
 /**
@@ -524,7 +540,7 @@ DoorResult Tile::openDoor(
 					if (unit != nullptr && unit->getTu() < _parts[partType]->getTuCostPart(unit->getMoveTypeUnit())) //+ unit->getActionTu(reserved, unit->getMainHandWeapon()))
 						return DR_ERR_TU;
 
-					_aniCycle[partType] = 1; // start sliding door animation
+					setSlideCycle(partType, 1); // start sliding door animation
 					return DR_UFO_OPEN;
 
 				default: // frames 1..6 -> the slide-open animation is in progress
@@ -544,7 +560,7 @@ DoorResult Tile::openDoor(
  */
 void Tile::openAdjacentDoor(const MapDataType partType)
 {
-	_aniCycle[partType] = 1;
+	setSlideCycle(partType, 1);
 }
 
 /**
@@ -561,13 +577,31 @@ bool Tile::closeSlideDoor()
 	{
 		if (isSlideDoorOpen(static_cast<MapDataType>(i)) == true)
 		{
-			_aniCycle[i] = 0;
+			setSlideCycle(i, 0);
 			ret = true;
 		}
 	}
 	return ret;
 }
 
+/**
+ * Sets the animation-frame of a ufo-door.
+ * @note A ufo-door lets units through only at frames 0 and 1 - see
+ * getTuCostTile() - so the stamp is bumped whenever the frame crosses that
+ * boundary.
+ * @param partType	- a tile-part type (MapData.h)
+ * @param cycle		- the animation-frame
+ */
+void Tile::setSlideCycle( // private.
+		size_t partType,
+		int cycle)
+{
+	if ((_aniCycle[partType] < 2) != (cycle < 2))
+		++_stamp;
+
+	_aniCycle[partType] = cycle;
+}
+
 /**
  * Sets this Tile's sections' revealed flags.
  * @note Also re-caches the sprites for any unit on this Tile if the value changes.
@@ -751,6 +785,9 @@ int Tile::destroyTilepart(
 		}
 	}
 
+	if (armor != -1)
+		battleSave->addAnimatedTile(this); // in case a death-part animates
+
 	return armor;
 }
 
@@ -957,12 +994,17 @@ bool Tile::addFire(int turns)
 	if (turns != 0 && allowFire() == true)
 	{
 		if (_smoke == 0 && _fire == 0)
+		{
 			_aniOffset = RNG::seedless(0,3);
+			listVolatile();
+		}
 
 		_fire += turns;
 
 		if (_fire > 12) _fire = 12;
 
+		++_stamp;
+
 		if (_smoke < _fire + 2)
 			_smoke = _fire + RNG::generate(2,3);
 
@@ -982,6 +1024,8 @@ int Tile::decreaseFire()
 		_fire = 0;
 		if (_smoke == 0) _aniOffset = 0;
 	}
+
+	++_stamp;
 	return _fire;
 }
 
@@ -1003,7 +1047,10 @@ void Tile::addSmoke(int turns)
 	if (turns != 0 && allowSmoke() == true)
 	{
 		if (_smoke == 0 && _fire == 0)
+		{
 			_aniOffset = RNG::seedless(0,3);
+			listVolatile();
+		}
 
 		if ((_smoke += turns) > 12)
 			_smoke = 12;
@@ -1038,6 +1085,35 @@ int Tile::getSmoke() const
 	return _smoke;
 }
 
+/**
+ * Adds this Tile to the battle's list of burning and smoking tiles.
+ * @note Called when the Tile first gets fire or smoke so that
+ * SavedBattleGame::tileVolatiles() doesn't have to search the map.
+ */
+void Tile::listVolatile() // private.
+{
+	if (_volatileListed == false && _volatiles != nullptr)
+	{
+		_volatileListed = true;
+		_volatiles->push_back(this);
+	}
+}
+
+/**
+ * Flags this Tile as removed from the battle's list of burning and smoking
+ * tiles if its fire and smoke are gone.
+ * @return, true if the Tile should be removed from the list
+ */
+bool Tile::delistVolatile()
+{
+	if (_fire == 0 && _smoke == 0)
+	{
+		_volatileListed = false;
+		return true;
+	}
+	return false;
+}
+
 /**
  * Checks if this Tile accepts smoke.
  * @note Only the object is checked: diagonal bigWalls that have their
@@ -1200,14 +1276,19 @@ void Tile::hitTileContent(SavedBattleGame* const battleSave)
 
 /**
  * Animates this Tile.
- * @note This advances the current frame for every part. Ufo-doors are a bit
- * special - they animate only when triggered; when ufo-doors are on frame 0
- * (closed) or frame 7 (open) they are not animated further until further
+ * @note This advances the current frame for every animated part. Ufo-doors are
+ * a bit special - they animate only when triggered; when ufo-doors are on frame
+ * 0 (closed) or frame 7 (open) they are not animated further until further
  * notice. A ufo-door on an XCOM craft has only 4 frames; when it hits frame 3
- * it jumps to frame 7 (open).
+ * it jumps to frame 7 (open). Other parts are set to the Map's cycle so that
+ * they stay in sync with each other.
+ * @param aniCycle - the Map's current animation-frame
+ * @return, true if this Tile still has animated parts
  */
-void Tile::animateTile()
+bool Tile::animateTile(int aniCycle)
 {
+	bool ret (false);
+
 	const MapData* part;
 
 	int cycle;
@@ -1216,27 +1297,29 @@ void Tile::animateTile()
 			i != TILE_PARTS;
 			++i)
 	{
-		if ((part = _parts[i]) != nullptr)
+		if ((part = _parts[i]) != nullptr
+			&& part->isAnimated() == true)
 		{
+			ret = true;
+
 			switch (part->getPsychedelic())
 			{
 				default:
 				case 0:
-					cycle = _aniCycle[i];
-					if (part->isSlideDoor() == false
-						|| (   cycle != 0 // ufo-door is currently static ->
-							&& cycle != 7))
+					if (part->isSlideDoor() == false)
+						_aniCycle[i] = aniCycle;
+					else if ((cycle = _aniCycle[i]) != 0 // ufo-door is currently static ->
+						&& cycle != 7)
 					{
 						if (++cycle == 8)
 							cycle = 0;
 						else if (cycle == 3								// special handling for Avenger and Lightning doors:
-							&& part->isSlideDoor() == true				// their cycle has only 4 frames instead of the regular 8.
-							&& part->getSpecialType() == START_TILE)	// -> so ensure that their doors are flagged as as StartTiles in the MCDs
-						{
+							&& part->getSpecialType() == START_TILE)	// their cycle has only 4 frames instead of the regular 8.
+						{												// -> so ensure that their doors are flagged as as StartTiles in the MCDs
 							cycle = 7;
 						}
 
-						_aniCycle[i] = cycle;
+						setSlideCycle(i, cycle);
 					}
 					break;
 
@@ -1251,6 +1334,27 @@ void Tile::animateTile()
 			}
 		}
 	}
+	return ret;
+}
+
+/**
+ * Checks if this Tile has any parts that animate.
+ * @return, true if animated
+ */
+bool Tile::isAnimated() const
+{
+	for (size_t
+			i = 0u;
+			i != TILE_PARTS;
+			++i)
+	{
+		if (_parts[i] != nullptr
+			&& _parts[i]->isAnimated() == true)
+		{
+			return true;
+		}
+	}
+	return false;
 }
 
 /**
@@ -1285,6 +1389,7 @@ Surface* Tile::getSprite(MapDataType parttype) const
 void Tile::setTileUnit(BattleUnit* const unit)
 {
 	_unit = unit;
+	++_stamp;
 }
 
 /**
@@ -78,10 +78,14 @@ private:
 		LIGHTLAYERS	= 3u,
 		SECTIONS	= 3u;
 
+	static unsigned _stamp;
+
 	bool
+		_aniListed,
 		_danger,
 		_revealed[SECTIONS],
-		_visible;
+		_visible,
+		_volatileListed;
 	int
 		_aniOffset,
 		_aniCycle[TILE_PARTS],
@@ -103,6 +107,7 @@ private:
 	Position _pos;
 
 	std::vector<BattleItem*> _inventory;
+	std::vector<Tile*>* _volatiles;
 
 	/// Checks if the Tile accepts smoke.
 	bool allowSmoke() const;
@@ -112,8 +117,20 @@ private:
 	/// Converts obscure inverse MCD notation to understandable percentages.
 	static int convertBurnToPct(int burn);
 
+	/// Adds the Tile to the battle's list of burning and smoking tiles.
+	void listVolatile();
+
+	/// Sets the animation-frame of a ufo-door.
+	void setSlideCycle(
+			size_t partType,
+			int cycle);
+
 
 	public:
+		/// Gets the count of changes to the parts, doors, fire or units of all Tiles.
+		static unsigned getStamp()
+		{ return _stamp; }
+
 		static struct SerializationKey
 		{
 			// how many bytes to store for each variable or each member of array of the same name
@@ -128,7 +145,9 @@ private:
 		} serializationKey;
 
 		/// Creates a Tile.
-		explicit Tile(const Position& pos);
+		explicit Tile(
+				const Position& pos,
+				std::vector<Tile*>* const volatiles = nullptr);
 		/// Cleans up the Tile.
 		~Tile();
 
@@ -282,12 +301,22 @@ private:
 		/// Gets current smoke-value.
 		int getSmoke() const; // kL_note: Made this inline, but may result in UB if say BattleUnit->getFire() conflicts. So ... don't.
 //		{ return _smoke; }
+		/// Removes the Tile from the battle's list of burning and smoking tiles if it's clear.
+		bool delistVolatile();
 
 		/// Ends the Tile's turn. Units catch on fire.
 		void hitTileContent(SavedBattleGame* const battleSave = nullptr);
 
 		/// Animates the tile-parts.
-		void animateTile();
+		bool animateTile(int aniCycle);
+		/// Checks if the Tile has any parts that animate.
+		bool isAnimated() const;
+		/// Checks if the Tile is in the battle's list of animated tiles.
+		bool isAniListed() const
+		{ return _aniListed; }
+		/// Sets if the Tile is in the battle's list of animated tiles.
+		void setAniListed(bool listed = true)
+		{ _aniListed = listed; }
 		/// Gets fire/smoke animation-offset.
 		int getAnimationOffset() const;
 
@@ -345,6 +374,30 @@ private:
 		bool getDangerous() const;
 };
 
+
+/**
+ * Functor that sorts Tiles in the order of the battlefield's tile-array.
+ */
+struct IsPrecedingTile
+{
+	/**
+	 * Compares tiles @a tile1 and @a tile2.
+	 * @param tile1 - pointer to first Tile
+	 * @param tile2 - pointer to second Tile
+	 * @return, true if tile @a tile1 must come before @a tile2
+	 */
+	bool operator ()(const Tile* const tile1, const Tile* const tile2) const
+	{
+		const Position
+			& pos1 (tile1->getPosition()),
+			& pos2 (tile2->getPosition());
+
+		if (pos1.z != pos2.z) return (pos1.z < pos2.z);
+		if (pos1.y != pos2.y) return (pos1.y < pos2.y);
+		return (pos1.x < pos2.x);
+	}
+};
+
 }
 
 #endif
@@ -293,9 +293,7 @@ void Transfer::advance(Base* const base)
 		_delivered = true;
 
 		if (_soldier != nullptr)
-			base->getSoldiers()->insert(
-									base->getSoldiers()->begin(),
-									_soldier);
+			base->addSoldier(_soldier, true);
 		else if (_craft != nullptr)
 		{
 			base->getCrafts()->push_back(_craft);
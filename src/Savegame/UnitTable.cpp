@@ -0,0 +1,115 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UnitTable.h"
+
+#include "../Ruleset/RuleArmor.h"
+
+
+namespace OpenXcom
+{
+
+/**
+ * Creates a UnitTable.
+ * @param units - pointer to the battle's vector of units
+ */
+UnitTable::UnitTable(const std::vector<BattleUnit*>* const units)
+	:
+		_depth(0),
+		_units(units)
+{}
+
+/**
+ * Cleans up the UnitTable.
+ */
+UnitTable::~UnitTable()
+{}
+
+/**
+ * Starts a sweep.
+ * @note The outermost sweep copies the fields of all units into the rows.
+ */
+void UnitTable::beginSweep() // private.
+{
+	if (_depth++ == 0)
+	{
+		_rows.resize(_units->size());
+
+		std::vector<Row>::iterator row (_rows.begin());
+		for (std::vector<BattleUnit*>::const_iterator
+				i  = _units->begin();
+				i != _units->end();
+				++i, ++row)
+		{
+			row->unit    = *i;
+			row->pos     = (*i)->getPosition();
+			row->exposed = (*i)->getExposed();
+			row->faction = (*i)->getFaction();
+			row->status  = static_cast<unsigned char>((*i)->getUnitStatus());
+			row->size    = static_cast<unsigned char>((*i)->getArmor()->getSize());
+			row->flags   = 0u;
+
+			if ((*i)->getUnitTile() != nullptr)
+				row->flags |= RF_ONMAP;
+
+			if ((*i)->getUnitVisible() == true)
+				row->flags |= RF_VISIBLE;
+		}
+	}
+}
+
+/**
+ * Ends a sweep.
+ */
+void UnitTable::endSweep() // private.
+{
+	--_depth;
+}
+
+/**
+ * Sets a row's unit visible to the Player.
+ * @note Writes through to the BattleUnit.
+ * @param row - index of the row
+ */
+void UnitTable::setVisible(size_t row)
+{
+	_rows[row].unit->setUnitVisible();
+	_rows[row].flags |= RF_VISIBLE;
+}
+
+/**
+ * Checks if a row's unit is dead, unconscious or latent.
+ * @note Same as BattleUnit::isOut_t(OUT_STAT).
+ * @param row - reference to a Row
+ * @return, true if out
+ */
+bool UnitTable::isOut(const Row& row) // static.
+{
+	switch (row.status)
+	{
+		case STATUS_DEAD:
+		case STATUS_UNCONSCIOUS:
+		case STATUS_LATENT:
+		case STATUS_LATENT_START:
+			return true;
+	}
+	return false;
+}
+
+}
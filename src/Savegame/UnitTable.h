@@ -0,0 +1,131 @@
+/*
+ * Copyright 2010-2020 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPENXCOM_UNITTABLE_H
+#define OPENXCOM_UNITTABLE_H
+
+#include <vector>		// std::vector
+
+#include "BattleUnit.h"
+
+
+namespace OpenXcom
+{
+
+/**
+ * A packed copy of the few fields of the battle's BattleUnits that the FoV and
+ * AI scans test for every unit.
+ * @note The scans test each unit against every other unit - or against every
+ * tile of a search-area - and a BattleUnit is large, so the tests cost a cache-
+ * miss per unit each time. The rows of the table are small and contiguous.
+ * @note The rows are refreshed from the BattleUnits when the outermost Sweep
+ * starts; units don't move or change faction or status during a sweep. A sweep
+ * that changes one of the fields must write it through - see setVisible().
+ * Row i is the unit at index i of SavedBattleGame's vector of units.
+ * @note Main-thread only.
+ */
+class UnitTable
+{
+
+public:
+	/**
+	 * The flags of a Row.
+	 */
+	enum RowFlag
+	{
+		RF_ONMAP	= 0x01,	// the unit is standing on a Tile - ie. not carried or dead
+		RF_VISIBLE	= 0x02	// the unit is visible to the Player
+	};
+
+	/**
+	 * The fields of a BattleUnit as of the last refresh.
+	 */
+	struct Row
+	{
+		BattleUnit* unit;
+		Position pos;
+		int exposed;
+		UnitFaction faction;
+		unsigned char
+			status,	// UnitStatus
+			size,	// armor-size
+			flags;	// RowFlag
+	};
+
+	/**
+	 * Keeps the table fresh for the lifetime of this object.
+	 * @note Sweeps can nest; only the outermost one refreshes the rows. So the
+	 * AI opens one around a search-area and each tallySpotters() call for its
+	 * positions shares one refresh.
+	 */
+	class Sweep
+	{
+		private:
+			UnitTable* const _table;
+
+			Sweep(const Sweep&) = delete;
+			Sweep& operator= (const Sweep&) = delete;
+
+		public:
+			/// Starts a sweep.
+			explicit Sweep(UnitTable* const table)
+				:
+					_table(table)
+			{ _table->beginSweep(); }
+			/// Ends the sweep.
+			~Sweep()
+			{ _table->endSweep(); }
+	};
+
+
+private:
+	int _depth;
+
+	const std::vector<BattleUnit*>* const _units;
+	std::vector<Row> _rows;
+
+	/// Starts a sweep.
+	void beginSweep();
+	/// Ends a sweep.
+	void endSweep();
+
+	UnitTable(const UnitTable&) = delete;
+	UnitTable& operator= (const UnitTable&) = delete;
+
+
+	public:
+		/// Creates a UnitTable.
+		explicit UnitTable(const std::vector<BattleUnit*>* const units);
+		/// Cleans up the UnitTable.
+		~UnitTable();
+
+		/// Gets the rows of the table.
+		const std::vector<Row>& getRows() const
+		{ return _rows; }
+
+		/// Sets a row's unit visible to the Player.
+		void setVisible(size_t row);
+
+		/// Checks if a row's unit is dead, unconscious or latent.
+		static bool isOut(const Row& row);
+};
+
+}
+
+#endif
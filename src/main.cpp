@@ -27,8 +27,10 @@
 #include "Engine/CrossPlatform.h"
 #include "Engine/Game.h"
 #include "Engine/Logger.h"
+#include "Engine/LogWriter.h"
 #include "Engine/Options.h"
 #include "Engine/Screen.h" // kL
+#include "Engine/WorkerPool.h"
 
 #include "Menu/StartState.h"
 
@@ -69,11 +71,32 @@ int main(
 #endif
 
 		if (Options::init(argc, argv) == false)
+		{
+			LogWriter::stop();
 			return EXIT_SUCCESS;
+		}
 
 		if (Options::verboseLogging == true)
 			Logger::reportLevel() = LOG_VERBOSE;
 
+		Logger::subsystemLevel(LOGSUB_AI) = static_cast<SeverityLevel>(Options::logLevelAI);
+
+		WorkerPool::start();
+
+		if (Options::benchBattle.empty() == false // run the tactical-bench or geoscape-soak w/out display or sound
+			|| Options::benchGenerate == true
+			|| Options::soakGame.empty() == false)
+		{
+			static char
+				videoDriver[] = "SDL_VIDEODRIVER=dummy",
+				audioDriver[] = "SDL_AUDIODRIVER=dummy";
+			SDL_putenv(videoDriver);
+			SDL_putenv(audioDriver);
+
+			Options::headless =
+			Options::mute = true;
+		}
+
 //		Options::baseXResolution = Options::displayWidth;
 //		Options::baseYResolution = Options::displayHeight;
 		Options::baseXResolution = Screen::ORIGINAL_WIDTH;	// kL
@@ -94,6 +117,8 @@ int main(
 	catch (std::exception& e)
 	{
 		CrossPlatform::showFatalError(e.what());
+		WorkerPool::stop();
+		LogWriter::stop();
 		exit(EXIT_FAILURE);
 	}
 #endif
@@ -107,7 +132,10 @@ int main(
 	// Comment this for faster exit. by an attosecond ...
 	delete ptrG;
 
+	WorkerPool::stop();
+
 	Log(LOG_INFO) << "0xC_kL is shutting down.";
+	LogWriter::stop();
 	return EXIT_SUCCESS;
 }
 